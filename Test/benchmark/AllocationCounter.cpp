@@ -0,0 +1,40 @@
+//
+// Created by timap on 18.10.2026.
+//
+#include "AllocationCounter.h"
+
+#include <atomic>
+#include <cstdlib>
+#include <new>
+
+/**
+ * @brief the amount of calls to any replaced operator new
+ *
+ * @note relaxed, because only the total amount is of interest and not the order of allocations between threads
+ */
+static std::atomic<uint64_t> amount_allocations = 0;
+
+/**
+ * @brief allocates memory with malloc and counts the allocation
+ *
+ * @param size the amount of bytes to allocate
+ * @return a pointer to the allocated memory
+ */
+static void* countedAllocation(std::size_t size) {
+  amount_allocations.fetch_add(1, std::memory_order_relaxed);
+  // malloc(0) is allowed to return a nullptr, but operator new is not
+  void* ptr = std::malloc(size == 0 ? 1 : size);
+  if (ptr == nullptr) throw std::bad_alloc();
+  return ptr;
+}
+
+// (function documentation is provided in the corresponding header)
+uint64_t AllocationCounter::amountAllocations() noexcept { return amount_allocations.load(std::memory_order_relaxed); }
+
+// replaced global allocation functions
+void* operator new(std::size_t size) { return countedAllocation(size); }
+void* operator new[](std::size_t size) { return countedAllocation(size); }
+void operator delete(void* ptr) noexcept { std::free(ptr); }
+void operator delete[](void* ptr) noexcept { std::free(ptr); }
+void operator delete(void* ptr, std::size_t) noexcept { std::free(ptr); }
+void operator delete[](void* ptr, std::size_t) noexcept { std::free(ptr); }
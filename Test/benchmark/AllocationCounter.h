@@ -0,0 +1,46 @@
+//
+// Created by timap on 18.10.2026.
+//
+
+#pragma once
+#include <benchmark/benchmark.h>
+
+#include <cstdint>
+
+namespace AllocationCounter {
+/**
+ * @brief the amount of heap allocations (i.e. calls to operator new) since the start of the program
+ *
+ * @note counted by replacing the global operator new in AllocationCounter.cpp
+ */
+uint64_t amountAllocations() noexcept;
+
+/**
+ * @brief a simple helper to report the allocations made inside of a benchmark loop as a per iteration counter
+ *
+ * @note construct it right before the benchmark loop and call report() right after it
+ */
+class Scope {
+ private:
+  /**
+   * @brief the amount of allocations at the start of the measured section
+   */
+  uint64_t allocations_at_start;
+
+ public:
+  /**
+   * @brief starts counting allocations
+   */
+  Scope() noexcept : allocations_at_start(amountAllocations()) {}
+
+  /**
+   * @brief adds the counter "allocs/op" to the given benchmark state
+   *
+   * @param state the state of the currently running benchmark
+   */
+  void report(benchmark::State& state) const {
+    const double allocations = static_cast<double>(amountAllocations() - allocations_at_start);
+    state.counters["allocs/op"] = benchmark::Counter(allocations, benchmark::Counter::kAvgIterations);
+  }
+};
+}  // namespace AllocationCounter
@@ -0,0 +1,172 @@
+//
+// Created by timap on 18.10.2026.
+//
+#include "BenchmarkCorpus.h"
+
+#include <cstdint>
+#include <fstream>
+#include <iostream>
+#include <sstream>
+
+#include "../../src/Check/Check.h"
+#include "../../src/PossibleMoves/PossibleMoves.h"
+#include "../Main_Folder_Path_For_Testing.h"
+
+/**
+ * @brief the maximum amount of half moves in each game line
+ */
+constexpr int max_game_line_length = 40;
+
+/**
+ * @brief reads the first FEN of each line in a dataset (i.e. everything before the first ';')
+ *
+ * @param relative_path the path to the dataset relative to the main folder of the project
+ * @param fen_strings the vector to add the read FEN strings to
+ */
+static void readFenStrings(const std::string& relative_path, std::vector<std::string>& fen_strings) {
+  std::ifstream file(main_folder_path + relative_path);
+  if (!file.good()) {
+    std::cerr << missing_main_folder_path_error << std::endl;
+    std::exit(1);
+  }
+
+  std::string line;
+  while (std::getline(file, line)) {
+    std::istringstream line_stream(line);
+    std::string fen_str;
+    std::getline(line_stream, fen_str, ';');
+    fen_strings.push_back(fen_str);
+  }
+}
+
+/**
+ * @brief plays a deterministic pseudo random line of legal moves from the given position
+ *
+ * @param position the position to start the line from
+ * @param seed the seed of the pseudo random move selection
+ * @return the played game line
+ */
+static BenchmarkCorpus::GameLine playGameLine(const BenchmarkCorpus::Position& position, uint64_t seed) {
+  BenchmarkCorpus::GameLine line = {position.board, position.board, {}, {}};
+  Team::Team player = position.current_player;
+
+  std::vector<Move> move_list;
+  for (int i = 0; i < max_game_line_length; ++i) {
+    move_list.clear();
+    PossibleMoves::getAllPossibleMoves(line.end, move_list, player);
+    PossibleMoves::trimMovesPuttingPlayerIntoCheckmate(line.end, move_list, player);
+    if (move_list.empty()) break;
+
+    // simple LCG, because std distributions are not guaranteed to be the same across standard libraries
+    seed = seed * 6364136223846793005ULL + 1442695040888963407ULL;
+    const Move move = move_list[(seed >> 33) % move_list.size()];
+
+    line.moves.push_back(move);
+    line.executed_moves.push_back(line.end.movePiece(move));
+    player = Team::getEnemyTeam(player);
+  }
+  return line;
+}
+
+/**
+ * @brief makes a valid FEN invalid
+ *
+ * @param fen_str a valid FEN
+ * @param kind selects how the FEN is made invalid
+ * @return the invalid FEN
+ */
+static std::string corruptFen(std::string fen_str, uint64_t kind) {
+  const uint64_t board_end = fen_str.find(' ');
+  switch (kind % 5) {
+    case 0:
+      // an illegal char in the middle of the board
+      fen_str[board_end / 2] = 'x';
+      break;
+    case 1:
+      // a row with too many squares
+      fen_str.insert(board_end, "1");
+      break;
+    case 2:
+      // illegal castling rights
+      fen_str.replace(fen_str.find(' ', board_end + 1) + 1, 1, "Z");
+      break;
+    case 3:
+      // missing black king
+      fen_str[fen_str.find('k')] = 'q';
+      break;
+    default:
+      // missing turn counter
+      fen_str.erase(fen_str.find_last_of(' '));
+      break;
+  }
+  return fen_str;
+}
+
+namespace BenchmarkCorpus {
+
+// (function documentation is provided in the corresponding header)
+const std::vector<std::string>& fenStrings() {
+  static const std::vector<std::string> fen_strings = [] {
+    std::vector<std::string> result;
+    readFenStrings("/Test/gtest/datasets/perft.txt", result);
+    readFenStrings("/Test/gtest/datasets/ParsingTestData.txt", result);
+    return result;
+  }();
+  return fen_strings;
+}
+
+// (function documentation is provided in the corresponding header)
+const std::vector<std::string>& dirtyFenStrings() {
+  static const std::vector<std::string> dirty_fen_strings = [] {
+    std::vector<std::string> result = fenStrings();
+    for (uint64_t i = 1; i < result.size(); i += 2) result[i] = corruptFen(result[i], i / 2);
+    return result;
+  }();
+  return dirty_fen_strings;
+}
+
+// (function documentation is provided in the corresponding header)
+const std::vector<Position>& positions() {
+  static const std::vector<Position> all_positions = [] {
+    std::vector<Position> result;
+    for (const std::string& fen_str : fenStrings()) {
+      try {
+        const Fen fen = Fen::buildFenFromStr(fen_str);
+        result.push_back({Board(fen), fen.current_player, fen.amount_half_moves, fen.current_turn});
+      } catch (const FenParsingException& fenException) {
+        std::cerr << fenException.what() << std::endl;
+        std::exit(1);
+      }
+    }
+    return result;
+  }();
+  return all_positions;
+}
+
+// (function documentation is provided in the corresponding header)
+const std::vector<Position>& perftPositions() {
+  static const std::vector<Position> perft_positions = [] {
+    std::vector<std::string> perft_fen_strings;
+    readFenStrings("/Test/gtest/datasets/perft.txt", perft_fen_strings);
+    // the perft positions are at the start of the corpus
+    return std::vector<Position>(positions().begin(), positions().begin() + perft_fen_strings.size());
+  }();
+  return perft_positions;
+}
+
+// (function documentation is provided in the corresponding header)
+const std::vector<GameLine>& gameLines() {
+  static const std::vector<GameLine> game_lines = [] {
+    std::vector<GameLine> result;
+    const std::vector<Position>& perft_positions = perftPositions();
+
+    for (uint64_t i = 0; i < perft_positions.size(); ++i) {
+      GameLine line = playGameLine(perft_positions[i], i + 1);
+      // positions that are already checkmate or stalemate do not have any moves to measure
+      if (!line.moves.empty()) result.push_back(line);
+    }
+    return result;
+  }();
+  return game_lines;
+}
+}  // namespace BenchmarkCorpus
@@ -0,0 +1,92 @@
+//
+// Created by timap on 18.10.2026.
+//
+
+#pragma once
+#include <string>
+#include <vector>
+
+#include "../../src/Board/Board.h"
+
+/**
+ * @brief the fixed set of positions all benchmarks are run on
+ *
+ * @note drawn from the FEN in the perft dataset and the first FEN of each line of the parsing dataset,
+ * meaning that benchmark results are comparable as long as these datasets do not change
+ */
+namespace BenchmarkCorpus {
+/**
+ * @brief a single already parsed position of the corpus
+ */
+struct Position {
+  /**
+   * @brief the position as a Chess Board
+   */
+  Board board;
+  /**
+   * @brief the player, who can currently make a move
+   */
+  Team::Team current_player;
+  /**
+   * @brief the number of half moves since the last pawn move or capture
+   */
+  int amount_half_moves;
+  /**
+   * @brief the number of the full moves in the game
+   */
+  int current_turn;
+};
+
+/**
+ * @brief a sequence of legal moves played from a position of the corpus
+ *
+ * @note used to measure movePiece() and undoMove() without having to copy the board before every single move
+ */
+struct GameLine {
+  /**
+   * @brief the board before the first move of the line
+   */
+  Board start;
+  /**
+   * @brief the board after the last move of the line
+   */
+  Board end;
+  /**
+   * @brief the moves of the line in the order they are played
+   */
+  std::vector<Move> moves;
+  /**
+   * @brief the executed moves as returned by movePiece() in the order they are played
+   */
+  std::vector<ExecutedMove> executed_moves;
+};
+
+/**
+ * @return all FEN strings of the corpus in the order they appear in the datasets
+ */
+const std::vector<std::string>& fenStrings();
+
+/**
+ * @return the FEN strings of the corpus where every second one is made invalid in a deterministic way \n
+ * (e.g. an illegal char in the board, an illegal castling right or a missing turn counter)
+ *
+ * @note used to measure the parsing of inputs where a lot of the FENs are invalid
+ */
+const std::vector<std::string>& dirtyFenStrings();
+
+/**
+ * @return all positions of the corpus in the same order as fenStrings()
+ */
+const std::vector<Position>& positions();
+
+/**
+ * @return the positions of the perft dataset (i.e. the start of positions())
+ */
+const std::vector<Position>& perftPositions();
+
+/**
+ * @return one deterministic pseudo random line of legal moves for each position of the perft dataset \n
+ * (positions without any legal moves are skipped)
+ */
+const std::vector<GameLine>& gameLines();
+}  // namespace BenchmarkCorpus
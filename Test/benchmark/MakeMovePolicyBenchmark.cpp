@@ -0,0 +1,56 @@
+//
+// Created by timap on 18.10.2026.
+//
+#include <benchmark/benchmark.h>
+
+#include <cstdint>
+#include <vector>
+
+#include "../../src/Board/MakeMovePolicy.h"
+#include "../../src/Bot/MinMax/MinMax.h"
+#include "../../src/Perft/Perft.h"
+#include "AllocationCounter.h"
+#include "BenchmarkCorpus.h"
+
+// compares the different ways of getting to a child node (see MakeMovePolicy.h) on the same workloads,
+// each iteration goes through the whole corpus, so nodes/s is the number to compare between the policies
+
+#define POLICY_PERFT_DEPTH 2
+#define POLICY_MINMAX_DEPTH 2
+
+template <class Policy>
+static void BM_Perft(benchmark::State& state) {
+  const std::vector<BenchmarkCorpus::Position>& positions = BenchmarkCorpus::positions();
+  uint64_t nodes = 0;
+
+  AllocationCounter::Scope allocations;
+  for (auto _ : state) {
+    for (const BenchmarkCorpus::Position& position : positions) {
+      nodes += Perft::perft<Policy>(position.board, POLICY_PERFT_DEPTH, position.current_player);
+    }
+  }
+  allocations.report(state);
+  state.counters["nodes/s"] = benchmark::Counter(static_cast<double>(nodes), benchmark::Counter::kIsRate);
+}
+BENCHMARK_TEMPLATE(BM_Perft, MakeMovePolicy::CopyMake)->Unit(benchmark::kMillisecond);
+BENCHMARK_TEMPLATE(BM_Perft, MakeMovePolicy::UndoMove)->Unit(benchmark::kMillisecond);
+BENCHMARK_TEMPLATE(BM_Perft, MakeMovePolicy::UndoStack)->Unit(benchmark::kMillisecond);
+
+template <class Policy>
+static void BM_MinMax(benchmark::State& state) {
+  const std::vector<BenchmarkCorpus::Position>& positions = BenchmarkCorpus::positions();
+  SearchStats stats = SearchStats();
+
+  AllocationCounter::Scope allocations;
+  for (auto _ : state) {
+    for (const BenchmarkCorpus::Position& position : positions) {
+      benchmark::DoNotOptimize(MinMaxWithPolicy<Policy>(position.board, POLICY_MINMAX_DEPTH, position.current_player,
+                                                        position.current_turn * 2, stats));
+    }
+  }
+  allocations.report(state);
+  state.counters["nodes/s"] = benchmark::Counter(static_cast<double>(stats.nodes), benchmark::Counter::kIsRate);
+}
+BENCHMARK_TEMPLATE(BM_MinMax, MakeMovePolicy::CopyMake)->Unit(benchmark::kMillisecond);
+BENCHMARK_TEMPLATE(BM_MinMax, MakeMovePolicy::UndoMove)->Unit(benchmark::kMillisecond);
+BENCHMARK_TEMPLATE(BM_MinMax, MakeMovePolicy::UndoStack)->Unit(benchmark::kMillisecond);
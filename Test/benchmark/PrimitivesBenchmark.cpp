@@ -0,0 +1,487 @@
+//
+// Created by timap on 18.10.2026.
+//
+#include <benchmark/benchmark.h>
+
+#include <cstdint>
+#include <memory>
+#include <random>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "../../src/Bot/Evaluation/AttackMaps.h"
+#include "../../src/Bot/Evaluation/EvalCache.h"
+#include "../../src/Bot/Evaluation/Evaluate.h"
+#include "../../src/Bot/Evaluation/Nnue.h"
+#include "../../src/Bot/TranspositionTable/Zobrist.h"
+#include "../../src/Check/Check.h"
+#include "../../src/IO/Binary/PackedPosition.h"
+#include "../../src/PossibleMoves/PossibleMoves.h"
+#include "AllocationCounter.h"
+#include "BenchmarkCorpus.h"
+
+// each benchmark iteration works on exactly one element of the corpus (i.e. one position, FEN or move),
+// meaning the reported time per iteration is the time per operation
+
+static void BM_Board_movePiece(benchmark::State& state) {
+  const std::vector<BenchmarkCorpus::GameLine>& lines = BenchmarkCorpus::gameLines();
+  uint64_t line_idx = 0;
+  uint64_t move_idx = 0;
+  Board board = lines[line_idx].start;
+
+  AllocationCounter::Scope allocations;
+  for (auto _ : state) {
+    const BenchmarkCorpus::GameLine& line = lines[line_idx];
+    benchmark::DoNotOptimize(board.movePiece(line.moves[move_idx]));
+
+    // the board only gets copied once per line (i.e. about once every 40 moves)
+    if (++move_idx == line.moves.size()) {
+      move_idx = 0;
+      line_idx = (line_idx + 1) % lines.size();
+      board = lines[line_idx].start;
+    }
+  }
+  allocations.report(state);
+}
+BENCHMARK(BM_Board_movePiece);
+
+static void BM_Board_undoMove(benchmark::State& state) {
+  const std::vector<BenchmarkCorpus::GameLine>& lines = BenchmarkCorpus::gameLines();
+  uint64_t line_idx = 0;
+  uint64_t moves_left = lines[line_idx].executed_moves.size();
+  Board board = lines[line_idx].end;
+
+  AllocationCounter::Scope allocations;
+  for (auto _ : state) {
+    const BenchmarkCorpus::GameLine& line = lines[line_idx];
+    board.undoMove(line.executed_moves[--moves_left]);
+    benchmark::ClobberMemory();
+
+    // the board only gets copied once per line (i.e. about once every 40 moves)
+    if (moves_left == 0) {
+      line_idx = (line_idx + 1) % lines.size();
+      moves_left = lines[line_idx].executed_moves.size();
+      board = lines[line_idx].end;
+    }
+  }
+  allocations.report(state);
+}
+BENCHMARK(BM_Board_undoMove);
+
+static void BM_Board_copy(benchmark::State& state) {
+  const std::vector<BenchmarkCorpus::Position>& positions = BenchmarkCorpus::positions();
+  uint64_t idx = 0;
+
+  AllocationCounter::Scope allocations;
+  for (auto _ : state) {
+    Board copy = positions[idx].board;
+    benchmark::DoNotOptimize(copy);
+    benchmark::ClobberMemory();
+    if (++idx == positions.size()) idx = 0;
+  }
+  allocations.report(state);
+}
+BENCHMARK(BM_Board_copy);
+
+static void BM_PossibleMoves_getAllPossibleMoves(benchmark::State& state) {
+  const std::vector<BenchmarkCorpus::Position>& positions = BenchmarkCorpus::positions();
+  uint64_t idx = 0;
+  // reused like in MinMax and Perft, so that the measurement is not dominated by growing a new vector
+  std::vector<Move> move_list;
+  move_list.reserve(256);
+
+  AllocationCounter::Scope allocations;
+  for (auto _ : state) {
+    const BenchmarkCorpus::Position& position = positions[idx];
+    move_list.clear();
+    PossibleMoves::getAllPossibleMoves(position.board, move_list, position.current_player);
+    benchmark::DoNotOptimize(move_list.data());
+    if (++idx == positions.size()) idx = 0;
+  }
+  allocations.report(state);
+}
+BENCHMARK(BM_PossibleMoves_getAllPossibleMoves);
+
+static void BM_Check_isChecked(benchmark::State& state) {
+  const std::vector<BenchmarkCorpus::Position>& positions = BenchmarkCorpus::positions();
+  uint64_t idx = 0;
+
+  AllocationCounter::Scope allocations;
+  for (auto _ : state) {
+    const BenchmarkCorpus::Position& position = positions[idx];
+    const Team::Team player = position.current_player;
+    benchmark::DoNotOptimize(Check::isChecked(position.board, player, position.board.positions.getKingPos(player)));
+    if (++idx == positions.size()) idx = 0;
+  }
+  allocations.report(state);
+}
+BENCHMARK(BM_Check_isChecked);
+
+static void BM_evaluateBoard(benchmark::State& state) {
+  const std::vector<BenchmarkCorpus::Position>& positions = BenchmarkCorpus::positions();
+  uint64_t idx = 0;
+
+  AllocationCounter::Scope allocations;
+  for (auto _ : state) {
+    const BenchmarkCorpus::Position& position = positions[idx];
+    benchmark::DoNotOptimize(evaluateBoard(position.board, position.current_player));
+    if (++idx == positions.size()) idx = 0;
+  }
+  allocations.report(state);
+}
+BENCHMARK(BM_evaluateBoard);
+
+// the same evaluation as BM_evaluateBoard, but 64 boards at a time with evaluateBoards() (the time is still per board)
+static void BM_evaluateBoards(benchmark::State& state) {
+  constexpr uint64_t batch_size = 64;
+  std::vector<Board> boards;
+  std::vector<Team::Team> players;
+  for (const BenchmarkCorpus::Position& position : BenchmarkCorpus::positions()) {
+    boards.push_back(position.board);
+    players.push_back(position.current_player);
+  }
+  // whole batches only, so that every batch has the same size
+  boards.resize(boards.size() / batch_size * batch_size);
+  std::vector<int> scores(boards.size());
+  PawnHashTable pawn_table = PawnHashTable();
+  uint64_t idx = 0;
+
+  AllocationCounter::Scope allocations;
+  for (auto _ : state) {
+    if (idx % batch_size == 0) {
+      evaluateBoards(boards.data() + idx, players.data() + idx, batch_size, scores.data() + idx, pawn_table);
+    }
+    benchmark::DoNotOptimize(scores[idx]);
+    if (++idx == boards.size()) idx = 0;
+  }
+  allocations.report(state);
+}
+BENCHMARK(BM_evaluateBoards);
+
+// the material and PeSTO part of BM_evaluateBoards, 64 boards at a time with evaluateMaterial() (the time is still per
+// board, "make clean && make NNUE_FLAGS=-mavx2" measures the AVX2 lanes)
+static void BM_evaluateMaterial(benchmark::State& state) {
+  constexpr uint64_t batch_size = 64;
+  std::vector<Board> boards;
+  for (const BenchmarkCorpus::Position& position : BenchmarkCorpus::positions()) boards.push_back(position.board);
+  boards.resize(boards.size() / batch_size * batch_size);
+  std::vector<int> scores(boards.size());
+  std::vector<int> phases(boards.size());
+  uint64_t idx = 0;
+
+  AllocationCounter::Scope allocations;
+  for (auto _ : state) {
+    if (idx % batch_size == 0) {
+      evaluateMaterial(boards.data() + idx, batch_size, scores.data() + idx, phases.data() + idx);
+    }
+    benchmark::DoNotOptimize(scores[idx]);
+    if (++idx == boards.size()) idx = 0;
+  }
+  allocations.report(state);
+}
+BENCHMARK(BM_evaluateMaterial);
+
+// the part of BM_evaluateBoard spent on the attack maps shared by mobility and king danger
+static void BM_AttackMaps_build(benchmark::State& state) {
+  const std::vector<BenchmarkCorpus::Position>& positions = BenchmarkCorpus::positions();
+  uint64_t idx = 0;
+
+  AllocationCounter::Scope allocations;
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(AttackMaps::build(positions[idx].board));
+    if (++idx == positions.size()) idx = 0;
+  }
+  allocations.report(state);
+}
+BENCHMARK(BM_AttackMaps_build);
+
+// the key of the evaluation cache (and the transposition table), calculated from scratch
+static void BM_Zobrist_hashBoard(benchmark::State& state) {
+  const std::vector<BenchmarkCorpus::Position>& positions = BenchmarkCorpus::positions();
+  uint64_t idx = 0;
+
+  AllocationCounter::Scope allocations;
+  for (auto _ : state) {
+    const BenchmarkCorpus::Position& position = positions[idx];
+    benchmark::DoNotOptimize(Zobrist::hashBoard(position.board, position.current_player));
+    if (++idx == positions.size()) idx = 0;
+  }
+  allocations.report(state);
+}
+BENCHMARK(BM_Zobrist_hashBoard);
+
+// a hit in a cache of the default size that holds the evaluations of all positions of the corpus
+static void BM_EvalCache_probe(benchmark::State& state) {
+  const std::vector<BenchmarkCorpus::Position>& positions = BenchmarkCorpus::positions();
+  std::vector<uint64_t> hashes;
+  EvalCache cache = EvalCache();
+  for (const BenchmarkCorpus::Position& position : positions) {
+    hashes.push_back(Zobrist::hashBoard(position.board, position.current_player));
+    cache.store(hashes.back(), evaluateBoard(position.board, position.current_player));
+  }
+  uint64_t idx = 0;
+
+  AllocationCounter::Scope allocations;
+  for (auto _ : state) {
+    int score = 0;
+    benchmark::DoNotOptimize(cache.probe(hashes[idx], score));
+    benchmark::DoNotOptimize(score);
+    if (++idx == hashes.size()) idx = 0;
+  }
+  allocations.report(state);
+}
+BENCHMARK(BM_EvalCache_probe);
+
+/**
+ * @return a network with random weights (the time of the network does not depend on its weights)
+ */
+static const Nnue::Network& benchmarkNetwork() {
+  static const std::unique_ptr<Nnue::Network> network = [] {
+    std::mt19937 random(42);
+    std::unique_ptr<Nnue::Network> result = std::make_unique<Nnue::Network>();
+    for (int16_t& bias : result->feature_bias) bias = static_cast<int16_t>(random() % 61);
+    for (auto& weights : result->feature_weights) {
+      for (int16_t& weight : weights) weight = static_cast<int16_t>(static_cast<int>(random() % 17) - 8);
+    }
+    for (auto& weights : result->layer_1_weights) {
+      for (int8_t& weight : weights) weight = static_cast<int8_t>(static_cast<int>(random() % 81) - 40);
+    }
+    for (auto& weights : result->layer_2_weights) {
+      for (int8_t& weight : weights) weight = static_cast<int8_t>(static_cast<int>(random() % 255) - 127);
+    }
+    for (int8_t& weight : result->output_weights) weight = static_cast<int8_t>(static_cast<int>(random() % 255) - 127);
+    return result;
+  }();
+  return *network;
+}
+
+// both accumulators of the neural network calculated from scratch (as done at the root of a search)
+static void BM_Nnue_refreshAccumulator(benchmark::State& state) {
+  const std::vector<BenchmarkCorpus::Position>& positions = BenchmarkCorpus::positions();
+  const Nnue::Network& network = benchmarkNetwork();
+  Nnue::Accumulator accumulator;
+  uint64_t idx = 0;
+
+  AllocationCounter::Scope allocations;
+  for (auto _ : state) {
+    const BenchmarkCorpus::Position& position = positions[idx];
+    Nnue::refreshAccumulator(network, position.board, Team::WHITE, accumulator);
+    Nnue::refreshAccumulator(network, position.board, Team::BLACK, accumulator);
+    benchmark::DoNotOptimize(accumulator);
+    if (++idx == positions.size()) idx = 0;
+  }
+  allocations.report(state);
+}
+BENCHMARK(BM_Nnue_refreshAccumulator);
+
+// both accumulators of the neural network updated with a move (as done for every node of a search)
+static void BM_Nnue_AccumulatorStack_push(benchmark::State& state) {
+  const std::vector<BenchmarkCorpus::GameLine>& lines = BenchmarkCorpus::gameLines();
+  const Nnue::Network& network = benchmarkNetwork();
+  std::unique_ptr<Nnue::AccumulatorStack> stack = std::make_unique<Nnue::AccumulatorStack>();
+  uint64_t line_idx = 0;
+  uint64_t move_idx = 0;
+  Board board = lines[line_idx].start;
+  stack->reset(network, board);
+
+  AllocationCounter::Scope allocations;
+  for (auto _ : state) {
+    const Move move = lines[line_idx].moves[move_idx];
+    stack->push(board, move);
+    board.movePiece(move);
+    benchmark::DoNotOptimize(stack->current());
+
+    // the accumulators only get calculated from scratch once per line (i.e. about once every 40 moves)
+    if (++move_idx == lines[line_idx].moves.size()) {
+      move_idx = 0;
+      line_idx = (line_idx + 1) % lines.size();
+      board = lines[line_idx].start;
+      stack->reset(network, board);
+    }
+  }
+  allocations.report(state);
+}
+BENCHMARK(BM_Nnue_AccumulatorStack_push);
+
+// the layers of the neural network after the accumulators
+static void BM_Nnue_propagate(benchmark::State& state) {
+  const std::vector<BenchmarkCorpus::Position>& positions = BenchmarkCorpus::positions();
+  const Nnue::Network& network = benchmarkNetwork();
+  std::vector<Nnue::Accumulator> accumulators(positions.size());
+  for (uint64_t i = 0; i < positions.size(); ++i) {
+    Nnue::refreshAccumulator(network, positions[i].board, Team::WHITE, accumulators[i]);
+    Nnue::refreshAccumulator(network, positions[i].board, Team::BLACK, accumulators[i]);
+  }
+  uint64_t idx = 0;
+
+  AllocationCounter::Scope allocations;
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(Nnue::propagate(network, accumulators[idx], positions[idx].current_player));
+    if (++idx == positions.size()) idx = 0;
+  }
+  allocations.report(state);
+}
+BENCHMARK(BM_Nnue_propagate);
+
+static void BM_Fen_buildFenFromStr(benchmark::State& state) {
+  const std::vector<std::string>& fen_strings = BenchmarkCorpus::fenStrings();
+  uint64_t idx = 0;
+
+  AllocationCounter::Scope allocations;
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(Fen::buildFenFromStr(fen_strings[idx]));
+    if (++idx == fen_strings.size()) idx = 0;
+  }
+  allocations.report(state);
+  state.SetItemsProcessed(static_cast<int64_t>(state.iterations()));
+}
+BENCHMARK(BM_Fen_buildFenFromStr);
+
+static void BM_Fen_parseFenFromStr(benchmark::State& state) {
+  const std::vector<std::string>& fen_strings = BenchmarkCorpus::fenStrings();
+  uint64_t idx = 0;
+  Fen fen = Fen();
+
+  AllocationCounter::Scope allocations;
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(Fen::parseFenFromStr(fen_strings[idx], fen));
+    benchmark::DoNotOptimize(fen);
+    if (++idx == fen_strings.size()) idx = 0;
+  }
+  allocations.report(state);
+  state.SetItemsProcessed(static_cast<int64_t>(state.iterations()));
+}
+BENCHMARK(BM_Fen_parseFenFromStr);
+
+// the same FENs with every second one being invalid, to compare the cost of throwing with returning an error
+static void BM_Fen_buildFenFromStr_dirty(benchmark::State& state) {
+  const std::vector<std::string>& fen_strings = BenchmarkCorpus::dirtyFenStrings();
+  uint64_t idx = 0;
+  uint64_t valid = 0;
+
+  AllocationCounter::Scope allocations;
+  for (auto _ : state) {
+    try {
+      benchmark::DoNotOptimize(Fen::buildFenFromStr(fen_strings[idx]));
+      valid++;
+    } catch (const FenParsingException&) {
+    }
+    if (++idx == fen_strings.size()) idx = 0;
+  }
+  allocations.report(state);
+  benchmark::DoNotOptimize(valid);
+  state.SetItemsProcessed(static_cast<int64_t>(state.iterations()));
+}
+BENCHMARK(BM_Fen_buildFenFromStr_dirty);
+
+static void BM_Fen_parseFenFromStr_dirty(benchmark::State& state) {
+  const std::vector<std::string>& fen_strings = BenchmarkCorpus::dirtyFenStrings();
+  uint64_t idx = 0;
+  uint64_t valid = 0;
+  Fen fen = Fen();
+
+  AllocationCounter::Scope allocations;
+  for (auto _ : state) {
+    if (Fen::parseFenFromStr(fen_strings[idx], fen) == FenError::NONE) valid++;
+    benchmark::DoNotOptimize(fen);
+    if (++idx == fen_strings.size()) idx = 0;
+  }
+  allocations.report(state);
+  benchmark::DoNotOptimize(valid);
+  state.SetItemsProcessed(static_cast<int64_t>(state.iterations()));
+}
+BENCHMARK(BM_Fen_parseFenFromStr_dirty);
+
+static void BM_Print_board_state_to_fen(benchmark::State& state) {
+  const std::vector<BenchmarkCorpus::Position>& positions = BenchmarkCorpus::positions();
+  uint64_t idx = 0;
+
+  AllocationCounter::Scope allocations;
+  for (auto _ : state) {
+    const BenchmarkCorpus::Position& position = positions[idx];
+    benchmark::DoNotOptimize(Print::board_state_to_fen(position.board.grid, position.board.extra,
+                                                       position.current_player, position.current_turn,
+                                                       position.amount_half_moves));
+    if (++idx == positions.size()) idx = 0;
+  }
+  allocations.report(state);
+  state.SetItemsProcessed(static_cast<int64_t>(state.iterations()));
+}
+BENCHMARK(BM_Print_board_state_to_fen);
+
+static void BM_Print_write_fen(benchmark::State& state) {
+  const std::vector<BenchmarkCorpus::Position>& positions = BenchmarkCorpus::positions();
+  uint64_t idx = 0;
+  Print::FenBuffer buffer;
+
+  AllocationCounter::Scope allocations;
+  for (auto _ : state) {
+    const BenchmarkCorpus::Position& position = positions[idx];
+    benchmark::DoNotOptimize(Print::write_fen(buffer, position.board.grid, position.board.extra,
+                                              position.current_player, position.current_turn,
+                                              position.amount_half_moves));
+    if (++idx == positions.size()) idx = 0;
+  }
+  allocations.report(state);
+  state.SetItemsProcessed(static_cast<int64_t>(state.iterations()));
+}
+BENCHMARK(BM_Print_write_fen);
+
+static void BM_PackedPosition_pack(benchmark::State& state) {
+  const std::vector<BenchmarkCorpus::Position>& positions = BenchmarkCorpus::positions();
+  uint64_t idx = 0;
+
+  AllocationCounter::Scope allocations;
+  for (auto _ : state) {
+    const BenchmarkCorpus::Position& position = positions[idx];
+    benchmark::DoNotOptimize(PackedPosition::pack(position.board, position.current_player, position.current_turn,
+                                                  position.amount_half_moves));
+    if (++idx == positions.size()) idx = 0;
+  }
+  allocations.report(state);
+  state.SetItemsProcessed(static_cast<int64_t>(state.iterations()));
+}
+BENCHMARK(BM_PackedPosition_pack);
+
+static void BM_PackedPosition_toBoard(benchmark::State& state) {
+  std::vector<PackedPosition> packed_positions;
+  for (const BenchmarkCorpus::Position& position : BenchmarkCorpus::positions()) {
+    packed_positions.push_back(PackedPosition::pack(position.board, position.current_player, position.current_turn,
+                                                    position.amount_half_moves));
+  }
+  uint64_t idx = 0;
+
+  AllocationCounter::Scope allocations;
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(packed_positions[idx].toBoard());
+    if (++idx == packed_positions.size()) idx = 0;
+  }
+  allocations.report(state);
+  state.SetItemsProcessed(static_cast<int64_t>(state.iterations()));
+}
+BENCHMARK(BM_PackedPosition_toBoard);
+
+// loads the whole corpus from a file of packed positions per iteration, to compare with parsing it as FEN lines
+static void BM_Packed_Reader_readAll(benchmark::State& state) {
+  std::ostringstream packed_file;
+  {
+    Packed::Writer writer = Packed::Writer(packed_file);
+    for (const BenchmarkCorpus::Position& position : BenchmarkCorpus::positions()) {
+      writer.write(PackedPosition::pack(position.board, position.current_player, position.current_turn,
+                                        position.amount_half_moves));
+    }
+  }
+  const std::string data = packed_file.str();
+  std::vector<PackedPosition> positions;
+
+  for (auto _ : state) {
+    positions.clear();
+    Packed::Reader reader = Packed::Reader(data);
+    reader.readAll(positions);
+    benchmark::DoNotOptimize(positions.data());
+  }
+  state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * positions.size()));
+  state.SetBytesProcessed(static_cast<int64_t>(state.iterations() * data.size()));
+}
+BENCHMARK(BM_Packed_Reader_readAll);
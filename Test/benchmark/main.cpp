@@ -0,0 +1,12 @@
+//
+// Created by timap on 18.10.2026.
+//
+#include <benchmark/benchmark.h>
+
+int main(int argc, char **argv) {
+  ::benchmark::Initialize(&argc, argv);
+  if (::benchmark::ReportUnrecognizedArguments(argc, argv)) return 1;
+  ::benchmark::RunSpecifiedBenchmarks();
+  ::benchmark::Shutdown();
+  return 0;
+}
@@ -0,0 +1,88 @@
+//
+// Created by timap on 18.10.2026.
+//
+#include <gtest/gtest.h>
+
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "../../src/Bot/Batch/Batch.h"
+#include "../../src/IO/Parser/EpdParsing.h"
+
+/**
+ * @brief splits the output of a batch into its lines
+ */
+static std::vector<std::string> outputLines(const std::string& output) {
+  std::vector<std::string> lines;
+  std::istringstream stream(output);
+  std::string line;
+  while (std::getline(stream, line)) lines.push_back(line);
+  return lines;
+}
+
+TEST(BatchTest, ParsesEpdAndFenLines) {
+  const EpdRecord epd = Epd::parseLine(
+      "r1bqkbnr/pppp1ppp/2n5/4p3/4P3/5N2/PPPP1PPP/RNBQKB1R w KQkq - bm Bb5 Bc4; id \"test; 1\"; hmvc 2; fmvn 3;");
+  ASSERT_EQ(epd.fen, "r1bqkbnr/pppp1ppp/2n5/4p3/4P3/5N2/PPPP1PPP/RNBQKB1R w KQkq - 2 3");
+  ASSERT_EQ(epd.operations.size(), 4);
+  ASSERT_EQ(*epd.findOperand("bm"), "Bb5 Bc4");
+  ASSERT_EQ(*epd.findOperand("id"), "test; 1");
+  ASSERT_EQ(epd.findOperand("am"), nullptr);
+
+  const EpdRecord fen = Epd::parseLine("6k1/5ppp/8/8/8/8/5PPP/R5K1 w - - 4 30");
+  ASSERT_EQ(fen.fen, "6k1/5ppp/8/8/8/8/5PPP/R5K1 w - - 4 30");
+  ASSERT_TRUE(fen.operations.empty());
+
+  ASSERT_EQ(Epd::parseLine("6k1/5ppp/8/8/8/8/5PPP/R5K1 w - -").fen, "6k1/5ppp/8/8/8/8/5PPP/R5K1 w - - 0 1");
+  ASSERT_THROW(Epd::parseLine("6k1/5ppp/8/8/8/8/5PPP/R5K1 w"), MissingDataInFen);
+  ASSERT_TRUE(Epd::isSkippableLine("  # comment"));
+  ASSERT_TRUE(Epd::isSkippableLine(""));
+}
+
+TEST(BatchTest, ResultsKeepTheInputOrder) {
+  std::ostringstream input;
+  for (int i = 0; i < 20; ++i) {
+    input << "6k1/5ppp/8/8/8/8/5PPP/R5K1 w - - id \"mate" << i << "\";\n";
+    input << "# a comment\n\n";
+    input << "rnbqkbnr/pppppppp/8/8/8/8/PPPPPPPP/RNBQKBNR w KQkq - 0 1\n";
+  }
+  input << "not a fen\n";
+
+  Batch::BatchOptions options = Batch::BatchOptions();
+  options.depth = 2;
+  options.threads = 4;
+  std::istringstream in(input.str());
+  std::ostringstream out;
+  ASSERT_EQ(Batch::runBatch(in, out, options), 41);
+
+  const std::vector<std::string> lines = outputLines(out.str());
+  ASSERT_EQ(lines.size(), 42);
+  for (int i = 0; i < 20; ++i) {
+    ASSERT_EQ(lines[1 + 2 * i].rfind("mate" + std::to_string(i) + "\ta1a8\tmate 1\t", 0), 0) << lines[1 + 2 * i];
+    // the start position is in line 4 of each block of the input
+    ASSERT_EQ(lines[2 + 2 * i].rfind(std::to_string(4 * i + 4) + '\t', 0), 0) << lines[2 + 2 * i];
+  }
+  ASSERT_EQ(lines.back().rfind("81\terror\t", 0), 0) << lines.back();
+}
+
+TEST(BatchTest, ParsesTheArguments) {
+  Batch::BatchOptions options = Batch::BatchOptions();
+  std::string input_path;
+  const char* valid[] = {"--depth", "6", "--hash", "99999999999999999999999", "--threads", "2", "one.fen"};
+  ASSERT_TRUE(Batch::parseBatchArguments(7, valid, options, input_path));
+  ASSERT_EQ(options.depth, 6);
+  ASSERT_EQ(options.hash_mb, TranspositionTable::max_size_mb);
+  ASSERT_EQ(options.threads, 2);
+  ASSERT_EQ(input_path, "one.fen");
+
+  // negative numbers, trailing characters and missing values
+  for (const std::vector<const char*>& invalid :
+       {std::vector<const char*>{"--hash", "-1", "one.fen"}, std::vector<const char*>{"--depth", "4abc"},
+        std::vector<const char*>{"--nodes", "-5"}, std::vector<const char*>{"--movetime", ""},
+        std::vector<const char*>{"--threads", " 2"}, std::vector<const char*>{"--depth"}}) {
+    options = Batch::BatchOptions();
+    ASSERT_FALSE(Batch::parseBatchArguments(static_cast<int>(invalid.size()), invalid.data(), options, input_path))
+        << invalid[0] << ' ' << invalid.back();
+  }
+}
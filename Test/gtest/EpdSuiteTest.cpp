@@ -0,0 +1,94 @@
+//
+// Created by timap on 18.10.2026.
+//
+#include <gtest/gtest.h>
+
+#include <sstream>
+#include <string>
+
+#include "../../src/Bot/Batch/EpdSuite.h"
+#include "../../src/IO/Parser/SanParsing.h"
+#include "../../src/IO/Print/Print.h"
+
+/**
+ * @brief finds the SAN move on the position and returns it in UCI notation ("" if it is not found)
+ */
+static std::string sanToUci(const std::string& fen_str, const std::string& san) {
+  const Fen fen = Fen::buildFenFromStr(fen_str);
+  const SlimOptional<Move> move = San::findMove(Board(fen), fen.current_player, san);
+  return move.has_value() ? Print::move_as_uci(move.data) : "";
+}
+
+TEST(EpdSuiteTest, FindsSanMoves) {
+  const std::string start = "rnbqkbnr/pppppppp/8/8/8/8/PPPPPPPP/RNBQKBNR w KQkq - 0 1";
+  ASSERT_EQ(sanToUci(start, "e4"), "e2e4");
+  ASSERT_EQ(sanToUci(start, "Nf3"), "g1f3");
+  ASSERT_EQ(sanToUci(start, "Nf3!?"), "g1f3");
+  ASSERT_EQ(sanToUci(start, "e5"), "");
+  ASSERT_EQ(sanToUci(start, "Bb5"), "");
+
+  // castling, check suffixes and captures
+  const std::string kiwipete = "r3k2r/p1ppqpb1/bn2pnp1/3PN3/1p2P3/2N2Q1p/PPPBBPPP/R3K2R w KQkq - 0 1";
+  ASSERT_EQ(sanToUci(kiwipete, "O-O"), "e1g1");
+  ASSERT_EQ(sanToUci(kiwipete, "0-0-0"), "e1c1");
+  ASSERT_EQ(sanToUci(kiwipete, "Bxa6"), "e2a6");
+  ASSERT_EQ(sanToUci(kiwipete, "dxe6"), "d5e6");
+  ASSERT_EQ(sanToUci(kiwipete, "Qxf6+"), "f3f6");
+
+  // disambiguation: both rooks and both knights can reach the same square
+  const std::string rooks = "6k1/8/8/8/8/8/1N2KN2/R6R w - - 0 1";
+  ASSERT_EQ(sanToUci(rooks, "Rd1"), "");
+  ASSERT_EQ(sanToUci(rooks, "Rad1"), "a1d1");
+  ASSERT_EQ(sanToUci(rooks, "Rhf1"), "h1f1");
+  ASSERT_EQ(sanToUci(rooks, "Nd3"), "");
+  ASSERT_EQ(sanToUci(rooks, "Nbd3"), "b2d3");
+  ASSERT_EQ(sanToUci(rooks, "Nf2d3"), "f2d3");
+
+  // promotion with and without '='
+  const std::string promotion = "1n4k1/P7/8/8/8/8/8/4K3 w - - 0 1";
+  ASSERT_EQ(sanToUci(promotion, "a8=Q"), "a7a8q");
+  ASSERT_EQ(sanToUci(promotion, "axb8N+"), "a7b8n");
+  ASSERT_EQ(sanToUci(promotion, "a8"), "");
+}
+
+TEST(EpdSuiteTest, CountsSolvedPositions) {
+  std::istringstream in(
+      "# mate in 1 for white, a legal but wrong bm, an am that the search avoids and a broken line\n"
+      "6k1/5ppp/8/8/8/8/5PPP/R5K1 w - - bm Ra8#; id \"mate\";\n"
+      "6k1/5ppp/8/8/8/8/5PPP/R5K1 w - - bm h3; id \"wrong\";\n"
+      "6k1/5ppp/8/8/8/8/5PPP/R5K1 w - - am Kf1 Kh1; id \"avoid\";\n"
+      "6k1/5ppp/8/8/8/8/5PPP/R5K1 w - - bm Ra7 Ra9; id \"illegal\";\n");
+  Batch::SuiteOptions options = Batch::SuiteOptions();
+  options.depth = 3;
+  options.threads = 2;
+  std::ostringstream out;
+  const Batch::SuiteSummary summary = Batch::runEpdSuite(in, out, options);
+
+  ASSERT_EQ(summary.positions, 4);
+  ASSERT_EQ(summary.solved, 2);
+  ASSERT_EQ(summary.errors, 1);
+  const std::string output = out.str();
+  ASSERT_NE(output.find("mate\tsolved\ta1a8\tbm Ra8#\t"), std::string::npos) << output;
+  ASSERT_NE(output.find("wrong\tfailed\ta1a8\tbm h3\n"), std::string::npos) << output;
+  ASSERT_NE(output.find("avoid\tsolved\ta1a8\tam Kf1 Kh1\t"), std::string::npos) << output;
+  ASSERT_NE(output.find("illegal\terror\tillegal bm move Ra9\n"), std::string::npos) << output;
+  ASSERT_NE(output.find("solved 2 of 3 positions (66.7%), 1 positions with errors\n"), std::string::npos) << output;
+}
+
+TEST(EpdSuiteTest, ParsesTheArgumentsLikeTheBatchMode) {
+  Batch::SuiteOptions options = Batch::SuiteOptions();
+  std::string input_path;
+  const char* valid[] = {"--movetime", "250", "--hash", "8", "suite.epd"};
+  ASSERT_TRUE(Batch::parseSuiteArguments(5, valid, options, input_path));
+  ASSERT_EQ(options.movetime, 250);
+  ASSERT_EQ(options.hash_mb, 8);
+  ASSERT_EQ(input_path, "suite.epd");
+
+  const char* negative_hash[] = {"--hash", "-1", "suite.epd"};
+  ASSERT_FALSE(Batch::parseSuiteArguments(3, negative_hash, options, input_path));
+  const char* trailing[] = {"--depth", "4abc"};
+  ASSERT_FALSE(Batch::parseSuiteArguments(2, trailing, options, input_path));
+  // only in the batch mode
+  const char* eval[] = {"--eval"};
+  ASSERT_FALSE(Batch::parseSuiteArguments(1, eval, options, input_path));
+}
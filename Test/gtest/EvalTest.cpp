@@ -3,7 +3,19 @@
 //
 #include <gtest/gtest.h>
 
+#include <cstdint>
+#include <fstream>
+#include <string>
+#include <vector>
+
+#include "../../src/Bot/Evaluation/AttackMaps.h"
+#include "../../src/Bot/Evaluation/EvalCache.h"
+#include "../../src/Bot/Evaluation/eval_constants.h"
+#include "../../src/Bot/Evaluation/pesto_tables.h"
+#include "../../src/Bot/MinMax/MinMax.h"
 #include "../../src/ChessGame.h"
+#include "../../src/IO/Binary/PackedPosition.h"
+#include "../Main_Folder_Path_For_Testing.h"
 
 int getEval(const std::string_view& fen_str) {
   Fen fen = Fen();
@@ -29,3 +41,272 @@ TEST(EvalTest, not_completely_wrong_board_evaluation) {
   ASSERT_LT(200, getEval("k7/7P/8/8/8/7p/8/K7 w - - 0 1"));
   ASSERT_LT(200, getEval("rnbqkbnr/8/8/8/8/8/PPPPPPPP/RNBQKBNR w KQkq - 0 1"));
 }
+
+/**
+ * @param fen_str a legal FEN
+ * @return the pawn structure score of the FEN
+ */
+static PawnScore getPawnScore(const std::string_view& fen_str) {
+  return evaluatePawnStructure(Board(Fen::buildFenFromStr(fen_str)));
+}
+
+TEST(EvalTest, pawn_structure) {
+  // symmetric pawns cancel each other out
+  const PawnScore start = getPawnScore("rnbqkbnr/pppppppp/8/8/8/8/PPPPPPPP/RNBQKBNR w KQkq - 0 1");
+  ASSERT_EQ(start.mg, 0);
+  ASSERT_EQ(start.eg, 0);
+
+  // doubled and isolated pawns are worse than connected ones
+  const PawnScore connected = getPawnScore("4k3/pp6/8/8/8/8/PP6/4K3 w - - 0 1");
+  const PawnScore doubled = getPawnScore("4k3/pp6/8/8/8/P7/P7/4K3 w - - 0 1");
+  const PawnScore isolated = getPawnScore("4k3/pp6/8/8/8/8/P1P5/4K3 w - - 0 1");
+  ASSERT_LT(doubled.eg, connected.eg);
+  ASSERT_LT(isolated.eg, connected.eg);
+
+  // a passed pawn is better the further it is
+  const PawnScore passed_far = getPawnScore("4k3/1P6/8/8/8/8/8/4K3 w - - 0 1");
+  const PawnScore passed_near = getPawnScore("4k3/8/8/8/8/1P6/8/4K3 w - - 0 1");
+  const PawnScore blocked = getPawnScore("4k3/2p5/8/8/8/1P6/8/4K3 w - - 0 1");
+  ASSERT_GT(passed_far.eg, passed_near.eg);
+  ASSERT_GT(passed_far.eg, 0);
+  // neither of the two isolated pawns is passed, as they are in front of each other on neighbouring files
+  ASSERT_EQ(blocked.eg, 0);
+
+  // mirrored boards get the negated score
+  const PawnScore mirrored = getPawnScore("4k3/8/8/8/8/8/1p6/4K3 w - - 0 1");
+  ASSERT_EQ(mirrored.mg, -passed_far.mg);
+  ASSERT_EQ(mirrored.eg, -passed_far.eg);
+}
+
+TEST(EvalTest, pawn_hash_table_gives_the_same_score) {
+  std::ifstream file(main_folder_path + "/Test/gtest/datasets/ParsingTestData.txt");
+  ASSERT_TRUE(file.good()) << missing_main_folder_path_error;
+  PawnHashTable pawn_table = PawnHashTable(1);
+  std::string line;
+  while (std::getline(file, line)) {
+    // the Fen only points into the string, so the string has to stay alive
+    const std::string fen_str = line.substr(0, line.find(';'));
+    const Fen fen = Fen::buildFenFromStr(fen_str);
+    const Board board = Board(fen);
+    // twice, so that the second lookup is always a hit
+    ASSERT_EQ(evaluateBoard(board, fen.current_player, pawn_table), evaluateBoard(board, fen.current_player));
+    ASSERT_EQ(evaluateBoard(board, fen.current_player, pawn_table), evaluateBoard(board, fen.current_player));
+  }
+  ASSERT_GE(pawn_table.hits() * 2, pawn_table.probes());
+}
+
+TEST(EvalTest, lazy_evaluation_gives_bounds_outside_the_window) {
+  std::ifstream file(main_folder_path + "/Test/gtest/datasets/ParsingTestData.txt");
+  ASSERT_TRUE(file.good()) << missing_main_folder_path_error;
+  PawnHashTable pawn_table = PawnHashTable(1);
+  uint64_t amount_lazy = 0;
+  std::string line;
+  while (std::getline(file, line)) {
+    // the Fen only points into the string, so the string has to stay alive
+    const std::string fen_str = line.substr(0, line.find(';'));
+    const Fen fen = Fen::buildFenFromStr(fen_str);
+    const Board board = Board(fen);
+    const int score = evaluateBoard(board, fen.current_player);
+
+    const WindowedEval inside = evaluateBoard(board, fen.current_player, pawn_table, score - 1, score + 1);
+    ASSERT_FALSE(inside.lazy) << fen_str;
+    ASSERT_EQ(inside.score, score) << fen_str;
+
+    // windows far above and below the score, from a pawn to a queen away
+    for (const int distance : {100 * 24, 300 * 24, 900 * 24}) {
+      const WindowedEval below = evaluateBoard(board, fen.current_player, pawn_table, score + distance, INT32_MAX);
+      if (below.lazy) {
+        amount_lazy++;
+        ASSERT_LE(below.score, score + distance) << fen_str;
+        ASSERT_GE(below.score, score) << fen_str;
+      } else {
+        ASSERT_EQ(below.score, score) << fen_str;
+      }
+      const WindowedEval above = evaluateBoard(board, fen.current_player, pawn_table, INT32_MIN, score - distance);
+      if (above.lazy) {
+        amount_lazy++;
+        ASSERT_GE(above.score, score - distance) << fen_str;
+        ASSERT_LE(above.score, score) << fen_str;
+      } else {
+        ASSERT_EQ(above.score, score) << fen_str;
+      }
+    }
+  }
+  ASSERT_GT(amount_lazy, 0);
+}
+
+TEST(EvalTest, batch_evaluation_gives_the_same_scores) {
+  std::ifstream file(main_folder_path + "/Test/gtest/datasets/ParsingTestData.txt");
+  ASSERT_TRUE(file.good()) << missing_main_folder_path_error;
+  std::vector<Board> boards;
+  std::vector<Team::Team> players;
+  std::vector<PackedPosition> packed;
+  std::vector<int> expected;
+  std::string line;
+  while (std::getline(file, line)) {
+    // the Fen only points into the string, so the string has to stay alive
+    const std::string fen_str = line.substr(0, line.find(';'));
+    const Fen fen = Fen::buildFenFromStr(fen_str);
+    boards.emplace_back(fen);
+    players.push_back(fen.current_player);
+    packed.push_back(PackedPosition::pack(fen));
+    expected.push_back(evaluateBoard(boards.back(), fen.current_player));
+  }
+  ASSERT_GT(boards.size(), 8);
+
+  // also only a part of the boards
+  PawnHashTable pawn_table = PawnHashTable(1);
+  for (const uint64_t amount : {uint64_t(1), uint64_t(7), uint64_t(9), boards.size()}) {
+    std::vector<int> scores(amount);
+    evaluateBoards(boards.data(), players.data(), amount, scores.data(), pawn_table);
+    for (uint64_t i = 0; i < amount; ++i) ASSERT_EQ(scores[i], expected[i]) << i;
+  }
+  std::vector<int> packed_scores(packed.size());
+  Packed::evaluatePositions(packed.data(), packed.size(), packed_scores.data(), pawn_table);
+  ASSERT_EQ(packed_scores, expected);
+}
+
+TEST(EvalTest, batch_material_matches_the_coefficients) {
+  std::ifstream file(main_folder_path + "/Test/gtest/datasets/ParsingTestData.txt");
+  ASSERT_TRUE(file.good()) << missing_main_folder_path_error;
+  std::vector<Board> boards;
+  std::string line;
+  while (std::getline(file, line)) boards.emplace_back(Fen::buildFenFromStr(line.substr(0, line.find(';'))));
+
+  std::vector<int> scores(boards.size());
+  std::vector<int> phases(boards.size());
+  evaluateMaterial(boards.data(), boards.size(), scores.data(), phases.data());
+  for (uint64_t i = 0; i < boards.size(); ++i) {
+    // the same sums from the coefficients of the material and the PeSTO tables
+    const EvalCoefficients coefficients = evaluationCoefficients(boards[i]);
+    int mg = 0;
+    int eg = 0;
+    for (int type = 1; type < PIECETYPE_AMOUNT; ++type) {
+      mg += coefficients.material[type] * mg_value[type];
+      eg += coefficients.material[type] * eg_value[type];
+      for (int pos = 0; pos < BOARD_SIZE; ++pos) {
+        mg += coefficients.pst[type][pos] * mg_pesto_table[type][pos];
+        eg += coefficients.pst[type][pos] * eg_pesto_table[type][pos];
+      }
+    }
+    ASSERT_EQ(phases[i], coefficients.mid_game_phase) << i;
+    ASSERT_EQ(scores[i], mg * phases[i] + eg * (24 - phases[i])) << i;
+  }
+}
+
+TEST(EvalTest, evaluation_trace_sums_up_to_the_score) {
+  std::ifstream file(main_folder_path + "/Test/gtest/datasets/ParsingTestData.txt");
+  ASSERT_TRUE(file.good()) << missing_main_folder_path_error;
+  std::string line;
+  while (std::getline(file, line)) {
+    const std::string fen_str = line.substr(0, line.find(';'));
+    const Fen fen = Fen::buildFenFromStr(fen_str);
+    const Board board = Board(fen);
+    const EvalTrace trace = evaluationTrace(board, fen.current_player);
+    ASSERT_EQ(trace.score, evaluateBoard(board, fen.current_player)) << fen_str;
+    if (trace.from_bitbase) continue;
+
+    int sum = 0;
+    for (int term = 0; term < EVAL_TERM_AMOUNT; ++term) sum += trace.termScore(static_cast<EvalTerm::EvalTerm>(term));
+    ASSERT_EQ(sum, trace.score) << fen_str;
+
+    // the trace agrees with the coefficients of the tuner term by term
+    const EvalCoefficients coefficients = evaluationCoefficients(board);
+    ASSERT_EQ(trace.mid_game_phase, coefficients.mid_game_phase) << fen_str;
+    ASSERT_EQ(trace.termScore(EvalTerm::KING_DANGER), coefficients.fixed) << fen_str;
+    ASSERT_EQ(trace.mg[Team::WHITE][EvalTerm::PROTECTED_KING] - trace.mg[Team::BLACK][EvalTerm::PROTECTED_KING],
+              coefficients.protected_king * protected_king_factor)
+        << fen_str;
+    const PawnScore pawns = evaluatePawnStructure(board);
+    ASSERT_EQ(trace.mg[Team::WHITE][EvalTerm::PAWN_STRUCTURE] - trace.mg[Team::BLACK][EvalTerm::PAWN_STRUCTURE],
+              pawns.mg)
+        << fen_str;
+    ASSERT_EQ(trace.eg[Team::WHITE][EvalTerm::PAWN_STRUCTURE] - trace.eg[Team::BLACK][EvalTerm::PAWN_STRUCTURE],
+              pawns.eg)
+        << fen_str;
+  }
+
+  // both teams are the same in the starting position
+  const Board start_board = Board(Fen::buildFenFromStr("rnbqkbnr/pppppppp/8/8/8/8/PPPPPPPP/RNBQKBNR w KQkq - 0 1"));
+  const EvalTrace start = evaluationTrace(start_board, Team::WHITE);
+  ASSERT_EQ(start.mid_game_phase, 24);
+  for (int term = 0; term < EVAL_TERM_AMOUNT; ++term) {
+    ASSERT_EQ(start.mg[Team::WHITE][term], start.mg[Team::BLACK][term]) << term;
+    ASSERT_EQ(start.eg[Team::WHITE][term], start.eg[Team::BLACK][term]) << term;
+  }
+  ASSERT_GT(start.mg[Team::WHITE][EvalTerm::MATERIAL], 0);
+}
+
+TEST(EvalTest, eval_cache) {
+  EvalCache cache = EvalCache(1);
+  ASSERT_EQ(cache.capacity(), 128);
+  int score = 0;
+  ASSERT_FALSE(cache.probe(0x123456789abcdef0, score));
+  cache.store(0x123456789abcdef0, -4321);
+  ASSERT_TRUE(cache.probe(0x123456789abcdef0, score));
+  ASSERT_EQ(score, -4321);
+  // same slot, different board: replaces the old entry
+  cache.store(0x923456789abcdef0, 77);
+  ASSERT_FALSE(cache.probe(0x123456789abcdef0, score));
+  ASSERT_TRUE(cache.probe(0x923456789abcdef0, score));
+  ASSERT_EQ(score, 77);
+  ASSERT_EQ(cache.probes(), 4);
+  ASSERT_EQ(cache.hits(), 2);
+  cache.clear();
+  ASSERT_FALSE(cache.probe(0x923456789abcdef0, score));
+
+  // a cache of size 0 never finds anything
+  EvalCache no_cache = EvalCache(0);
+  no_cache.store(0x923456789abcdef0, 77);
+  ASSERT_FALSE(no_cache.probe(0x923456789abcdef0, score));
+  ASSERT_EQ(no_cache.probes(), 0);
+}
+
+TEST(EvalTest, search_with_eval_cache_finds_the_same_result) {
+  const Fen fen = Fen::buildFenFromStr("r1bqkb1r/pppp1ppp/2n2n2/4p3/2B1P3/5N2/PPPP1PPP/RNBQK2R w KQkq - 4 4");
+  const Board board = Board(fen);
+
+  setEvalCacheSize(0);
+  SearchStats uncached_stats = SearchStats();
+  const SearchResult uncached = MinMaxSearch(board, 4, fen.current_player, uncached_stats, nullptr);
+  ASSERT_EQ(uncached_stats.eval_cache_probes, 0);
+
+  setEvalCacheSize(EvalCache::default_size_kb);
+  SearchStats cached_stats = SearchStats();
+  const SearchResult cached = MinMaxSearch(board, 4, fen.current_player, cached_stats, nullptr);
+  ASSERT_EQ(cached.score, uncached.score);
+  ASSERT_EQ(cached.best_move.data, uncached.best_move.data);
+  ASSERT_EQ(cached_stats.nodes, uncached_stats.nodes);
+  ASSERT_GT(cached_stats.eval_cache_hits, 0);
+  ASSERT_LE(cached_stats.eval_cache_hits, cached_stats.eval_cache_probes);
+}
+
+TEST(EvalTest, attack_maps) {
+  const Board start = Board(Fen::buildFenFromStr("rnbqkbnr/pppppppp/8/8/8/8/PPPPPPPP/RNBQKBNR w KQkq - 0 1"));
+  const AttackMaps start_maps = AttackMaps::build(start);
+  // the pawns attack the third and sixth row
+  ASSERT_EQ(start_maps.attacked_by[Team::WHITE][PieceType::PAWN], 0x0000FF0000000000ULL);
+  ASSERT_EQ(start_maps.attacked_by[Team::BLACK][PieceType::PAWN], 0x0000000000FF0000ULL);
+  // only the knights can move, each to two squares
+  for (Team::Team team : {Team::BLACK, Team::WHITE}) {
+    ASSERT_EQ(start_maps.mobility[team][PieceType::KNIGHT], 4);
+    ASSERT_EQ(start_maps.mobility[team][PieceType::BISHOP], 0);
+    ASSERT_EQ(start_maps.mobility[team][PieceType::CASTLE], 0);
+    ASSERT_EQ(start_maps.mobility[team][PieceType::QUEEN], 0);
+  }
+
+  // the queen on b6 attacks a7, b7 and b8 next to the king on a8
+  const Board attacked = Board(Fen::buildFenFromStr("k7/8/1Q6/8/8/8/8/K7 w - - 0 1"));
+  const AttackMaps attacked_maps = AttackMaps::build(attacked);
+  // (a8, b8, a7 and b7)
+  ASSERT_EQ(attacked_maps.king_zone[Team::BLACK], 0x0303ULL);
+  const uint64_t queen_attacks = attacked_maps.attacked_by[Team::WHITE][PieceType::QUEEN];
+  ASSERT_EQ(amountSquares(queen_attacks & attacked_maps.king_zone[Team::BLACK]), 3);
+
+  // mobility and king danger are the same for both teams on mirrored boards
+  ASSERT_EQ(getEval("r1bqkbnr/pppp1ppp/2n5/4p3/4P3/5N2/PPPP1PPP/RNBQKB1R w KQkq - 2 3"),
+            -getEval("rnbqkb1r/pppp1ppp/5n2/4p3/4P3/2N5/PPPP1PPP/R1BQKBNR b KQkq - 2 3"));
+  ASSERT_EQ(getEval("k7/8/1Q6/8/8/8/8/K7 w - - 0 1"), -getEval("k7/8/8/8/8/1q6/8/K7 w - - 0 1"));
+  // a queen next to the king is worth more than one far away from it
+  ASSERT_LT(getEval("k7/8/8/8/8/8/8/K6Q w - - 0 1"), getEval("k7/8/1Q6/8/8/8/8/K7 w - - 0 1"));
+}
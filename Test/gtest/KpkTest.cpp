@@ -0,0 +1,102 @@
+//
+// Created by timap on 18.10.2026.
+//
+#include <gtest/gtest.h>
+
+#include <string>
+
+#include "../../src/Bot/Evaluation/Evaluate.h"
+#include "../../src/Bot/Evaluation/KpkBitbase.h"
+#include "../../src/Bot/MinMax/MinMax.h"
+#include "../../src/IO/Parser/FenParsing.h"
+
+/**
+ * @param fen_str a legal FEN with a king and a pawn against a king
+ * @return whether the team with the pawn wins
+ */
+static bool isWin(const std::string& fen_str) {
+  const Fen fen = Fen::buildFenFromStr(fen_str);
+  const Board board = Board(fen);
+  EXPECT_TRUE(Kpk::isKpk(board)) << fen_str;
+  return Kpk::isWin(board, fen.current_player);
+}
+
+/**
+ * @return a FEN with the given pieces (the squares use 0 = a8)
+ */
+static std::string kpkFen(int white_king, int black_king, int pawn, Team::Team pawn_team, Team::Team player) {
+  std::string grid(BOARD_SIZE, '1');
+  grid[white_king] = 'K';
+  grid[black_king] = 'k';
+  grid[pawn] = pawn_team == Team::WHITE ? 'P' : 'p';
+  std::string fen_str;
+  for (int row = 0; row < 8; ++row) {
+    fen_str += grid.substr(row * 8, 8);
+    if (row < 7) fen_str += '/';
+  }
+  return fen_str + (player == Team::WHITE ? " w - - 0 1" : " b - - 0 1");
+}
+
+TEST(KpkTest, known_results) {
+  // the pawn promotes and the queen is safe
+  ASSERT_TRUE(isWin("8/4P3/8/8/8/k7/8/K7 w - - 0 1"));
+  // the defending king is outside of the square of the pawn
+  ASSERT_TRUE(isWin("8/8/8/8/8/k7/7P/7K w - - 0 1"));
+  ASSERT_TRUE(isWin("7k/8/8/8/8/K7/p7/8 b - - 0 1"));
+  // the pawn gets captured
+  ASSERT_FALSE(isWin("8/8/8/8/8/8/3kP3/7K b - - 0 1"));
+  // the defending king stands on the promotion square of a rook pawn
+  ASSERT_FALSE(isWin("k7/8/8/8/8/8/P7/K7 w - - 0 1"));
+  ASSERT_FALSE(isWin("k7/8/8/8/8/8/P7/K7 b - - 0 1"));
+  // the king on the 6th row in front of its pawn always wins
+  ASSERT_TRUE(isWin("4k3/8/4K3/4P3/8/8/8/8 b - - 0 1"));
+  ASSERT_TRUE(isWin("4k3/8/4K3/4P3/8/8/8/8 w - - 0 1"));
+  // with the king behind its pawn on the 6th row the defending king holds the promotion square (or is stalemated)
+  ASSERT_FALSE(isWin("4k3/8/4P3/4K3/8/8/8/8 b - - 0 1"));
+  ASSERT_FALSE(isWin("4k3/8/4P3/4K3/8/8/8/8 w - - 0 1"));
+  // the key squares: a king two rows in front of its pawn wins
+  ASSERT_TRUE(isWin("8/8/3k4/8/4K3/8/4P3/8 b - - 0 1"));
+
+  // the scores of the evaluation
+  const Board won = Board(Fen::buildFenFromStr("8/8/8/8/8/k7/7P/7K w - - 0 1"));
+  ASSERT_GE(evaluateBoard(won, Team::WHITE), Kpk::win_score);
+  const Board drawn = Board(Fen::buildFenFromStr("k7/8/8/8/8/8/P7/K7 w - - 0 1"));
+  ASSERT_EQ(evaluateBoard(drawn, Team::WHITE), 0);
+  const Board not_kpk = Board(Fen::buildFenFromStr("k7/8/8/8/8/8/PP6/K7 w - - 0 1"));
+  ASSERT_FALSE(Kpk::isKpk(not_kpk));
+}
+
+TEST(KpkTest, symmetric_for_both_teams_and_mirrored_files) {
+  for (int pawn : {14, 25, 36, 52}) {
+    for (int white_king = 0; white_king < BOARD_SIZE; ++white_king) {
+      for (int black_king = 0; black_king < BOARD_SIZE; ++black_king) {
+        if (white_king == pawn || black_king == pawn || white_king == black_king) continue;
+        for (Team::Team player : {Team::WHITE, Team::BLACK}) {
+          const bool win = isWin(kpkFen(white_king, black_king, pawn, Team::WHITE, player));
+          // the same board with the colors swapped (and the rows flipped)
+          ASSERT_EQ(win, isWin(kpkFen(black_king ^ 56, white_king ^ 56, pawn ^ 56, Team::BLACK,
+                                      Team::getEnemyTeam(player))));
+          // the same board with the files mirrored
+          ASSERT_EQ(win, isWin(kpkFen(white_king ^ 7, black_king ^ 7, pawn ^ 7, Team::WHITE, player)));
+        }
+      }
+    }
+  }
+}
+
+TEST(KpkTest, search_resolves_kpk_instantly) {
+  const Fen fen = Fen::buildFenFromStr("8/8/8/8/8/k7/7P/7K w - - 0 1");
+  const Board board = Board(fen);
+  SearchStats stats = SearchStats();
+  const SearchResult result = MinMaxSearch(board, 8, fen.current_player, stats, nullptr);
+  ASSERT_TRUE(result.best_move.has_value());
+  ASSERT_GE(result.score, Kpk::win_score);
+  // only the root and its children, as every child is looked up in the bitbase
+  ASSERT_LT(stats.nodes, 20);
+
+  // a promotion leaves the bitbase and is still preferred over keeping the pawn
+  const Fen promotion_fen = Fen::buildFenFromStr("8/4P3/8/8/8/k7/8/K7 w - - 0 1");
+  const SearchResult promotion = MinMaxSearch(Board(promotion_fen), 2, Team::WHITE, stats, nullptr);
+  ASSERT_TRUE(promotion.best_move.has_value());
+  ASSERT_EQ(promotion.best_move.data.to, 4);
+}
@@ -0,0 +1,92 @@
+//
+// Created by timap on 18.10.2026.
+//
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "../../src/Board/MakeMovePolicy.h"
+#include "../../src/Bot/MinMax/MinMax.h"
+#include "../../src/Perft/Perft.h"
+#include "../Main_Folder_Path_For_Testing.h"
+
+#define GARBAGE_DATA 3
+#define MAX_POLICY_PERFT 3
+#define POLICY_MINMAX_DEPTH 3
+
+// the Fen only holds views into the fen string, so the string itself is kept around
+struct PerftLine {
+  std::string fen_str;
+  std::vector<uint64_t> perft_data;
+};
+
+static std::vector<PerftLine> readPerftLines() {
+  std::vector<PerftLine> lines;
+  std::ifstream file(main_folder_path + "/Test/gtest/datasets/perft.txt");
+  EXPECT_TRUE(file.good()) << missing_main_folder_path_error;
+  std::string line;
+  while (std::getline(file, line)) {
+    std::istringstream line_stream(line);
+    std::string fen_str;
+    std::getline(line_stream, fen_str, ';');
+
+    PerftLine perft_line = {fen_str, {0}};
+    std::string perft_str;
+    while (std::getline(line_stream, perft_str, ';')) {
+      perft_line.perft_data.push_back(std::stoi(perft_str.substr(GARBAGE_DATA)));
+    }
+    lines.push_back(perft_line);
+  }
+  return lines;
+}
+
+template <class Policy>
+static void checkPerftWithPolicy() {
+  const std::vector<PerftLine> lines = readPerftLines();
+  ASSERT_FALSE(lines.empty());
+  for (const PerftLine& line : lines) {
+    const Fen fen = Fen::buildFenFromStr(line.fen_str);
+    const Board board = Board(fen);
+    for (uint64_t i = 1; (i < line.perft_data.size()) && (i <= MAX_POLICY_PERFT); ++i) {
+      ASSERT_EQ(Perft::perft<Policy>(board, i, fen.current_player), line.perft_data[i]) << Policy::name;
+    }
+  }
+}
+
+TEST(makeMovePolicyTest, CopyMakePerft) { checkPerftWithPolicy<MakeMovePolicy::CopyMake>(); }
+
+TEST(makeMovePolicyTest, UndoMovePerft) { checkPerftWithPolicy<MakeMovePolicy::UndoMove>(); }
+
+TEST(makeMovePolicyTest, UndoStackPerft) { checkPerftWithPolicy<MakeMovePolicy::UndoStack>(); }
+
+// undoMove restores the same pieces, but not necessarily in the same order inside Board_Positions,
+// so only the two undo based policies are guaranteed to generate the moves in the same order
+TEST(makeMovePolicyTest, UndoPoliciesSearchTheSameTree) {
+  const std::vector<PerftLine> lines = readPerftLines();
+  ASSERT_FALSE(lines.empty());
+  for (const PerftLine& line : lines) {
+    const Fen fen = Fen::buildFenFromStr(line.fen_str);
+    const Board board = Board(fen);
+    const Team::Team player = fen.current_player;
+
+    SearchStats copy_stats = SearchStats();
+    SearchStats undo_stats = SearchStats();
+    SearchStats stack_stats = SearchStats();
+    const SlimOptional<Move> copy_move =
+        MinMaxWithPolicy<MakeMovePolicy::CopyMake>(board, POLICY_MINMAX_DEPTH, player, 0, copy_stats);
+    const SlimOptional<Move> undo_move =
+        MinMaxWithPolicy<MakeMovePolicy::UndoMove>(board, POLICY_MINMAX_DEPTH, player, 0, undo_stats);
+    const SlimOptional<Move> stack_move =
+        MinMaxWithPolicy<MakeMovePolicy::UndoStack>(board, POLICY_MINMAX_DEPTH, player, 0, stack_stats);
+
+    ASSERT_EQ(undo_stats.nodes, stack_stats.nodes);
+    ASSERT_EQ(undo_move.data.from, stack_move.data.from);
+    ASSERT_EQ(undo_move.data.to, stack_move.data.to);
+    ASSERT_EQ(undo_move.data.promote.data, stack_move.data.promote.data);
+    ASSERT_EQ(copy_move.has_value(), undo_move.has_value());
+  }
+}
@@ -0,0 +1,79 @@
+//
+// Created by timap on 18.10.2026.
+//
+#include <gtest/gtest.h>
+
+#include <string>
+#include <vector>
+
+#include "../../src/Bot/MinMax/MinMax.h"
+#include "../../src/IO/Uci/Uci.h"
+#include "../../src/PossibleMoves/PossibleMoves.h"
+
+/**
+ * @brief positions without a forced mate at low depth, so that the scores of the moves can be compared directly
+ */
+static const std::string multi_pv_fens[] = {
+    "rnbqkbnr/pppppppp/8/8/8/8/PPPPPPPP/RNBQKBNR w KQkq - 0 1",
+    "r1bqkbnr/pppp1ppp/2n5/4p3/4P3/5N2/PPPP1PPP/RNBQKB1R w KQkq - 2 3",
+    "r3k2r/p1ppqpb1/bn2pnp1/3PN3/1p2P3/2N2Q1p/PPPBBPPP/R3K2R b KQkq - 0 1",
+};
+
+TEST(MultiPVTest, BestLineIsTheSingleBestMove) {
+  for (const std::string& fen_str : multi_pv_fens) {
+    const Fen fen = Fen::buildFenFromStr(fen_str);
+    const Board board = Board(fen);
+    SearchStats stats = SearchStats();
+    const SearchResult single = MinMaxSearch(board, 3, fen.current_player, stats, nullptr);
+    const std::vector<SearchResult> lines = MinMaxMultiPV(board, 3, fen.current_player, 4, stats, nullptr);
+
+    ASSERT_EQ(lines.size(), 4) << fen_str;
+    ASSERT_EQ(lines[0].score, single.score) << fen_str;
+    ASSERT_TRUE(lines[0].best_move.data == single.best_move.data) << fen_str;
+    for (uint64_t i = 1; i < lines.size(); ++i) {
+      // best first
+      if (fen.current_player == Team::WHITE) {
+        ASSERT_GE(lines[i - 1].score, lines[i].score) << fen_str;
+      } else {
+        ASSERT_LE(lines[i - 1].score, lines[i].score) << fen_str;
+      }
+      ASSERT_FALSE(lines[i].best_move.data == lines[0].best_move.data) << fen_str;
+    }
+  }
+}
+
+TEST(MultiPVTest, EveryLineHasTheExactScoreOfItsMove) {
+  constexpr int depth = 3;
+  for (const std::string& fen_str : multi_pv_fens) {
+    const Fen fen = Fen::buildFenFromStr(fen_str);
+    const Board board = Board(fen);
+    const Team::Team enemy = Team::getEnemyTeam(fen.current_player);
+    SearchStats stats = SearchStats();
+    const std::vector<SearchResult> lines = MinMaxMultiPV(board, depth, fen.current_player, 1000, stats, nullptr);
+
+    // more lines than legal moves gives every legal move
+    std::vector<Move> move_list;
+    PossibleMoves::getAllPossibleMoves(board, move_list, fen.current_player);
+    PossibleMoves::trimMovesPuttingPlayerIntoCheckmate(board, move_list, fen.current_player);
+    ASSERT_EQ(lines.size(), move_list.size()) << fen_str;
+
+    for (const SearchResult& line : lines) {
+      Board child = board;
+      child.movePiece(line.best_move.data);
+      const SearchResult alone = MinMaxSearch(child, depth - 1, enemy, stats, nullptr);
+      ASSERT_EQ(line.score, alone.score) << fen_str;
+      ASSERT_EQ(line.pv.length, alone.pv.length + 1) << fen_str;
+    }
+  }
+}
+
+TEST(MultiPVTest, UciMultiPVOption) {
+  Uci::Options options = Uci::Options();
+  Uci::parseSetOption("name MultiPV value 3", options);
+  ASSERT_EQ(options.multi_pv, 3);
+  // invalid values and unknown options are ignored
+  Uci::parseSetOption("name MultiPV value 0", options);
+  Uci::parseSetOption("name MultiPV value many", options);
+  Uci::parseSetOption("name Move Overhead value 5", options);
+  ASSERT_EQ(options.multi_pv, 3);
+}
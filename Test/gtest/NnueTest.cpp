@@ -0,0 +1,170 @@
+//
+// Created by timap on 18.10.2026.
+//
+#include <gtest/gtest.h>
+
+#include <fstream>
+#include <memory>
+#include <random>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "../../src/Bot/Evaluation/Nnue.h"
+#include "../../src/PossibleMoves/PossibleMoves.h"
+#include "../Main_Folder_Path_For_Testing.h"
+
+/**
+ * @return a network with random weights, small enough that the accumulators stay inside the activation range
+ */
+static std::unique_ptr<Nnue::Network> randomNetwork() {
+  std::mt19937 random(42);
+  const auto between = [&random](int min, int max) { return std::uniform_int_distribution<int>(min, max)(random); };
+  std::unique_ptr<Nnue::Network> network = std::make_unique<Nnue::Network>();
+  for (int16_t& bias : network->feature_bias) bias = static_cast<int16_t>(between(0, 60));
+  for (auto& weights : network->feature_weights) {
+    for (int16_t& weight : weights) weight = static_cast<int16_t>(between(-8, 8));
+  }
+  for (int32_t& bias : network->layer_1_bias) bias = between(-2000, 2000);
+  for (auto& weights : network->layer_1_weights) {
+    for (int8_t& weight : weights) weight = static_cast<int8_t>(between(-40, 40));
+  }
+  for (int32_t& bias : network->layer_2_bias) bias = between(-2000, 2000);
+  for (auto& weights : network->layer_2_weights) {
+    for (int8_t& weight : weights) weight = static_cast<int8_t>(between(-127, 127));
+  }
+  network->output_bias = between(-500, 500);
+  for (int8_t& weight : network->output_weights) weight = static_cast<int8_t>(between(-127, 127));
+  return network;
+}
+
+/**
+ * @return the positions of the parsing dataset (with castling, en passant and promotions)
+ */
+static std::vector<std::string> datasetFens() {
+  std::ifstream file(main_folder_path + "/Test/gtest/datasets/ParsingTestData.txt");
+  std::vector<std::string> fens;
+  std::string line;
+  while (std::getline(file, line)) fens.push_back(line.substr(0, line.find(';')));
+  return fens;
+}
+
+/**
+ * @brief checks that the accumulators of the stack are the same as calculating them from scratch
+ */
+static void expectSameAsRefresh(const Nnue::Network& network, const Nnue::AccumulatorStack& stack, const Board& board,
+                                const std::string& fen_str) {
+  Nnue::Accumulator refreshed;
+  for (Team::Team team : {Team::BLACK, Team::WHITE}) {
+    Nnue::refreshAccumulator(network, board, team, refreshed);
+    for (int i = 0; i < Nnue::hidden_size; ++i) {
+      ASSERT_EQ(stack.current().values[team][i], refreshed.values[team][i]) << fen_str;
+    }
+  }
+}
+
+TEST(NnueTest, network_file_round_trip) {
+  const std::unique_ptr<Nnue::Network> network = randomNetwork();
+  std::stringstream file;
+  ASSERT_TRUE(Nnue::writeNetwork(file, *network));
+  const std::unique_ptr<Nnue::Network> read = Nnue::readNetwork(file);
+  ASSERT_NE(read, nullptr);
+  const Board board = Board();
+  ASSERT_EQ(Nnue::evaluate(*read, board, Team::WHITE), Nnue::evaluate(*network, board, Team::WHITE));
+
+  // a file that is cut off or does not start with the magic is rejected
+  const std::string content = file.str();
+  std::stringstream cut_off(content.substr(0, content.size() - 1));
+  ASSERT_EQ(Nnue::readNetwork(cut_off), nullptr);
+  std::stringstream wrong_magic("XNUE" + content.substr(4));
+  ASSERT_EQ(Nnue::readNetwork(wrong_magic), nullptr);
+}
+
+/**
+ * @brief counts which kinds of moves the two ply trees contain
+ */
+struct MoveKinds {
+  int castlings = 0;
+  int en_passants = 0;
+  int promotions = 0;
+  int king_moves = 0;
+
+  /**
+   * @param move a move of the tree
+   */
+  void add(Move move) {
+    castlings += move.specialMove.data == SpecialMove::CastleKingSide ||
+                 move.specialMove.data == SpecialMove::CastleQueenSide;
+    en_passants += move.specialMove.data == SpecialMove::en_Passant;
+    promotions += move.promote.has_value();
+    king_moves += move.piece.type == PieceType::KING;
+  }
+};
+
+TEST(NnueTest, incremental_accumulators_equal_refresh) {
+  const std::unique_ptr<Nnue::Network> network = randomNetwork();
+  const std::vector<std::string> fens = datasetFens();
+  ASSERT_FALSE(fens.empty()) << missing_main_folder_path_error;
+  Nnue::AccumulatorStack stack;
+  MoveKinds kinds;
+
+  // every 100th position is enough, a two ply tree over the whole dataset takes about a minute
+  for (size_t idx = 0; idx < fens.size(); idx += 100) {
+    const std::string& fen_str = fens[idx];
+    const Fen fen = Fen::buildFenFromStr(fen_str);
+    const Board board = Board(fen);
+    stack.reset(*network, board);
+
+    // two plies deep, so that updates also start from updated accumulators
+    std::vector<Move> moves;
+    PossibleMoves::getAllPossibleMoves(board, moves, fen.current_player);
+    for (Move move : moves) {
+      if (board.grid[move.to].type == PieceType::KING) continue;
+      kinds.add(move);
+      stack.push(board, move);
+      Board child = board;
+      child.movePiece(move);
+      expectSameAsRefresh(*network, stack, child, fen_str);
+
+      std::vector<Move> replies;
+      PossibleMoves::getAllPossibleMoves(child, replies, Team::getEnemyTeam(fen.current_player));
+      for (Move reply : replies) {
+        if (child.grid[reply.to].type == PieceType::KING) continue;
+        kinds.add(reply);
+        stack.push(child, reply);
+        Board grandchild = child;
+        grandchild.movePiece(reply);
+        expectSameAsRefresh(*network, stack, grandchild, fen_str);
+        ASSERT_EQ(stack.evaluate(Team::WHITE), Nnue::evaluate(*network, grandchild, Team::WHITE));
+        stack.pop();
+      }
+      stack.pop();
+    }
+    expectSameAsRefresh(*network, stack, board, fen_str);
+  }
+  // the sample still contains every kind of move that changes more than one piece (or the king square)
+  EXPECT_GT(kinds.castlings, 0);
+  EXPECT_GT(kinds.en_passants, 0);
+  EXPECT_GT(kinds.promotions, 0);
+  EXPECT_GT(kinds.king_moves, 0);
+}
+
+TEST(NnueTest, simd_equals_scalar) {
+  const std::unique_ptr<Nnue::Network> network = randomNetwork();
+  const std::vector<std::string> fens = datasetFens();
+  ASSERT_FALSE(fens.empty()) << missing_main_folder_path_error;
+  Nnue::Accumulator accumulator;
+  bool has_different_scores = false;
+  for (const std::string& fen_str : fens) {
+    const Board board = Board(Fen::buildFenFromStr(fen_str));
+    Nnue::refreshAccumulator(*network, board, Team::WHITE, accumulator);
+    Nnue::refreshAccumulator(*network, board, Team::BLACK, accumulator);
+    for (Team::Team player : {Team::BLACK, Team::WHITE}) {
+      ASSERT_EQ(Nnue::propagate(*network, accumulator, player), Nnue::propagateScalar(*network, accumulator, player))
+          << fen_str;
+    }
+    has_different_scores |= Nnue::propagate(*network, accumulator, Team::WHITE) != 0;
+  }
+  // the random network does not just clip everything to 0
+  ASSERT_TRUE(has_different_scores);
+}
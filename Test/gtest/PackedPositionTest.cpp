@@ -0,0 +1,175 @@
+//
+// Created by timap on 18.10.2026.
+//
+#include <gtest/gtest.h>
+
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "../../src/IO/Binary/PackedPosition.h"
+#include "../Main_Folder_Path_For_Testing.h"
+
+TEST(PackedPositionTest, RoundTripsDataset) {
+  std::ifstream file(main_folder_path + "/Test/gtest/datasets/ParsingTestData.txt");
+  ASSERT_TRUE(file.good()) << missing_main_folder_path_error;
+  std::string line;
+  Print::FenBuffer buffer;
+  while (std::getline(file, line)) {
+    const std::string fen_str = line.substr(0, line.find(';'));
+    Fen fen;
+    ASSERT_EQ(Fen::parseFenFromStr(fen_str, fen), FenError::NONE) << fen_str;
+
+    const PackedPosition packed = PackedPosition::pack(fen);
+    ASSERT_TRUE(packed.isValid()) << fen_str;
+    ASSERT_EQ(packed.player(), fen.current_player);
+
+    // the unpacked board gives back the same FEN
+    const Board board = packed.toBoard();
+    ASSERT_EQ(Print::board_state_to_fen(board.grid, board.extra, packed.player(), packed.turn, packed.half_moves),
+              fen_str);
+    const Fen unpacked = packed.toFen(buffer);
+    ASSERT_EQ(unpacked.board, fen.board);
+    ASSERT_EQ(unpacked.castling, fen.castling);
+    ASSERT_EQ(unpacked.en_passant.data, fen.en_passant.data);
+    ASSERT_TRUE(PackedPosition::pack(unpacked) == packed);
+  }
+}
+
+TEST(PackedPositionTest, RejectsInvalidRecords) {
+  const PackedPosition start = PackedPosition::pack(Fen());
+  ASSERT_TRUE(start.isValid());
+  ASSERT_EQ(start.occupancy, 0xFFFF'0000'0000'FFFFULL);
+
+  PackedPosition no_king = start;
+  // the 5th piece is the black king on e8
+  no_king.pieces[2] = static_cast<uint8_t>((no_king.pieces[2] & 0xF0) | PieceType::QUEEN);
+  ASSERT_FALSE(no_king.isValid());
+
+  PackedPosition empty_code = start;
+  empty_code.pieces[0] &= 0xF0;
+  ASSERT_FALSE(empty_code.isValid());
+
+  PackedPosition too_many_pieces = start;
+  too_many_pieces.occupancy |= uint64_t(1) << 20;
+  ASSERT_FALSE(too_many_pieces.isValid());
+
+  // sets the 4 bit code of the idx-th piece
+  const auto set_code = [](PackedPosition& packed, int idx, Team::Team team, PieceType::PieceType type) {
+    const uint8_t code = static_cast<uint8_t>(type | (team == Team::WHITE ? 0b1000 : 0));
+    uint8_t& pair = packed.pieces[idx >> 1];
+    pair = (idx & 1) ? static_cast<uint8_t>((pair & 0x0F) | (code << 4)) : static_cast<uint8_t>((pair & 0xF0) | code);
+  };
+
+  // the black king and 31 white pieces on the first 4 rows can not be put onto the Board
+  PackedPosition over_full_team = PackedPosition();
+  over_full_team.occupancy = 0x0000'0000'FFFF'FFFFULL;
+  set_code(over_full_team, 0, Team::BLACK, PieceType::KING);
+  set_code(over_full_team, 1, Team::WHITE, PieceType::KING);
+  for (int idx = 2; idx < 32; ++idx) set_code(over_full_team, idx, Team::WHITE, PieceType::QUEEN);
+  ASSERT_FALSE(over_full_team.isValid());
+  // the same 32 pieces split evenly between the teams are fine
+  PackedPosition full_teams = over_full_team;
+  for (int idx = 17; idx < 32; ++idx) set_code(full_teams, idx, Team::BLACK, PieceType::QUEEN);
+  ASSERT_TRUE(full_teams.isValid());
+
+  // the black king on a8, 9 black pawns on a7 to a6 and the white king on h1
+  PackedPosition too_many_pawns = PackedPosition();
+  too_many_pawns.occupancy = (uint64_t(1) << 63) | 0x1'FF01ULL;
+  set_code(too_many_pawns, 0, Team::BLACK, PieceType::KING);
+  for (int idx = 1; idx < 10; ++idx) set_code(too_many_pawns, idx, Team::BLACK, PieceType::PAWN);
+  set_code(too_many_pawns, 10, Team::WHITE, PieceType::KING);
+  ASSERT_FALSE(too_many_pawns.isValid());
+  // with 8 pawns it is fine
+  PackedPosition enough_pawns = too_many_pawns;
+  set_code(enough_pawns, 9, Team::BLACK, PieceType::KNIGHT);
+  ASSERT_TRUE(enough_pawns.isValid());
+
+  PackedPosition pawn_on_last_row = start;
+  // the 1st piece is the black rook on a8
+  set_code(pawn_on_last_row, 0, Team::BLACK, PieceType::PAWN);
+  ASSERT_FALSE(pawn_on_last_row.isValid());
+
+  PackedPosition wrong_en_passant = start;
+  wrong_en_passant.en_passant = 36;
+  ASSERT_FALSE(wrong_en_passant.isValid());
+
+  PackedPosition unused_flags = start;
+  unused_flags.flags |= 0b1000'0000;
+  ASSERT_FALSE(unused_flags.isValid());
+
+  PackedPosition wrong_result = start;
+  wrong_result.result = 4;
+  ASSERT_FALSE(wrong_result.isValid());
+}
+
+TEST(PackedPositionTest, StoresGameResults) {
+  std::istringstream fen_lines(
+      "rnbqkbnr/pppppppp/8/8/4P3/8/PPPP1PPP/RNBQKBNR b KQkq - c9 \"1-0\";\n"
+      "8/8/8/8/8/8/8/k6K b - - c9 \"1/2-1/2\"; id \"draw\";\n"
+      "8/8/8/8/8/8/8/k6K w - - 3 70 c9 \"0-1\";\n"
+      "8/8/8/8/8/8/8/k6K w - - 3 70\n");
+  std::ostringstream packed_file;
+  std::ostringstream log;
+  ASSERT_EQ(Packed::packFenLines(fen_lines, packed_file, log), 4);
+
+  const std::string data = packed_file.str();
+  std::vector<PackedPosition> positions;
+  Packed::Reader(data).readAll(positions);
+  ASSERT_EQ(positions[0].result, PackedPosition::white_won);
+  ASSERT_EQ(positions[1].result, PackedPosition::draw);
+  ASSERT_EQ(positions[2].result, PackedPosition::black_won);
+  ASSERT_EQ(positions[3].result, PackedPosition::unknown_result);
+  ASSERT_EQ(positions[0].whiteScore(), 1.0);
+  ASSERT_EQ(positions[1].whiteScore(), 0.5);
+  ASSERT_EQ(positions[2].whiteScore(), 0.0);
+
+  // the results are written back as c9 operations
+  std::ostringstream fens;
+  ASSERT_TRUE(Packed::unpackToFenLines(data, fens));
+  ASSERT_EQ(fens.str(),
+            "rnbqkbnr/pppppppp/8/8/4P3/8/PPPP1PPP/RNBQKBNR b KQkq - 0 1 c9 \"1-0\";\n"
+            "8/8/8/8/8/8/8/k6K b - - 0 1 c9 \"1/2-1/2\";\n"
+            "8/8/8/8/8/8/8/k6K w - - 3 70 c9 \"0-1\";\n"
+            "8/8/8/8/8/8/8/k6K w - - 3 70\n");
+}
+
+TEST(PackedPositionTest, WritesAndReadsFiles) {
+  std::istringstream fen_lines(
+      "# a comment\n"
+      "rnbqkbnr/pppppppp/8/8/4P3/8/PPPP1PPP/RNBQKBNR b KQkq e3 0 1\n"
+      "\n"
+      "r3k2r/8/8/8/8/8/8/R3K2R w Kq - 12 40; some data after the FEN\n"
+      "not a fen\n"
+      "8/8/8/8/8/8/8/k6K b - - bm Kb2; id \"epd\";\n");
+  std::ostringstream packed_file;
+  std::ostringstream log;
+  ASSERT_EQ(Packed::packFenLines(fen_lines, packed_file, log), 3);
+  ASSERT_EQ(log.str(), "line 5: invalid position\n");
+
+  const std::string data = packed_file.str();
+  ASSERT_EQ(data.size(), Packed::header_size + 3 * sizeof(PackedPosition));
+
+  Packed::Reader reader = Packed::Reader(data);
+  ASSERT_TRUE(reader.isValid());
+  ASSERT_EQ(reader.remaining(), 3);
+  PackedPosition first = PackedPosition();
+  ASSERT_TRUE(reader.next(first));
+  ASSERT_EQ(first.en_passant, 44);
+  std::vector<PackedPosition> rest;
+  reader.readAll(rest);
+  ASSERT_EQ(rest.size(), 2);
+  ASSERT_FALSE(reader.next(first));
+
+  std::ostringstream fens;
+  ASSERT_TRUE(Packed::unpackToFenLines(data, fens));
+  ASSERT_EQ(fens.str(),
+            "rnbqkbnr/pppppppp/8/8/4P3/8/PPPP1PPP/RNBQKBNR b KQkq e3 0 1\n"
+            "r3k2r/8/8/8/8/8/8/R3K2R w Kq - 12 40\n"
+            "8/8/8/8/8/8/8/k6K b - - 0 1\n");
+
+  // a truncated record or a wrong header is rejected
+  ASSERT_FALSE(Packed::Reader(std::string_view(data).substr(0, data.size() - 1)).isValid());
+  ASSERT_FALSE(Packed::Reader("CPOX" + data.substr(4)).isValid());
+}
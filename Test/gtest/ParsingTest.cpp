@@ -14,10 +14,13 @@
 #include <iostream>
 #include <sstream>
 #include <string>
+#include <string_view>
+#include <utility>
 #include <vector>
 
 #include "../../src/Board/Board.h"
 #include "../../src/Check/Check.h"
+#include "../../src/IO/Parser/StringParsing.h"
 #include "../../src/PossibleMoves/PossibleMoves.h"
 #include "../Main_Folder_Path_For_Testing.h"
 
@@ -112,3 +115,99 @@ TEST(FenParsingTest, FenAndMoveParsingTest) {
                                                   fen2.amount_half_moves));
   }
 }
+
+TEST(FenParsingTest, ParseFenReturnsSameErrorAsThrown) {
+  const std::pair<std::string, FenError> fens[] = {
+      {"rnbqkbnr/pppppppp/8/8/8/8/PPPPPPPP/RNBQKBNR w KQkq - 0 1", FenError::NONE},
+      {"  rnbqkbnr/pppppppp/8/8/4P3/8/PPPP1PPP/RNBQKBNR b KQkq e3 0 1", FenError::NONE},
+      {"", FenError::MISSING_DATA},
+      {"rnbqkbnr/pppppppp/8/8/8/8/PPPPPPPP/RNBQKBNR w KQkq - 0", FenError::MISSING_DATA},
+      {"rnbqkbnr/pppppppp/8/8/8/8/PPPPPPPP/RNBQKBNR w KQkq - 0 x", FenError::MISSING_TURN_DATA},
+      {"rnbqkbnr/pppppppp/8/8/8/8/PPPPPPPP/RNBQKBNR w KQkq - x 1", FenError::MISSING_HALF_TURN_DATA},
+      {"rnbqkbnr/ppxppppp/8/8/8/8/PPPPPPPP/RNBQKBNR w KQkq - 0 1", FenError::ILLEGAL_CHARACTER_IN_BOARD},
+      {"rnbqkbnr/pppppppp/9/8/8/8/PPPPPPPP/RNBQKBNR w KQkq - 0 1", FenError::ILLEGAL_CHARACTER_IN_BOARD},
+      {"rnbqkbnr/pppppppp/7/8/8/8/PPPPPPPP/RNBQKBNR w KQkq - 0 1", FenError::ILLEGAL_AMOUNT_PIECES_ON_A_ROW},
+      {"rnbqkbnr/pppppppp/8/8/8/PPPPPPPP/RNBQKBNR w KQkq - 0 1", FenError::ILLEGAL_AMOUNT_OF_ROWS_IN_BOARD},
+      {"rnbqkbnr/pppppppp/pppppppp/8/8/8/PPPPPPPP/RNBQKBNR w KQkq - 0 1", FenError::ILLEGAL_AMOUNT_OF_PIECES_IN_TEAM},
+      {"rnbqqbnr/pppppppp/8/8/8/8/PPPPPPPP/RNBQKBNR w KQkq - 0 1", FenError::ILLEGAL_AMOUNT_OF_KINGS_IN_TEAM},
+      {"rnbqkbnr/pppppppp/8/8/8/8/PPPPPPPP/RNBQKBNR x KQkq - 0 1", FenError::MISSING_CURRENT_PLAYER_DATA},
+      {"rnbqkbnr/pppppppp/8/8/8/8/PPPPPPPP/RNBQKBNR w KQZq - 0 1", FenError::ILLEGAL_CASTLING_RIGHTS},
+      {"rnbqkbn1/pppppppp/8/8/8/8/PPPPPPPP/RNBQKBNR w KQkq - 0 1", FenError::ILLEGAL_CASTLING_RIGHTS},
+      {"rnbqkbnr/pppppppp/8/8/8/8/PPPPPPPP/RNBQKBNR w KQkq e4 0 1", FenError::ILLEGAL_EN_PASSANT_POSITION},
+      {"rnbqkbnr/pppppppp/8/8/8/8/PPPPPPPP/RNBQKBNR b KQkq e3 0 1", FenError::ILLEGAL_EN_PASSANT_POSITION},
+      {"rnbqkbnr/pppppppp/8/8/8/8/PPPPPPPP/RNBQKBNR w KQkq i3 0 1", FenError::MISSING_EN_PASSANT_DATA},
+  };
+
+  for (const auto& [fen_str, expected_error] : fens) {
+    Fen fen;
+    const FenError error = Fen::parseFenFromStr(fen_str, fen);
+    EXPECT_EQ(error, expected_error) << fen_str;
+
+    // buildFenFromStr has to throw the exception corresponding to the returned error
+    std::string thrown_message;
+    try {
+      const Fen thrown_fen = Fen::buildFenFromStr(fen_str);
+      EXPECT_EQ(thrown_fen.board, fen.board);
+      EXPECT_EQ(thrown_fen.current_player, fen.current_player);
+      EXPECT_EQ(thrown_fen.castling, fen.castling);
+      EXPECT_EQ(thrown_fen.en_passant.data, fen.en_passant.data);
+      EXPECT_EQ(thrown_fen.amount_half_moves, fen.amount_half_moves);
+      EXPECT_EQ(thrown_fen.current_turn, fen.current_turn);
+    } catch (const FenParsingException& fenException) {
+      thrown_message = fenException.what();
+    }
+    if (error == FenError::NONE) {
+      EXPECT_TRUE(thrown_message.empty()) << fen_str;
+      continue;
+    }
+    try {
+      throwFenError(error);
+    } catch (const FenParsingException& fenException) {
+      EXPECT_EQ(thrown_message, fenException.what()) << fen_str;
+    }
+  }
+}
+
+TEST(FenParsingTest, WriteFenMatchesBoardStateToFen) {
+  std::ifstream file(main_folder_path + "/Test/gtest/datasets/perft.txt");
+  ASSERT_TRUE(file.good()) << missing_main_folder_path_error;
+  std::string line;
+  Print::FenBuffer buffer;
+  while (std::getline(file, line)) {
+    std::istringstream line_stream(line);
+    std::string fen_str;
+    std::getline(line_stream, fen_str, ';');
+
+    Fen fen;
+    ASSERT_EQ(Fen::parseFenFromStr(fen_str, fen), FenError::NONE) << fen_str;
+    Board board = Board(fen);
+
+    const std::string_view written =
+        Print::write_fen(buffer, board.grid, board.extra, fen.current_player, fen.current_turn, fen.amount_half_moves);
+    ASSERT_EQ(std::string(written), Print::board_state_to_fen(board.grid, board.extra, fen.current_player,
+                                                              fen.current_turn, fen.amount_half_moves));
+    ASSERT_EQ(fen_str, std::string(written) + ' ');
+  }
+
+  // counters with more digits than the datasets have
+  const Board board = Board(Fen::buildFenFromStr("8/8/8/8/8/8/8/k6K w - - 0 1"));
+  ASSERT_EQ(Print::write_fen(buffer, board.grid, board.extra, Team::BLACK, 2147483647, 1234567),
+            "8/8/8/8/8/8/8/k6K b - - 1234567 2147483647");
+}
+
+TEST(StringParsingTest, NumberArguments) {
+  // "/analyze 2 6": the amount of lines and the depth
+  std::string_view arguments = " 2 6";
+  ASSERT_EQ(parseNumberArgument(arguments, 3, 64), 2);
+  ASSERT_EQ(parseNumberArgument(arguments, 4, 63), 6);
+  ASSERT_EQ(parseNumberArgument(arguments, 4, 63), 4);
+
+  // too large numbers are reduced, invalid or missing ones use the default
+  arguments = "\t1000 ";
+  ASSERT_EQ(parseNumberArgument(arguments, 4, 63), 63);
+  arguments = "0";
+  ASSERT_EQ(parseNumberArgument(arguments, 4, 63), 4);
+  arguments = " x5 7";
+  ASSERT_EQ(parseNumberArgument(arguments, 4, 63), 4);
+  ASSERT_TRUE(arguments.empty());
+}
@@ -0,0 +1,109 @@
+//
+// Created by timap on 18.10.2026.
+//
+#include <gtest/gtest.h>
+
+#include <cstdio>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "../../src/IO/Parser/MappedFile.h"
+#include "../../src/IO/Parser/PgnParsing.h"
+#include "../../src/IO/Print/Print.h"
+
+/**
+ * @brief two games with tags, comments, variations, NAGs and annotations, and two games without tags
+ */
+static const std::string pgn_data =
+    "[Event \"Test \\\"quoted\\\" [1]\"]\n"
+    "[White \"A\"]\n"
+    "[Result \"1-0\"]\n"
+    "\n"
+    "1. e4 {a comment (with parentheses)} e5 2.Nf3 (2. Qh5 Nc6 (2... g6) 3. Bc4) 2... Nc6 $1 3. Bb5 !? a6 ; line\n"
+    "4. O-O 0-0-0?? 1-0\n"
+    "\n"
+    "[FEN \"6k1/5ppp/8/8/8/8/5PPP/R5K1 w - - 0 1\"]\n"
+    "1. Ra8# 1-0\n"
+    "% an escaped line\n"
+    "1. d4 d5 *\n"
+    "1. e4 e5";
+
+TEST(PgnTest, TokenizesGames) {
+  PgnReader reader = PgnReader(pgn_data);
+  PgnGame game = PgnGame();
+
+  ASSERT_TRUE(reader.nextGame(game));
+  ASSERT_EQ(game.tags.size(), 3);
+  ASSERT_EQ(game.findTag("Event"), "Test \\\"quoted\\\" [1]");
+  ASSERT_EQ(game.findTag("White"), "A");
+  ASSERT_EQ(game.findTag("Black"), "");
+  const std::vector<std::string_view> expected_moves = {"e4", "e5", "Nf3", "Nc6", "Bb5", "a6", "O-O", "0-0-0??"};
+  ASSERT_EQ(game.moves, expected_moves);
+  ASSERT_EQ(game.result, "1-0");
+
+  ASSERT_TRUE(reader.nextGame(game));
+  ASSERT_EQ(game.findTag("FEN"), "6k1/5ppp/8/8/8/8/5PPP/R5K1 w - - 0 1");
+  ASSERT_EQ(game.moves.size(), 1);
+
+  ASSERT_TRUE(reader.nextGame(game));
+  ASSERT_TRUE(game.tags.empty());
+  ASSERT_EQ(game.moves.size(), 2);
+  ASSERT_EQ(game.result, "*");
+
+  // the last game has no termination marker
+  ASSERT_TRUE(reader.nextGame(game));
+  ASSERT_EQ(game.moves.size(), 2);
+  ASSERT_EQ(game.result, "");
+  ASSERT_FALSE(reader.nextGame(game));
+}
+
+TEST(PgnTest, ReplaysGames) {
+  PgnReader reader = PgnReader(pgn_data);
+  PgnGame game = PgnGame();
+
+  // "0-0-0" is not legal for black in the first game
+  ASSERT_TRUE(reader.nextGame(game));
+  std::string uci_moves;
+  Pgn::Replay replay = Pgn::replayGame(game, [&uci_moves](const Board&, Team::Team, Move move) {
+    uci_moves += Print::move_as_uci(move) + ' ';
+  });
+  ASSERT_EQ(uci_moves, "e2e4 e7e5 g1f3 b8c6 f1b5 a7a6 e1g1 ");
+  ASSERT_EQ(replay.plies, 7);
+  ASSERT_EQ(replay.error, "0-0-0??");
+  ASSERT_EQ(replay.player, Team::BLACK);
+
+  ASSERT_TRUE(reader.nextGame(game));
+  replay = Pgn::replayGame(game, [](const Board&, Team::Team player, Move) { ASSERT_EQ(player, Team::WHITE); });
+  ASSERT_TRUE(replay.error.empty());
+  ASSERT_EQ(replay.board.grid[0].type, PieceType::CASTLE);
+
+  std::ostringstream out;
+  const Pgn::ReplayStats stats = Pgn::replayAll(pgn_data, out);
+  ASSERT_EQ(stats.games, 4);
+  ASSERT_EQ(stats.plies, 7 + 1 + 2 + 2);
+  ASSERT_EQ(stats.errors, 1);
+}
+
+TEST(PgnTest, MapsFiles) {
+  const std::string path = "pgn_test_file.pgn";
+  {
+    std::ofstream file(path, std::ios::binary);
+    file << pgn_data;
+  }
+  {
+    const MappedFile file = MappedFile(path);
+    ASSERT_TRUE(file.isOpen());
+    ASSERT_EQ(file.data(), pgn_data);
+    // the access pattern is only a hint and does not change the content
+    const MappedFile random_file = MappedFile(path, Access::RANDOM);
+    ASSERT_TRUE(random_file.isOpen());
+    ASSERT_EQ(random_file.data(), pgn_data);
+  }
+  std::remove(path.c_str());
+
+  const MappedFile missing = MappedFile("this file does not exist.pgn");
+  ASSERT_FALSE(missing.isOpen());
+  ASSERT_TRUE(missing.data().empty());
+}
@@ -0,0 +1,116 @@
+//
+// Created by timap on 18.10.2026.
+//
+#include <gtest/gtest.h>
+
+#include <string>
+#include <vector>
+
+#include "../../src/IO/Parser/SanParsing.h"
+#include "../../src/IO/Parser/StringParsing.h"
+#include "../../src/IO/Print/Print.h"
+#include "../../src/PossibleMoves/PossibleMoves.h"
+
+/**
+ * @brief converts the move given in UCI notation to SAN
+ */
+static std::string uciToSan(const std::string& fen_str, const std::string& uci) {
+  const Fen fen = Fen::buildFenFromStr(fen_str);
+  const Board board = Board(fen);
+  std::vector<Move> move_list;
+  PossibleMoves::getAllPossibleMoves(board, move_list, fen.current_player);
+  PossibleMoves::trimMovesPuttingPlayerIntoCheckmate(board, move_list, fen.current_player);
+  for (const Move& move : move_list) {
+    if (Print::move_as_uci(move) == uci) return Print::move_as_san(board, move);
+  }
+  return "";
+}
+
+/**
+ * @brief checks that every legal move is printed as a SAN that is parsed back to the same move, up to the given depth
+ */
+static void checkRoundTrip(const Board& board, Team::Team player, int depth) {
+  std::vector<Move> move_list;
+  PossibleMoves::getAllPossibleMoves(board, move_list, player);
+  PossibleMoves::trimMovesPuttingPlayerIntoCheckmate(board, move_list, player);
+  for (const Move& move : move_list) {
+    const std::string san = Print::move_as_san(board, move);
+    const SlimOptional<Move> parsed = San::findMove(board, player, san);
+    ASSERT_TRUE(parsed.has_value()) << san;
+    ASSERT_TRUE(parsed.data == move) << san;
+    if (depth > 1) {
+      Board next = board;
+      next.movePiece(move);
+      checkRoundTrip(next, Team::getEnemyTeam(player), depth - 1);
+    }
+  }
+}
+
+TEST(SanTest, PrintsSan) {
+  const std::string start = "rnbqkbnr/pppppppp/8/8/8/8/PPPPPPPP/RNBQKBNR w KQkq - 0 1";
+  ASSERT_EQ(uciToSan(start, "e2e4"), "e4");
+  ASSERT_EQ(uciToSan(start, "g1f3"), "Nf3");
+
+  const std::string kiwipete = "r3k2r/p1ppqpb1/bn2pnp1/3PN3/1p2P3/2N2Q1p/PPPBBPPP/R3K2R w KQkq - 0 1";
+  ASSERT_EQ(uciToSan(kiwipete, "e1g1"), "O-O");
+  ASSERT_EQ(uciToSan(kiwipete, "e1c1"), "O-O-O");
+  ASSERT_EQ(uciToSan(kiwipete, "e2a6"), "Bxa6");
+  ASSERT_EQ(uciToSan(kiwipete, "d5e6"), "dxe6");
+  ASSERT_EQ(uciToSan(kiwipete, "e5f7"), "Nxf7");
+  // the knight on c3 can also go to d1, the castle on a1 can not as the king is in the way
+  ASSERT_EQ(uciToSan(kiwipete, "c3d1"), "Nd1");
+  ASSERT_EQ(uciToSan(kiwipete, "a1d1"), "Rd1");
+
+  // disambiguation by file, by rank and by both
+  ASSERT_EQ(uciToSan("6k1/8/8/8/8/8/1N2KN2/R6R w - - 0 1", "a1d1"), "Rad1");
+  ASSERT_EQ(uciToSan("6k1/8/8/8/8/8/1N2KN2/R6R w - - 0 1", "b2d3"), "Nbd3");
+  ASSERT_EQ(uciToSan("6k1/8/8/R7/8/8/4K3/R7 w - - 0 1", "a1a3"), "R1a3");
+  ASSERT_EQ(uciToSan("6k1/8/8/Q1Q5/8/8/4K3/Q7 w - - 0 1", "a5c3"), "Qa5c3");
+  // a piece that is pinned does not need to be told apart
+  ASSERT_EQ(uciToSan("4k3/4r3/8/8/8/8/2N1N3/4K3 w - - 0 1", "c2d4"), "Nd4");
+
+  // check, checkmate, promotion and en passant
+  ASSERT_EQ(uciToSan("6k1/5ppp/8/8/8/8/5PPP/R5K1 w - - 0 1", "a1a8"), "Ra8#");
+  ASSERT_EQ(uciToSan("6k1/6pp/8/8/8/8/5PPP/R5K1 w - - 0 1", "a1a8"), "Ra8+");
+  ASSERT_EQ(uciToSan("1n4k1/P7/8/8/8/8/8/4K3 w - - 0 1", "a7b8q"), "axb8=Q+");
+  ASSERT_EQ(uciToSan("1n4k1/P7/8/8/8/8/8/4K3 w - - 0 1", "a7a8n"), "a8=N");
+  ASSERT_EQ(uciToSan("4k3/8/8/3pP3/8/8/8/4K3 w - d6 0 2", "e5d6"), "exd6");
+}
+
+TEST(SanTest, ParsesSanStrings) {
+  SlimOptional<SanMove> move = convert_san_to_move("Nbxd2+");
+  ASSERT_TRUE(move.has_value());
+  ASSERT_EQ(move.data.type, PieceType::KNIGHT);
+  ASSERT_EQ(move.data.from_file, 1);
+  ASSERT_EQ(move.data.from_row, -1);
+  ASSERT_EQ(Print::position_to_string(move.data.to), "d2");
+
+  move = convert_san_to_move("exf8=Q#");
+  ASSERT_TRUE(move.has_value());
+  ASSERT_EQ(move.data.type, PieceType::PAWN);
+  ASSERT_EQ(move.data.promote.data, PieceType::QUEEN);
+
+  move = convert_san_to_move("O-O-O");
+  ASSERT_TRUE(move.has_value());
+  ASSERT_EQ(move.data.castling.data, SpecialMove::CastleQueenSide);
+
+  ASSERT_FALSE(convert_san_to_move("").has_value());
+  ASSERT_FALSE(convert_san_to_move("Nz3").has_value());
+  ASSERT_FALSE(convert_san_to_move("Ne9").has_value());
+  ASSERT_FALSE(convert_san_to_move("e8=K").has_value());
+  ASSERT_FALSE(convert_san_to_move("Pe2e4").has_value());
+}
+
+TEST(SanTest, RoundTripsAllLegalMoves) {
+  const std::string fens[] = {
+      "rnbqkbnr/pppppppp/8/8/8/8/PPPPPPPP/RNBQKBNR w KQkq - 0 1",
+      "r3k2r/p1ppqpb1/bn2pnp1/3PN3/1p2P3/2N2Q1p/PPPBBPPP/R3K2R w KQkq - 0 1",
+      "8/2p5/3p4/KP5r/1R3p1k/8/4P1P1/8 w - - 0 1",
+      "r3k2r/Pppp1ppp/1b3nbN/nP6/BBP1P3/q4N2/Pp1P2PP/R2Q1RK1 w kq - 0 1",
+      "rnbq1k1r/pp1Pbppp/2p5/8/2B5/8/PPP1NnPP/RNBQK2R w KQ - 1 8",
+  };
+  for (const std::string& fen_str : fens) {
+    const Fen fen = Fen::buildFenFromStr(fen_str);
+    checkRoundTrip(Board(fen), fen.current_player, 2);
+  }
+}
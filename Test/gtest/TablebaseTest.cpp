@@ -0,0 +1,214 @@
+//
+// Created by timap on 18.10.2026.
+//
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <filesystem>
+#include <sstream>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "../../src/Bot/Evaluation/KpkBitbase.h"
+#include "../../src/Bot/MinMax/MinMax.h"
+#include "../../src/Bot/Tablebase/Tablebase.h"
+#include "../../src/Check/Check.h"
+#include "../../src/IO/Parser/FenParsing.h"
+#include "../../src/PossibleMoves/PossibleMoves.h"
+
+/**
+ * @return the directory with the generated tables with 3 pieces (generated on the first call)
+ */
+static const std::string& tablebaseDirectory() {
+  static const std::string directory = [] {
+    const std::filesystem::path path = std::filesystem::temp_directory_path() / "chess_tablebase_test";
+    std::filesystem::create_directories(path);
+    Tablebase::GenerateOptions options = Tablebase::GenerateOptions();
+    options.pieces = 3;
+    std::ostringstream log;
+    EXPECT_TRUE(Tablebase::generate(path.string(), options, log)) << log.str();
+    // the tests load the tables themselves, the other tests must not see them
+    Tablebase::load("");
+    return path.string();
+  }();
+  return directory;
+}
+
+/**
+ * @return a FEN with the given pieces (the squares use 0 = a8)
+ */
+static std::string boardFen(const std::vector<std::pair<int, char>>& pieces, Team::Team player) {
+  std::string grid(BOARD_SIZE, '1');
+  for (const auto& [pos, piece] : pieces) grid[pos] = piece;
+  std::string fen_str;
+  for (int row = 0; row < 8; ++row) {
+    fen_str += grid.substr(row * 8, 8);
+    if (row < 7) fen_str += '/';
+  }
+  return fen_str + (player == Team::WHITE ? " w - - 0 1" : " b - - 0 1");
+}
+
+/**
+ * @return the result of the board in the tables, which have to be loaded
+ */
+static Tablebase::ProbeResult probeFen(const std::string& fen_str) {
+  const Fen fen = Fen::buildFenFromStr(fen_str);
+  Tablebase::ProbeResult result = Tablebase::ProbeResult();
+  EXPECT_TRUE(Tablebase::probe(Board(fen), fen.current_player, result)) << fen_str;
+  return result;
+}
+
+/**
+ * @brief expects the result of a board to follow from the results of the boards after its legal moves, which are
+ * generated with the move generation of the engine instead of the one of the tables
+ */
+static void expectConsistent(const std::string& fen_str) {
+  const Fen fen = Fen::buildFenFromStr(fen_str);
+  const Board board = Board(fen);
+  const Team::Team player = fen.current_player;
+  Tablebase::ProbeResult result = Tablebase::ProbeResult();
+  // not a legal board
+  if (!Tablebase::probe(board, player, result)) return;
+
+  std::vector<Move> moves;
+  PossibleMoves::getAllPossibleMoves(board, moves, player);
+  bool has_legal_move = false;
+  bool all_won = true;
+  int shortest_loss = -1;
+  int longest_win = 0;
+  for (Move move : moves) {
+    Board next = board;
+    next.movePiece(move);
+    if (Check::isChecked(next, player, next.positions.getKingPos(player))) continue;
+    has_legal_move = true;
+    // the tables do not know en passant, so it is removed after a double step of a pawn
+    const Board without_passant = Board(next.grid, Board_Extra(0, ChessPos::nullopt()));
+    Tablebase::ProbeResult child = Tablebase::ProbeResult();
+    ASSERT_TRUE(Tablebase::probe(without_passant, Team::getEnemyTeam(player), child)) << fen_str;
+    if (child.wdl == Tablebase::Wdl::LOSS && (shortest_loss < 0 || child.distance < shortest_loss)) {
+      shortest_loss = child.distance;
+    }
+    all_won &= child.wdl == Tablebase::Wdl::WIN;
+    longest_win = std::max(longest_win, child.distance);
+  }
+
+  Tablebase::ProbeResult expected = Tablebase::ProbeResult();
+  if (!has_legal_move) {
+    if (Check::isChecked(board, player, board.positions.getKingPos(player))) expected = {Tablebase::Wdl::LOSS, 0};
+  } else if (shortest_loss >= 0) {
+    expected = {Tablebase::Wdl::WIN, shortest_loss + 1};
+  } else if (all_won) {
+    expected = {Tablebase::Wdl::LOSS, longest_win + 1};
+  }
+  ASSERT_EQ(result.wdl, expected.wdl) << fen_str;
+  ASSERT_EQ(result.distance, expected.distance) << fen_str;
+}
+
+TEST(TablebaseTest, signatures_in_generation_order) {
+  ASSERT_EQ(Tablebase::signatures(3), std::vector<std::string>({"KQvK", "KRvK", "KBvK", "KNvK", "KPvK"}));
+  const std::vector<std::string> signatures = Tablebase::signatures(4);
+  ASSERT_EQ(signatures.size(), 35);
+  // the promotions of KPvKP lead to KQvKP, which has to be generated before
+  const auto position = [&](const std::string& name) {
+    return std::find(signatures.begin(), signatures.end(), name) - signatures.begin();
+  };
+  ASSERT_LT(position("KQvKP"), position("KPvKP"));
+  ASSERT_LT(position("KRvKN"), position("KQvKP"));
+}
+
+TEST(TablebaseTest, known_results) {
+  ASSERT_EQ(Tablebase::load(tablebaseDirectory()), 5);
+  ASSERT_EQ(Tablebase::loadedPieces(), 3);
+
+  // checkmate
+  Tablebase::ProbeResult result = probeFen("k7/1Q6/1K6/8/8/8/8/8 b - - 0 1");
+  ASSERT_EQ(result.wdl, Tablebase::Wdl::LOSS);
+  ASSERT_EQ(result.distance, 0);
+  // the same with the teams swapped, which is looked up in the same table
+  result = probeFen("K7/1q6/1k6/8/8/8/8/8 w - - 0 1");
+  ASSERT_EQ(result.wdl, Tablebase::Wdl::LOSS);
+  ASSERT_EQ(result.distance, 0);
+  // mate in 1
+  result = probeFen("k7/8/1K6/8/8/8/8/2Q5 w - - 0 1");
+  ASSERT_EQ(result.wdl, Tablebase::Wdl::WIN);
+  ASSERT_EQ(result.distance, 1);
+  // stalemate
+  ASSERT_EQ(probeFen("k7/8/1QK5/8/8/8/8/8 b - - 0 1").wdl, Tablebase::Wdl::DRAW);
+  // not enough material
+  ASSERT_EQ(probeFen("8/8/3k4/8/8/2BK4/8/8 w - - 0 1").wdl, Tablebase::Wdl::DRAW);
+  ASSERT_EQ(probeFen("8/8/3k4/8/8/8/8/4K3 w - - 0 1").wdl, Tablebase::Wdl::DRAW);
+  // the rook is lost
+  ASSERT_EQ(probeFen("8/8/8/8/8/8/8/rK5k w - - 0 1").wdl, Tablebase::Wdl::DRAW);
+
+  // boards that can not be looked up
+  Tablebase::ProbeResult unchanged = Tablebase::ProbeResult();
+  const Fen castling = Fen::buildFenFromStr("4k3/8/8/8/8/8/8/R3K3 w Q - 0 1");
+  ASSERT_FALSE(Tablebase::probe(Board(castling), castling.current_player, unchanged));
+  const Fen too_many = Fen::buildFenFromStr("4k3/8/8/8/8/8/8/RR2K3 w - - 0 1");
+  ASSERT_FALSE(Tablebase::probe(Board(too_many), too_many.current_player, unchanged));
+  const Fen not_legal = Fen::buildFenFromStr("k7/1Q6/1K6/8/8/8/8/8 w - - 0 1");
+  ASSERT_FALSE(Tablebase::probe(Board(not_legal), not_legal.current_player, unchanged));
+
+  Tablebase::load("");
+  ASSERT_EQ(Tablebase::loadedPieces(), 0);
+  const Fen mate = Fen::buildFenFromStr("k7/1Q6/1K6/8/8/8/8/8 b - - 0 1");
+  ASSERT_FALSE(Tablebase::probe(Board(mate), mate.current_player, unchanged));
+}
+
+TEST(TablebaseTest, consistent_with_the_move_generation) {
+  ASSERT_EQ(Tablebase::load(tablebaseDirectory()), 5);
+  for (char piece : {'R', 'P', 'n'}) {
+    for (int white_king = 0; white_king < BOARD_SIZE; white_king += 3) {
+      for (int black_king = 1; black_king < BOARD_SIZE; black_king += 2) {
+        for (int pos = 8; pos < BOARD_SIZE - 8; pos += 5) {
+          if (pos == white_king || pos == black_king || white_king == black_king) continue;
+          for (Team::Team player : {Team::WHITE, Team::BLACK}) {
+            expectConsistent(boardFen({{white_king, 'K'}, {black_king, 'k'}, {pos, piece}}, player));
+          }
+        }
+      }
+    }
+  }
+  Tablebase::load("");
+}
+
+TEST(TablebaseTest, agrees_with_the_kpk_bitbase) {
+  ASSERT_EQ(Tablebase::load(tablebaseDirectory()), 5);
+  for (int pawn = 8; pawn < BOARD_SIZE - 8; ++pawn) {
+    for (int white_king = 0; white_king < BOARD_SIZE; ++white_king) {
+      for (int black_king = 0; black_king < BOARD_SIZE; ++black_king) {
+        if (pawn == white_king || pawn == black_king || white_king == black_king) continue;
+        for (Team::Team player : {Team::WHITE, Team::BLACK}) {
+          const std::string fen_str = boardFen({{white_king, 'K'}, {black_king, 'k'}, {pawn, 'P'}}, player);
+          const Board board = Board(Fen::buildFenFromStr(fen_str));
+          Tablebase::ProbeResult result = Tablebase::ProbeResult();
+          if (!Tablebase::probe(board, player, result)) continue;
+          const bool white_wins = result.wdl == (player == Team::WHITE ? Tablebase::Wdl::WIN : Tablebase::Wdl::LOSS);
+          ASSERT_EQ(white_wins, Kpk::isWin(board, player)) << fen_str;
+        }
+      }
+    }
+  }
+  Tablebase::load("");
+}
+
+TEST(TablebaseTest, search_plays_the_shortest_mate) {
+  ASSERT_EQ(Tablebase::load(tablebaseDirectory()), 5);
+  const Fen fen = Fen::buildFenFromStr("k7/8/1K6/8/8/8/8/2Q5 w - - 0 1");
+  SearchStats stats = SearchStats();
+  const SearchResult result = MinMaxSearch(Board(fen), 6, fen.current_player, stats, nullptr);
+  ASSERT_TRUE(result.best_move.has_value());
+  ASSERT_EQ(result.best_move.data.to, 2);
+  ASSERT_EQ(mateInMoves(result.score, Team::WHITE), 1);
+  // only the root and its children, as every child is looked up in the tables
+  ASSERT_LT(stats.nodes, 40);
+
+  // a mate further away than the search looks
+  const Fen rook = Fen::buildFenFromStr("8/8/8/4k3/8/8/8/R3K3 w - - 0 1");
+  const Tablebase::ProbeResult expected = probeFen("8/8/8/4k3/8/8/8/R3K3 w - - 0 1");
+  const SearchResult rook_result = MinMaxSearch(Board(rook), 2, rook.current_player, stats, nullptr);
+  ASSERT_TRUE(isMateScore(rook_result.score));
+  ASSERT_EQ(mateInMoves(rook_result.score, Team::WHITE), (expected.distance + 1) / 2);
+  Tablebase::load("");
+}
@@ -0,0 +1,91 @@
+//
+// Created by timap on 18.10.2026.
+//
+#include <gtest/gtest.h>
+
+#include <string>
+
+#include "../../src/Bot/MinMax/MinMax.h"
+#include "../../src/Bot/Search/Search.h"
+#include "../../src/Bot/TranspositionTable/Zobrist.h"
+#include "../../src/IO/Print/Print.h"
+#include "../../src/IO/Uci/Uci.h"
+
+/**
+ * @brief plays the given moves in UCI notation on the board
+ */
+static Board playMoves(Board board, Team::Team player, const std::initializer_list<std::string_view>& moves) {
+  for (const std::string_view& move_str : moves) {
+    const SlimOptional<Move> move = Uci::parseUciMove(board, player, move_str);
+    EXPECT_TRUE(move.has_value()) << move_str;
+    board.movePiece(move.data);
+    player = Team::getEnemyTeam(player);
+  }
+  return board;
+}
+
+TEST(TranspositionTableTest, ZobristHashOfTranspositions) {
+  const Board start = Board();
+  const Board knights_first = playMoves(start, Team::WHITE, {"g1f3", "g8f6", "b1c3", "b8c6"});
+  const Board knights_swapped = playMoves(start, Team::WHITE, {"b1c3", "b8c6", "g1f3", "g8f6"});
+  ASSERT_EQ(Zobrist::hashBoard(knights_first, Team::WHITE), Zobrist::hashBoard(knights_swapped, Team::WHITE));
+
+  // the same pieces with another team to move, without castling rights, or with en passant are other boards
+  ASSERT_NE(Zobrist::hashBoard(start, Team::WHITE), Zobrist::hashBoard(start, Team::BLACK));
+  const Board king_moved = playMoves(start, Team::WHITE, {"g1f3", "g8f6", "e2e3", "e7e6", "e1e2", "e8e7"});
+  const Board king_back = playMoves(king_moved, Team::WHITE, {"e2e1", "e7e8"});
+  const Board pawns_only = playMoves(start, Team::WHITE, {"g1f3", "g8f6", "e2e3", "e7e6"});
+  ASSERT_NE(Zobrist::hashBoard(king_back, Team::WHITE), Zobrist::hashBoard(pawns_only, Team::WHITE));
+  const Board double_step = playMoves(start, Team::WHITE, {"e2e4"});
+  const Board two_single_steps = playMoves(start, Team::WHITE, {"e2e3", "g8f6", "e3e4", "f6g8"});
+  ASSERT_NE(Zobrist::hashBoard(double_step, Team::BLACK), Zobrist::hashBoard(two_single_steps, Team::BLACK));
+}
+
+TEST(TranspositionTableTest, StoreAndProbe) {
+  TranspositionTable tt = TranspositionTable(1);
+  const uint64_t hash = Zobrist::hashBoard(Board(), Team::WHITE);
+  ASSERT_EQ(tt.probe(hash), nullptr);
+
+  const Move move = Uci::parseUciMove(Board(), Team::WHITE, "e2e4").data;
+  tt.store(hash, 3, 120, 2, Bound::LOWER, move);
+  const TTEntry* entry = tt.probe(hash);
+  ASSERT_NE(entry, nullptr);
+  ASSERT_EQ(entry->depth, 3);
+  ASSERT_EQ(entry->score, 120);
+  ASSERT_EQ(entry->bound, Bound::LOWER);
+  ASSERT_TRUE(entry->best_move == move);
+  // another board in the same slot is not found
+  ASSERT_EQ(tt.probe(hash ^ (tt.capacity() << 1)), nullptr);
+
+  // mate scores are stored relative to the board, so they stay correct when the board is reached at another ply
+  const int mate_at_ply_5 = MATE_SCORE - 5;
+  tt.store(hash, 4, mate_at_ply_5, 2, Bound::EXACT, move);
+  ASSERT_EQ(scoreFromTT(tt.probe(hash)->score, 2), mate_at_ply_5);
+  ASSERT_EQ(scoreFromTT(tt.probe(hash)->score, 0), mate_at_ply_5 + 2);
+  ASSERT_EQ(scoreFromTT(scoreToTT(-mate_at_ply_5, 3), 1), -(mate_at_ply_5 + 2));
+
+  tt.clear();
+  ASSERT_EQ(tt.probe(hash), nullptr);
+}
+
+TEST(TranspositionTableTest, SearchWithTableFindsTheSameMate) {
+  // mate in 1 for white (Qd8#), which the search with the table must not lose
+  const std::string fen_str = "6k1/5p1p/5PpB/8/8/8/5PPP/3Q2K1 w - - 0 1";
+  const Board board = Board(Fen::buildFenFromStr(fen_str));
+  SearchStats stats = SearchStats();
+  const SearchResult without_table = MinMaxSearch(board, 5, Team::WHITE, stats, nullptr);
+
+  TranspositionTable tt = TranspositionTable(1);
+  SearchLimits limits = SearchLimits();
+  limits.depth = 5;
+  SearchControl control = SearchControl();
+  const SearchResult with_table = Search::iterativeDeepening(board, Team::WHITE, limits, control, {}, &tt);
+  ASSERT_EQ(mateInMoves(without_table.score, Team::WHITE), 1);
+  ASSERT_EQ(with_table.score, without_table.score);
+  ASSERT_EQ(Print::move_as_uci(with_table.best_move.data), Print::move_as_uci(without_table.best_move.data));
+
+  // a second search reuses the table and still gets the same result
+  SearchControl second_control = SearchControl();
+  const SearchResult again = Search::iterativeDeepening(board, Team::WHITE, limits, second_control, {}, &tt);
+  ASSERT_EQ(again.score, with_table.score);
+}
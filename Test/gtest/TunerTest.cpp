@@ -0,0 +1,98 @@
+//
+// Created by timap on 18.10.2026.
+//
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <fstream>
+#include <sstream>
+#include <string>
+
+#include "../../src/Bot/Evaluation/KpkBitbase.h"
+#include "../../src/Bot/Tuning/Tuner.h"
+#include "../Main_Folder_Path_For_Testing.h"
+
+/**
+ * @return the positions of the parsing dataset, labelled with the sign of their evaluation as the result (and every
+ * third position as a draw, so that the labels do not just follow the evaluation)
+ */
+static std::string labelledDataset() {
+  std::ifstream file(main_folder_path + "/Test/gtest/datasets/ParsingTestData.txt");
+  std::string epd;
+  std::string line;
+  for (int idx = 0; std::getline(file, line); ++idx) {
+    const std::string fen_str = line.substr(0, line.find(';'));
+    const int score = idx % 3 == 0 ? 0 : evaluateBoard(Board(Fen::buildFenFromStr(fen_str)), Team::WHITE);
+    epd += fen_str + (score > 0 ? " c9 \"1-0\";\n" : score < 0 ? " c9 \"0-1\";\n" : " c9 \"1/2-1/2\";\n");
+  }
+  return epd;
+}
+
+/**
+ * @param path the path of a file inside of the project
+ * @return the content of the file
+ */
+static std::string fileContent(const std::string& path) {
+  std::ifstream file(main_folder_path + path);
+  std::stringstream content;
+  content << file.rdbuf();
+  return content.str();
+}
+
+TEST(TunerTest, coefficients_give_the_evaluation) {
+  const std::string epd = labelledDataset();
+  ASSERT_FALSE(epd.empty()) << missing_main_folder_path_error;
+  Tuning::Dataset dataset = Tuning::Dataset();
+  std::ostringstream log;
+  ASSERT_EQ(Tuning::loadDataset(epd, dataset, 2, log), 0);
+  ASSERT_EQ(log.str(), "");
+
+  const Tuning::Parameters parameters = Tuning::currentParameters();
+  std::istringstream lines(epd);
+  std::string line;
+  uint64_t idx = 0;
+  while (std::getline(lines, line)) {
+    const Board board = Board(Fen::buildFenFromStr(line.substr(0, line.find(" c9"))));
+    if (Kpk::isKpk(board)) continue;
+    ASSERT_EQ(dataset.score(idx++, parameters), evaluateBoard(board, Team::WHITE)) << line;
+  }
+  ASSERT_EQ(idx, dataset.size());
+}
+
+TEST(TunerTest, tuning_lowers_the_error) {
+  const std::string epd = labelledDataset();
+  ASSERT_FALSE(epd.empty()) << missing_main_folder_path_error;
+  Tuning::Dataset dataset = Tuning::Dataset();
+  std::ostringstream log;
+  Tuning::loadDataset(epd, dataset, 2, log);
+
+  Tuning::Parameters parameters = Tuning::currentParameters();
+  const double k = Tuning::fitScaling(dataset, parameters, 2);
+  ASSERT_GT(k, 0);
+  ASSERT_LT(k, 10);
+  const double error = dataset.loss(parameters, k, 2);
+
+  // the gradient matches the difference quotient of the error
+  Tuning::Parameters gradient;
+  dataset.loss(parameters, k, 2, &gradient);
+  Tuning::Parameters moved = parameters;
+  const int knight_value = 2 * (Tuning::material_params + PieceType::KNIGHT);
+  moved[knight_value] += 0.01;
+  const double difference_quotient = (dataset.loss(moved, k, 2) - error) / 0.01;
+  ASSERT_NEAR(difference_quotient, gradient[knight_value], 1e-2 * std::abs(gradient[knight_value]));
+
+  Tuning::TuneOptions options = Tuning::TuneOptions();
+  options.iterations = 20;
+  options.threads = 2;
+  ASSERT_LT(Tuning::tune(dataset, parameters, k, options, log), error);
+}
+
+TEST(TunerTest, headers_of_the_current_constants_are_the_current_headers) {
+  const Tuning::Parameters parameters = Tuning::currentParameters();
+  std::ostringstream pesto_tables;
+  Tuning::writePestoTables(pesto_tables, parameters);
+  ASSERT_EQ(pesto_tables.str(), fileContent("/src/Bot/Evaluation/pesto_tables.h")) << missing_main_folder_path_error;
+  std::ostringstream eval_constants;
+  Tuning::writeEvalConstants(eval_constants, parameters);
+  ASSERT_EQ(eval_constants.str(), fileContent("/src/Bot/Evaluation/eval_constants.h"));
+}
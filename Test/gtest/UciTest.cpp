@@ -0,0 +1,175 @@
+//
+// Created by timap on 18.10.2026.
+//
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <sstream>
+#include <streambuf>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include "../../src/Bot/MinMax/MinMax.h"
+#include "../../src/IO/Print/Print.h"
+#include "../../src/IO/Uci/Uci.h"
+
+/**
+ * @brief an input that hands out its lines one after another, each only after waiting for its delay, like a GUI that
+ * sends the next command a while later
+ */
+class DelayedInput : public std::streambuf {
+ private:
+  /**
+   * @brief the lines (with their newline) and the time to wait before each of them
+   */
+  std::vector<std::pair<std::chrono::milliseconds, std::string>> lines;
+  /**
+   * @brief the index of the next line to hand out
+   */
+  uint64_t next = 0;
+
+ protected:
+  int_type underflow() override {
+    if (gptr() < egptr()) return traits_type::to_int_type(*gptr());
+    if (next >= lines.size()) return traits_type::eof();
+    std::this_thread::sleep_for(lines[next].first);
+    std::string& line = lines[next++].second;
+    setg(line.data(), line.data(), line.data() + line.size());
+    return traits_type::to_int_type(*gptr());
+  }
+
+ public:
+  explicit DelayedInput(std::vector<std::pair<std::chrono::milliseconds, std::string>> lines)
+      : lines(std::move(lines)) {}
+};
+
+TEST(UciTest, ParsingAndPrintingMoves) {
+  const Board board = Board();
+  const SlimOptional<Move> move = Uci::parseUciMove(board, Team::WHITE, "e2e4");
+  ASSERT_TRUE(move.has_value());
+  ASSERT_EQ(Print::move_as_uci(move.data), "e2e4");
+  ASSERT_EQ(move.data.piece.type, PieceType::PAWN);
+
+  // illegal or malformed moves
+  ASSERT_FALSE(Uci::parseUciMove(board, Team::WHITE, "e2e5").has_value());
+  ASSERT_FALSE(Uci::parseUciMove(board, Team::WHITE, "e7e5").has_value());
+  ASSERT_FALSE(Uci::parseUciMove(board, Team::WHITE, "i2i4").has_value());
+  ASSERT_FALSE(Uci::parseUciMove(board, Team::WHITE, "e2").has_value());
+}
+
+TEST(UciTest, ParsingPromotionAndCastling) {
+  const Fen fen = Fen::buildFenFromStr("r3k3/1P6/8/8/8/8/8/4K2R w Kq - 0 1");
+  const Board board = Board(fen);
+
+  const SlimOptional<Move> promotion = Uci::parseUciMove(board, Team::WHITE, "b7a8n");
+  ASSERT_TRUE(promotion.has_value());
+  ASSERT_EQ(promotion.data.promote.data, PieceType::KNIGHT);
+  ASSERT_EQ(Print::move_as_uci(promotion.data), "b7a8n");
+  // a promotion needs the piece
+  ASSERT_FALSE(Uci::parseUciMove(board, Team::WHITE, "b7a8").has_value());
+
+  const SlimOptional<Move> castling = Uci::parseUciMove(board, Team::WHITE, "e1g1");
+  ASSERT_TRUE(castling.has_value());
+  ASSERT_EQ(castling.data.specialMove.data, SpecialMove::CastleKingSide);
+}
+
+TEST(UciTest, ParsingPositions) {
+  Uci::Position position = Uci::Position();
+  ASSERT_TRUE(Uci::parsePosition("startpos moves e2e4 e7e5 g1f3", position));
+  ASSERT_EQ(position.current_player, Team::BLACK);
+  ASSERT_EQ(position.current_turn, 2);
+  ASSERT_EQ(position.amount_half_moves, 1);
+  ASSERT_EQ(Print::board_state_to_fen(position.board.grid, position.board.extra, position.current_player,
+                                      position.current_turn, position.amount_half_moves),
+            "rnbqkbnr/pppp1ppp/8/4p3/4P3/5N2/PPPP1PPP/RNBQKB1R b KQkq - 1 2");
+
+  ASSERT_TRUE(Uci::parsePosition("fen 4k3/8/8/8/8/8/4P3/4K3 w - - 0 1 moves e2e4", position));
+  ASSERT_EQ(position.current_player, Team::BLACK);
+  ASSERT_EQ(position.board.grid[36].type, PieceType::PAWN);
+
+  // an invalid position does not change the current one
+  ASSERT_FALSE(Uci::parsePosition("startpos moves e2e5", position));
+  ASSERT_FALSE(Uci::parsePosition("fen not a fen", position));
+  ASSERT_EQ(position.current_player, Team::BLACK);
+}
+
+TEST(UciTest, ParsingGo) {
+  const SearchLimits limits = Uci::parseGo(" wtime 1000 btime 2000 winc 10 binc 20 movestogo 5 nodes 300");
+  ASSERT_EQ(limits.wtime, 1000);
+  ASSERT_EQ(limits.btime, 2000);
+  ASSERT_EQ(limits.winc, 10);
+  ASSERT_EQ(limits.binc, 20);
+  ASSERT_EQ(limits.movestogo, 5);
+  ASSERT_EQ(limits.nodes, 300);
+  ASSERT_FALSE(limits.infinite);
+
+  ASSERT_EQ(Uci::parseGo("depth 7").depth, 7);
+  ASSERT_EQ(Uci::parseGo("movetime 50").movetime, 50);
+  ASSERT_TRUE(Uci::parseGo("infinite").infinite);
+  const SearchLimits ponder = Uci::parseGo("ponder wtime 1000 btime 2000");
+  ASSERT_TRUE(ponder.ponder);
+  ASSERT_FALSE(ponder.infinite);
+  ASSERT_EQ(ponder.wtime, 1000);
+}
+
+TEST(UciTest, MateAndStalemateScores) {
+  SearchStats stats = SearchStats();
+
+  // mate in 1 for white
+  const Board mate_board = Board(Fen::buildFenFromStr("6k1/5ppp/8/8/8/8/5PPP/R5K1 w - - 0 1"));
+  const SearchResult mate = MinMaxSearch(mate_board, 3, Team::WHITE, stats, nullptr);
+  ASSERT_TRUE(isMateScore(mate.score));
+  ASSERT_EQ(mateInMoves(mate.score, Team::WHITE), 1);
+  ASSERT_EQ(Uci::scoreAsUci(mate.score, Team::WHITE), "mate 1");
+  ASSERT_EQ(Uci::scoreAsUci(mate.score, Team::BLACK), "mate -1");
+  ASSERT_EQ(Print::move_as_uci(mate.best_move.data), "a1a8");
+
+  // black is stalemated
+  const Board stalemate_board = Board(Fen::buildFenFromStr("7k/5Q2/6K1/8/8/8/8/8 b - - 0 1"));
+  const SearchResult stalemate = MinMaxSearch(stalemate_board, 3, Team::BLACK, stats, nullptr);
+  ASSERT_FALSE(stalemate.best_move.has_value());
+  ASSERT_EQ(stalemate.score, 0);
+}
+
+TEST(UciTest, UciLoopAnswersCommands) {
+  // "quit" stops the search right away, but the first depth is always finished and reported
+  std::istringstream in("isready\nposition startpos moves e2e4\ngo depth 2\nquit\n");
+  std::ostringstream out;
+  Uci::uciLoop(in, out, "uci");
+
+  const std::string output = out.str();
+  ASSERT_NE(output.find("uciok"), std::string::npos);
+  ASSERT_NE(output.find("readyok"), std::string::npos);
+  ASSERT_NE(output.find("info depth 1"), std::string::npos);
+  ASSERT_NE(output.find("bestmove "), std::string::npos);
+}
+
+TEST(UciTest, PonderhitContinuesWithTheClock) {
+  using std::chrono::milliseconds;
+  // with a minute on the clock the search after "ponderhit" takes much longer than the wait until "isready", so the
+  // best move is only sent after the input ends and the search gets stopped
+  DelayedInput long_clock = DelayedInput({{milliseconds(0), "position startpos moves e2e4\n"},
+                                          {milliseconds(0), "go ponder wtime 60000 btime 60000\n"},
+                                          {milliseconds(100), "ponderhit\n"},
+                                          {milliseconds(100), "isready\n"}});
+  std::istream long_in(&long_clock);
+  std::ostringstream long_out;
+  Uci::uciLoop(long_in, long_out);
+  const std::string long_output = long_out.str();
+  ASSERT_NE(long_output.find("bestmove "), std::string::npos);
+  ASSERT_LT(long_output.find("readyok"), long_output.find("bestmove "));
+
+  // with a short movetime the search stops by itself after "ponderhit", which it would never do while pondering
+  DelayedInput short_clock = DelayedInput({{milliseconds(0), "position startpos moves e2e4\n"},
+                                           {milliseconds(0), "go ponder movetime 100\n"},
+                                           {milliseconds(100), "ponderhit\n"},
+                                           {milliseconds(1000), "isready\n"}});
+  std::istream short_in(&short_clock);
+  std::ostringstream short_out;
+  Uci::uciLoop(short_in, short_out);
+  const std::string short_output = short_out.str();
+  ASSERT_NE(short_output.find("bestmove "), std::string::npos);
+  ASSERT_LT(short_output.find("bestmove "), short_output.find("readyok"));
+}
@@ -0,0 +1,132 @@
+//
+// Created by timap on 18.10.2026.
+//
+
+#pragma once
+
+#include <cstdint>
+#include <ostream>
+#include <string>
+#include <vector>
+
+/**
+ * @brief measures the perft, bench and primitive workloads and compares them against a stored baseline
+ *
+ * @note every workload is measured several times, and only the median and the median absolute deviation (MAD) of
+ * those repetitions are kept, so that a single outlier (e.g. another process waking up) does not count as regression
+ */
+namespace PerfRegression {
+/**
+ * @brief the result of measuring one workload
+ */
+struct Metric {
+  /**
+   * @brief the unique name of the workload (e.g. "getAllPossibleMoves")
+   */
+  std::string name;
+  /**
+   * @brief the unit of median and mad (e.g. "ns/op" or "nodes/s")
+   */
+  std::string unit;
+  /**
+   * @brief true if a larger value is better (e.g. for nodes/s), false otherwise (e.g. for ns/op)
+   */
+  bool higher_is_better = false;
+  /**
+   * @brief a regression of a gated metric makes the whole comparison fail
+   */
+  bool gated = false;
+  /**
+   * @brief the median over all repetitions
+   */
+  double median = 0;
+  /**
+   * @brief the median absolute deviation over all repetitions
+   */
+  double mad = 0;
+  /**
+   * @brief the amount of searched nodes, or 0 if the workload does not search
+   * @note deterministic, so any difference to the baseline means the search itself changed
+   */
+  uint64_t nodes = 0;
+};
+
+/**
+ * @brief a full measurement of all workloads together with where it was measured
+ */
+struct Report {
+  /**
+   * @brief the git commit the measured binary was built from
+   */
+  std::string commit;
+  /**
+   * @brief the compiler the measured binary was built with
+   */
+  std::string compiler;
+  /**
+   * @brief the measured workloads
+   */
+  std::vector<Metric> metrics;
+};
+
+/**
+ * @brief settings for measuring and comparing
+ */
+struct Settings {
+  /**
+   * @brief how often each workload is measured
+   */
+  int repetitions = 5;
+  /**
+   * @brief the percentage a gated metric may get worse before it counts as regression
+   */
+  double threshold_percent = 10;
+  /**
+   * @brief a difference has to be larger than this many MADs to not be noise
+   */
+  double noise_mads = 3;
+  /**
+   * @brief the search depth of the bench workload
+   */
+  int bench_depth = 4;
+  /**
+   * @brief the depth of the perft workload
+   */
+  int perft_depth = 3;
+};
+
+/**
+ * @brief measures all workloads
+ * @param settings the settings to measure with
+ * @return the measured report with commit and compiler of this binary
+ */
+Report measure(const Settings& settings);
+
+/**
+ * @brief writes the report as JSON
+ * @param report the report to be written
+ * @param path the file to write to (gets overwritten)
+ * @return true if the file could be written
+ */
+bool writeJson(const Report& report, const std::string& path);
+
+/**
+ * @brief reads a report previously written by writeJson()
+ * @param path the file to read
+ * @param report the report to read into
+ * @return true if the file could be read, false otherwise
+ * @note only understands the format written by writeJson(), it is not a general JSON parser
+ */
+bool readJson(const std::string& path, Report& report);
+
+/**
+ * @brief compares the current report against the baseline and prints one line per metric
+ *
+ * @param baseline the stored baseline
+ * @param current the newly measured report
+ * @param settings the thresholds to compare with
+ * @param os the output stream to print to
+ * @return true if no gated metric regressed and all node counts are unchanged, false otherwise
+ */
+bool compare(const Report& baseline, const Report& current, const Settings& settings, std::ostream& os);
+}  // namespace PerfRegression
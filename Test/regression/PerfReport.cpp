@@ -0,0 +1,173 @@
+//
+// Created by timap on 18.10.2026.
+//
+#include <algorithm>
+#include <cstdio>
+#include <fstream>
+#include <iomanip>
+#include <string>
+
+#include "PerfRegression.h"
+
+/**
+ * @brief the factor to turn a MAD into an estimate of the standard deviation for normally distributed samples
+ */
+constexpr double mad_to_std_deviation = 1.4826;
+
+/**
+ * @brief escapes a string for the use inside a JSON string
+ * @param str the string to escape
+ * @return the escaped string without the surrounding quotes
+ */
+static std::string escapeJson(const std::string& str) {
+  std::string result;
+  for (char ch : str) {
+    if (ch == '"' || ch == '\\') result.push_back('\\');
+    result.push_back(ch);
+  }
+  return result;
+}
+
+/**
+ * @brief finds the value of a string field inside one line of JSON
+ * @param line the line to search in
+ * @param key the name of the field
+ * @param value set to the unescaped value if the field is found
+ * @return true if the field is found, false otherwise
+ */
+static bool findString(const std::string& line, const std::string& key, std::string& value) {
+  const std::string pattern = "\"" + key + "\": \"";
+  size_t idx = line.find(pattern);
+  if (idx == std::string::npos) return false;
+
+  value.clear();
+  for (idx += pattern.size(); idx < line.size() && line[idx] != '"'; ++idx) {
+    if (line[idx] == '\\' && idx + 1 < line.size()) ++idx;
+    value.push_back(line[idx]);
+  }
+  return true;
+}
+
+/**
+ * @brief finds the value of a number or boolean field inside one line of JSON
+ * @param line the line to search in
+ * @param key the name of the field
+ * @param value set to the value if the field is found (booleans are 0 and 1)
+ * @return true if the field is found, false otherwise
+ */
+static bool findNumber(const std::string& line, const std::string& key, double& value) {
+  const std::string pattern = "\"" + key + "\": ";
+  const size_t idx = line.find(pattern);
+  if (idx == std::string::npos) return false;
+
+  const std::string rest = line.substr(idx + pattern.size());
+  if (rest.rfind("true", 0) == 0) {
+    value = 1;
+  } else if (rest.rfind("false", 0) == 0) {
+    value = 0;
+  } else {
+    try {
+      value = std::stod(rest);
+    } catch (const std::exception&) {
+      return false;
+    }
+  }
+  return true;
+}
+
+namespace PerfRegression {
+
+// (function documentation is provided in the corresponding header)
+bool writeJson(const Report& report, const std::string& path) {
+  std::ofstream file(path);
+  if (!file.good()) return false;
+
+  // one metric per line, which keeps diffs of the stored baseline readable and reading it back simple
+  file << std::setprecision(10);
+  file << "{\n";
+  file << "  \"commit\": \"" << escapeJson(report.commit) << "\",\n";
+  file << "  \"compiler\": \"" << escapeJson(report.compiler) << "\",\n";
+  file << "  \"metrics\": [\n";
+  for (size_t i = 0; i < report.metrics.size(); ++i) {
+    const Metric& metric = report.metrics[i];
+    file << "    {\"name\": \"" << escapeJson(metric.name) << "\", \"unit\": \"" << escapeJson(metric.unit)
+         << "\", \"higher_is_better\": " << (metric.higher_is_better ? "true" : "false")
+         << ", \"gated\": " << (metric.gated ? "true" : "false") << ", \"median\": " << metric.median
+         << ", \"mad\": " << metric.mad << ", \"nodes\": " << metric.nodes << "}"
+         << (i + 1 < report.metrics.size() ? "," : "") << "\n";
+  }
+  file << "  ]\n";
+  file << "}\n";
+  return file.good();
+}
+
+// (function documentation is provided in the corresponding header)
+bool readJson(const std::string& path, Report& report) {
+  std::ifstream file(path);
+  if (!file.good()) return false;
+
+  report = Report();
+  std::string line;
+  while (std::getline(file, line)) {
+    Metric metric = Metric();
+    double number = 0;
+    if (findString(line, "name", metric.name)) {
+      findString(line, "unit", metric.unit);
+      if (findNumber(line, "higher_is_better", number)) metric.higher_is_better = number != 0;
+      if (findNumber(line, "gated", number)) metric.gated = number != 0;
+      if (!findNumber(line, "median", metric.median) || !findNumber(line, "mad", metric.mad)) return false;
+      if (findNumber(line, "nodes", number)) metric.nodes = static_cast<uint64_t>(number);
+      report.metrics.push_back(metric);
+    } else if (!findString(line, "commit", report.commit)) {
+      findString(line, "compiler", report.compiler);
+    }
+  }
+  return !report.metrics.empty();
+}
+
+// (function documentation is provided in the corresponding header)
+bool compare(const Report& baseline, const Report& current, const Settings& settings, std::ostream& os) {
+  bool passed = true;
+  os << "baseline: " << baseline.commit << " (" << baseline.compiler << ")\n";
+  os << "current : " << current.commit << " (" << current.compiler << ")\n";
+  os << std::fixed << std::setprecision(1);
+
+  for (const Metric& metric : current.metrics) {
+    os << std::left << std::setw(22) << metric.name << std::right;
+
+    auto base_it = std::find_if(baseline.metrics.begin(), baseline.metrics.end(),
+                                [&](const Metric& base) { return base.name == metric.name; });
+    if (base_it == baseline.metrics.end() || base_it->median <= 0) {
+      os << std::setw(14) << metric.median << " " << metric.unit << "  NEW (not in baseline)\n";
+      continue;
+    }
+    const Metric& base = *base_it;
+
+    // positive means worse, independent of whether higher or lower values are better
+    const double worse_percent = (metric.higher_is_better ? base.median - metric.median : metric.median - base.median) /
+                                 base.median * 100;
+    const double noise_percent =
+        settings.noise_mads * mad_to_std_deviation * std::max(base.mad, metric.mad) / base.median * 100;
+    const bool regressed = worse_percent > settings.threshold_percent && worse_percent > noise_percent;
+
+    os << std::setw(14) << base.median << " -> " << std::setw(14) << metric.median << " " << std::left
+       << std::setw(8) << metric.unit << std::right << std::showpos << std::setw(7) << -worse_percent << "%"
+       << std::noshowpos << " (noise +-" << noise_percent << "%)  ";
+
+    if (base.nodes != metric.nodes) {
+      os << "NODES CHANGED (" << base.nodes << " -> " << metric.nodes << ")\n";
+      passed = false;
+    } else if (regressed && metric.gated) {
+      os << "REGRESSION\n";
+      passed = false;
+    } else if (regressed) {
+      os << "slower (not gated)\n";
+    } else if (-worse_percent > noise_percent) {
+      os << "faster\n";
+    } else {
+      os << "ok\n";
+    }
+  }
+  return passed;
+}
+}  // namespace PerfRegression
@@ -0,0 +1,154 @@
+//
+// Created by timap on 18.10.2026.
+//
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "../../src/Bot/Bench/Bench.h"
+#include "../../src/Bot/Evaluation/Evaluate.h"
+#include "../../src/Check/Check.h"
+#include "../../src/Perft/Perft.h"
+#include "../../src/PossibleMoves/PossibleMoves.h"
+#include "../benchmark/BenchmarkCorpus.h"
+#include "PerfRegression.h"
+
+#ifndef PERF_GIT_COMMIT
+#define PERF_GIT_COMMIT "unknown"
+#endif
+
+/**
+ * @brief the minimum time a single repetition of a primitive workload runs for
+ * @note short enough to keep the whole run fast, long enough for the clock resolution to not matter
+ */
+constexpr std::chrono::milliseconds min_repetition_time = std::chrono::milliseconds(200);
+
+/**
+ * @brief written to by all workloads, so that the compiler can not optimize them away
+ */
+static volatile uint64_t sink = 0;
+
+/**
+ * @brief calculates the median and MAD of the samples and stores them in the metric
+ * @param samples the measured value of each repetition (gets reordered)
+ * @param metric the metric to store median and mad in
+ */
+static void summarize(std::vector<double>& samples, PerfRegression::Metric& metric) {
+  std::sort(samples.begin(), samples.end());
+  const size_t mid = samples.size() / 2;
+  metric.median = samples.size() % 2 ? samples[mid] : (samples[mid - 1] + samples[mid]) / 2;
+
+  std::vector<double> deviations;
+  for (double sample : samples) deviations.push_back(std::abs(sample - metric.median));
+  std::sort(deviations.begin(), deviations.end());
+  metric.mad = deviations.size() % 2 ? deviations[mid] : (deviations[mid - 1] + deviations[mid]) / 2;
+}
+
+/**
+ * @brief measures a primitive operation on every position of the corpus
+ *
+ * @param name the name of the metric
+ * @param gated whether a regression of this metric should fail the comparison
+ * @param settings the amount of repetitions to measure
+ * @param operation called with each position, returns a value that gets added to the sink
+ * @return the measured time per operation in ns/op
+ */
+template <typename fn>
+static PerfRegression::Metric measurePrimitive(const char* name, bool gated, const PerfRegression::Settings& settings,
+                                               fn operation) {
+  const std::vector<BenchmarkCorpus::Position>& positions = BenchmarkCorpus::positions();
+  PerfRegression::Metric metric = {name, "ns/op", false, gated};
+
+  std::vector<double> samples;
+  for (int rep = 0; rep < settings.repetitions; ++rep) {
+    uint64_t amount_ops = 0;
+    uint64_t sum = 0;
+    const auto start = std::chrono::steady_clock::now();
+    auto elapsed = std::chrono::steady_clock::duration::zero();
+    while (elapsed < min_repetition_time) {
+      for (const BenchmarkCorpus::Position& position : positions) sum += operation(position);
+      amount_ops += positions.size();
+      elapsed = std::chrono::steady_clock::now() - start;
+    }
+    sink = sink + sum;
+    const double elapsed_ns = static_cast<double>(std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed).count());
+    samples.push_back(elapsed_ns / static_cast<double>(amount_ops));
+  }
+  summarize(samples, metric);
+  return metric;
+}
+
+/**
+ * @brief measures perft over all positions of the perft dataset
+ * @param settings the depth and amount of repetitions to measure
+ * @return the measured speed in nodes/s
+ */
+static PerfRegression::Metric measurePerft(const PerfRegression::Settings& settings) {
+  const std::vector<BenchmarkCorpus::Position>& positions = BenchmarkCorpus::perftPositions();
+  // the depth is part of the name, so that only measurements with the same depth get compared
+  PerfRegression::Metric metric = {"perft(depth " + std::to_string(settings.perft_depth) + ")", "nodes/s", true, false};
+
+  std::vector<double> samples;
+  for (int rep = 0; rep < settings.repetitions; ++rep) {
+    uint64_t nodes = 0;
+    const auto start = std::chrono::steady_clock::now();
+    for (const BenchmarkCorpus::Position& position : positions) {
+      nodes += Perft::perft(position.board, settings.perft_depth, position.current_player);
+    }
+    const std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+    samples.push_back(static_cast<double>(nodes) / elapsed.count());
+    metric.nodes = nodes;
+  }
+  summarize(samples, metric);
+  return metric;
+}
+
+/**
+ * @brief measures the search speed with the bench positions
+ * @param settings the depth and amount of repetitions to measure
+ * @return the measured search speed in nodes/s
+ */
+static PerfRegression::Metric measureBench(const PerfRegression::Settings& settings) {
+  PerfRegression::Metric metric = {"search(depth " + std::to_string(settings.bench_depth) + ")", "nodes/s", true, true};
+
+  std::vector<double> samples;
+  for (int rep = 0; rep < settings.repetitions; ++rep) {
+    std::ostringstream ignored_output;
+    const Bench::BenchResult result = Bench::runBench(settings.bench_depth, ignored_output);
+    samples.push_back(static_cast<double>(result.nodesPerSecond()));
+    metric.nodes = result.nodes;
+  }
+  summarize(samples, metric);
+  return metric;
+}
+
+namespace PerfRegression {
+
+// (function documentation is provided in the corresponding header)
+Report measure(const Settings& settings) {
+  Report report = {PERF_GIT_COMMIT, __VERSION__, {}};
+
+  std::vector<Move> move_list;
+  report.metrics.push_back(
+      measurePrimitive("getAllPossibleMoves", true, settings, [&](const BenchmarkCorpus::Position& position) {
+        move_list.clear();
+        PossibleMoves::getAllPossibleMoves(position.board, move_list, position.current_player);
+        return move_list.size();
+      }));
+  report.metrics.push_back(
+      measurePrimitive("isChecked", true, settings, [](const BenchmarkCorpus::Position& position) {
+        const Team::Team player = position.current_player;
+        return static_cast<uint64_t>(Check::isChecked(position.board, player, position.board.positions.getKingPos(player)));
+      }));
+  report.metrics.push_back(
+      measurePrimitive("evaluateBoard", false, settings, [](const BenchmarkCorpus::Position& position) {
+        return static_cast<uint64_t>(evaluateBoard(position.board, position.current_player));
+      }));
+  report.metrics.push_back(measurePerft(settings));
+  report.metrics.push_back(measureBench(settings));
+  return report;
+}
+}  // namespace PerfRegression
@@ -0,0 +1,85 @@
+//
+// Created by timap on 18.10.2026.
+//
+#include <iostream>
+#include <string>
+#include <string_view>
+
+#include "../Main_Folder_Path_For_Testing.h"
+#include "PerfRegression.h"
+
+/**
+ * @brief prints how to use the program
+ */
+static void printUsage() {
+  std::cout << "usage: ./PerfRegression [options]\n"
+               "  --baseline FILE      the baseline to compare against (default: Test/regression/baseline.json)\n"
+               "  --out FILE           where to write the new measurement (default: perf_result.json)\n"
+               "  --update-baseline    store the new measurement as baseline instead of comparing\n"
+               "  --repetitions N      how often each workload is measured (default: 5)\n"
+               "  --threshold PERCENT  how much worse a gated metric may get (default: 10)\n"
+               "  --bench-depth N      the search depth of the search workload (default: 4)\n"
+               "  --perft-depth N      the depth of the perft workload (default: 3)\n";
+}
+
+int main(int argc, char** argv) {
+  PerfRegression::Settings settings = PerfRegression::Settings();
+  std::string baseline_path = main_folder_path + "/Test/regression/baseline.json";
+  std::string out_path = "perf_result.json";
+  bool update_baseline = false;
+
+  for (int i = 1; i < argc; ++i) {
+    const std::string_view arg = argv[i];
+    const bool has_value = i + 1 < argc;
+    try {
+      if (arg == "--update-baseline") {
+        update_baseline = true;
+      } else if (arg == "--baseline" && has_value) {
+        baseline_path = argv[++i];
+      } else if (arg == "--out" && has_value) {
+        out_path = argv[++i];
+      } else if (arg == "--repetitions" && has_value) {
+        settings.repetitions = std::max(1, std::stoi(argv[++i]));
+      } else if (arg == "--threshold" && has_value) {
+        settings.threshold_percent = std::stod(argv[++i]);
+      } else if (arg == "--bench-depth" && has_value) {
+        settings.bench_depth = std::max(1, std::stoi(argv[++i]));
+      } else if (arg == "--perft-depth" && has_value) {
+        settings.perft_depth = std::max(1, std::stoi(argv[++i]));
+      } else {
+        printUsage();
+        return 2;
+      }
+    } catch (const std::exception&) {
+      printUsage();
+      return 2;
+    }
+  }
+
+  const PerfRegression::Report report = PerfRegression::measure(settings);
+
+  const std::string& write_path = update_baseline ? baseline_path : out_path;
+  if (!PerfRegression::writeJson(report, write_path)) {
+    std::cerr << "unable to write " << write_path << std::endl;
+    return 2;
+  }
+  std::cout << "measurement written to " << write_path << std::endl;
+  if (update_baseline) return 0;
+
+  PerfRegression::Report baseline;
+  if (!PerfRegression::readJson(baseline_path, baseline)) {
+    std::cerr << "unable to read the baseline " << baseline_path << " (create one with --update-baseline)"
+              << std::endl;
+    return 2;
+  }
+
+  if (!PerfRegression::compare(baseline, report, settings, std::cout)) {
+    std::cerr << "\n"
+                 "############################################################\n"
+                 "#  PERFORMANCE REGRESSION: see the lines marked above      #\n"
+                 "############################################################\n";
+    return 1;
+  }
+  std::cout << "no performance regression" << std::endl;
+  return 0;
+}
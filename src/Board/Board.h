@@ -7,6 +7,7 @@
 #include "../IO/Parser/FenParsing.h"
 #include "../IO/Parser/FenParsingException.h"
 #include "../IO/Print/Print.h"
+#include "../Profiling/Profiler.h"
 #include "Board_Correctness.h"
 #include "Board_impl/Board_8x8.h"
 #include "Board_impl/Board_Extra.h"
@@ -54,6 +55,18 @@ class Board {
 #ifndef NO_ASSERTS
     const bool equal = positions_equals_grid(grid, positions);
     assert(equal);
+#endif
+  }
+  /**
+   * @brief a constructor that takes an already built grid and the extra data
+   * @param grid a legal grid (e.g. from unpacking a position)
+   * @param extra the castling rights and the en passant position fitting to the grid
+   */
+  constexpr explicit Board(const Board_8x8& grid, Board_Extra extra) noexcept
+      : grid(grid), extra(extra), positions(Board_Positions(this->grid)) {
+#ifndef NO_ASSERTS
+    const bool equal = positions_equals_grid(this->grid, positions);
+    assert(equal);
 #endif
   }
   // getters
@@ -74,7 +87,8 @@ class Board {
    * @note does not check if the move are actually valid
    * @return: the executed move for later undoing of the currently made move
    */
-  constexpr ExecutedMove movePiece(Move move) {
+  PROFILING_CONSTEXPR ExecutedMove movePiece(Move move) {
+    PROFILE_ZONE(MOVE_PIECE);
     ExecutedMove executed_move = ExecutedMove();
     executed_move.move = move;
     executed_move.extra = this->extra;
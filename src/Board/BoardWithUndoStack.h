@@ -0,0 +1,65 @@
+//
+// Created by timap on 18.10.2026.
+//
+
+#pragma once
+
+#include <cassert>
+
+#include "Board.h"
+
+/**
+ * @brief the maximum amount of moves that can be undone with a BoardWithUndoStack
+ */
+#define UNDO_STACK_SIZE 128
+
+/**
+ * @brief a Chess Board that remembers the executed moves itself, so that they can be undone without the caller having
+ * to keep the executed moves around
+ *
+ * @note mainly exists to compare this way of undoing moves with copying the board and with undoing through
+ * ExecutedMove (see MakeMovePolicy.h)
+ */
+class BoardWithUndoStack : public Board {
+ private:
+  /**
+   * @brief the executed moves that can still be undone with the last executed move on top
+   */
+  ExecutedMove undo_stack[UNDO_STACK_SIZE];
+  /**
+   * @brief the amount of moves on the undo stack
+   */
+  int stack_size = 0;
+
+ public:
+  /**
+   * @brief constructs the board with an empty undo stack
+   * @param board the board state to start from
+   */
+  constexpr explicit BoardWithUndoStack(const Board& board) noexcept : Board(board) {}
+
+  /**
+   * @brief executes the given move and pushes it onto the undo stack
+   * @param move the move to be executed
+   * @note does not check if the move is actually valid
+   */
+  PROFILING_CONSTEXPR void pushMove(Move move) {
+#ifndef NO_ASSERTS
+    assert(stack_size < UNDO_STACK_SIZE);
+#endif
+    undo_stack[stack_size] = movePiece(move);
+    stack_size++;
+  }
+
+  /**
+   * @brief undoes the last move pushed onto the undo stack
+   * @note undefined behaviour if the undo stack is empty
+   */
+  constexpr void popMove() {
+#ifndef NO_ASSERTS
+    assert(stack_size > 0);
+#endif
+    stack_size--;
+    undoMove(undo_stack[stack_size]);
+  }
+};
@@ -72,6 +72,18 @@ class Board_8x8 {
     }
   }
   // setters
+  /**
+   * @brief puts a piece on a square, without moving or removing any other piece
+   * @param i the index of the square
+   * @param piece the piece to put on the square (can be empty)
+   * @note only meant for building up a board (e.g. when unpacking a position), does not keep a Board_Positions in sync
+   */
+  constexpr inline void setPiece(int i, Piece piece) noexcept {
+#ifndef NO_BOUNDS_CHECKS
+    assert(i >= 0 && i < 64);
+#endif
+    board[i] = piece;
+  }
   // direct access operator
   /**
    * @brief direct access to the underlying array of Pieces
@@ -415,6 +415,23 @@ class Board_Positions {
     return amount;
   }
 
+  /**
+   * @brief the raw positions of both teams, for code that handles all pieces of a board at once (e.g. with SIMD)
+   * @return the positions of each team, grouped by PieceType in ascending order (see getAllEnds())
+   *
+   * @note the entries after the last piece of a team are unspecified
+   */
+  [[nodiscard]] constexpr const int8_t (&getAllPositions() const noexcept)[TEAM_AMOUNT][PIECES_PER_TEAM] {
+    return positions;
+  }
+
+  /**
+   * @brief the raw boundaries of both teams, for code that handles all pieces of a board at once (e.g. with SIMD)
+   * @return the first index after the positions of each PieceType in getAllPositions() (the entry of PieceType::NONE is
+   * always 0)
+   */
+  [[nodiscard]] constexpr const int8_t (&getAllEnds() const noexcept)[TEAM_AMOUNT][PIECETYPE_AMOUNT] { return ends; }
+
   /**
    * @brief function to test for existence of a specific Piece on the board
    * @param team the team of the piece for the calculation
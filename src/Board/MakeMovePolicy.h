@@ -0,0 +1,83 @@
+//
+// Created by timap on 18.10.2026.
+//
+
+#pragma once
+
+#include "Board.h"
+#include "BoardWithUndoStack.h"
+
+/**
+ * @brief the different ways a search can get from a board to the board of a child node and back
+ *
+ * each policy has: \n
+ * - BoardType: the type of board the search works on \n
+ * - name: a short name for printing and benchmarks \n
+ * - withMove(board, move, forChild): calls forChild with the board after move and returns its result,
+ * with board being unchanged afterwards
+ *
+ * @note the policy used by MinMax is chosen at build time by defining either SEARCH_POLICY_UNDO_MOVE or
+ * SEARCH_POLICY_UNDO_STACK, otherwise CopyMake is used \n
+ * undoing a capture or promotion restores the same pieces, but not necessarily their order inside Board_Positions,
+ * so the undo based policies can generate moves in a different order than CopyMake (same perft, but alpha-beta
+ * can cut off different nodes)
+ */
+namespace MakeMovePolicy {
+/**
+ * @brief copies the whole board for every child node, meaning nothing ever has to be undone
+ */
+struct CopyMake {
+  using BoardType = Board;
+  static constexpr const char* name = "CopyMake";
+
+  template <typename fn>
+  static inline auto withMove(const Board& board, Move move, fn forChild) {
+    Board child = board;
+    child.movePiece(move);
+    return forChild(child);
+  }
+};
+
+/**
+ * @brief executes the move on the board itself and undoes it afterwards with the returned ExecutedMove
+ */
+struct UndoMove {
+  using BoardType = Board;
+  static constexpr const char* name = "UndoMove";
+
+  template <typename fn>
+  static inline auto withMove(Board& board, Move move, fn forChild) {
+    const ExecutedMove executed_move = board.movePiece(move);
+    auto result = forChild(board);
+    board.undoMove(executed_move);
+    return result;
+  }
+};
+
+/**
+ * @brief executes the move on the board itself and undoes it afterwards with the undo stack inside the board
+ */
+struct UndoStack {
+  using BoardType = BoardWithUndoStack;
+  static constexpr const char* name = "UndoStack";
+
+  template <typename fn>
+  static inline auto withMove(BoardWithUndoStack& board, Move move, fn forChild) {
+    board.pushMove(move);
+    auto result = forChild(board);
+    board.popMove();
+    return result;
+  }
+};
+}  // namespace MakeMovePolicy
+
+#if defined(SEARCH_POLICY_UNDO_MOVE)
+using DefaultMakeMovePolicy = MakeMovePolicy::UndoMove;
+#elif defined(SEARCH_POLICY_UNDO_STACK)
+using DefaultMakeMovePolicy = MakeMovePolicy::UndoStack;
+#else
+/**
+ * @brief the policy used by MinMax (chosen at build time)
+ */
+using DefaultMakeMovePolicy = MakeMovePolicy::CopyMake;
+#endif
@@ -0,0 +1,148 @@
+//
+// Created by timap on 18.10.2026.
+//
+#include "Batch.h"
+
+#include <algorithm>
+#include <chrono>
+#include <memory>
+#include <string_view>
+#include <thread>
+
+#include "../../IO/Parser/EpdParsing.h"
+#include "../../IO/Print/Print.h"
+#include "../../IO/Uci/Uci.h"
+#include "../Evaluation/Evaluate.h"
+#include "../Search/Search.h"
+#include "ParallelRunner.h"
+
+/**
+ * @brief converts the message of an exception to a single line
+ * @param message the message, which can contain line breaks
+ * @return the message with spaces instead of line breaks
+ */
+static std::string singleLine(std::string message) {
+  std::replace(message.begin(), message.end(), '\n', ' ');
+  return message;
+}
+
+/**
+ * @brief analyzes a single position
+ *
+ * @param tt the transposition table of the current thread
+ * @param job the line with the position
+ * @param options how the position gets analyzed
+ * @return the result line (without the line break)
+ */
+static std::string analyzePosition(TranspositionTable& tt, const Batch::InputLine& job,
+                                   const Batch::BatchOptions& options) {
+  std::string id = std::to_string(job.line_number);
+  try {
+    const EpdRecord record = Epd::parseLine(job.line);
+    if (const std::string* id_operand = record.findOperand("id")) id = *id_operand;
+    const Fen fen = Fen::buildFenFromStr(record.fen);
+    const Board board = Board(fen);
+    const Team::Team player = fen.current_player;
+
+    const auto start = std::chrono::steady_clock::now();
+    std::string best_move = "-";
+    int score = 0;
+    uint64_t nodes = 0;
+    if (options.evaluate_only) {
+      score = evaluateBoard(board, player);
+    } else {
+      SearchLimits limits = SearchLimits();
+      limits.depth = options.depth;
+      limits.nodes = options.nodes;
+      limits.movetime = options.movetime;
+      SearchControl control = SearchControl();
+      Search::applyLimits(control, limits, player);
+      const SearchResult result = Search::iterativeDeepening(
+          board, player, limits, control, [&nodes](const Search::SearchInfo& info) { nodes = info.nodes; }, &tt);
+      if (result.best_move.has_value()) best_move = Print::move_as_uci(result.best_move.data);
+      score = result.score;
+    }
+    const auto time_ms =
+        std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - start).count();
+
+    return id + '\t' + best_move + '\t' + Uci::scoreAsUci(score, player) + '\t' + std::to_string(nodes) + '\t' +
+           std::to_string(time_ms);
+  } catch (const FenParsingException& e) {
+    return id + "\terror\t" + singleLine(e.what());
+  }
+}
+
+namespace Batch {
+
+// (function documentation is provided in the corresponding header)
+bool readPositionLine(std::istream& in, uint64_t& line_number, InputLine& input) {
+  while (std::getline(in, input.line)) {
+    line_number++;
+    if (Epd::isSkippableLine(input.line)) continue;
+    input.line_number = line_number;
+    return true;
+  }
+  return false;
+}
+
+// (function documentation is provided in the corresponding header)
+unsigned threadAmount(unsigned threads) {
+  return threads > 0 ? threads : std::max(1u, std::thread::hardware_concurrency());
+}
+
+// (function documentation is provided in the corresponding header)
+uint64_t runBatch(std::istream& in, std::ostream& out, const BatchOptions& options) {
+  const unsigned threads = threadAmount(options.threads);
+  uint64_t line_number = 0;
+
+  out << "# id\tbestmove\tscore\tnodes\ttime_ms\n";
+  const uint64_t amount = runInParallel<InputLine, std::string>(
+      threads, threads * positions_in_flight_per_thread, options.ordered,
+      [&in, &line_number](InputLine& job) { return readPositionLine(in, line_number, job); },
+      [&options]() { return std::make_unique<TranspositionTable>(options.hash_mb); },
+      [&options](std::unique_ptr<TranspositionTable>& tt, const InputLine& job) {
+        return analyzePosition(*tt, job, options);
+      },
+      [&out](const std::string& result) { out << result << '\n'; });
+  out << std::flush;
+  return amount;
+}
+
+// (function documentation is provided in the corresponding header)
+bool parseBatchArguments(int argc, const char* const* argv, BatchOptions& options, std::string& input_path) {
+  input_path = "-";
+  bool has_input = false;
+  for (int i = 0; i < argc; ++i) {
+    const std::string_view arg = argv[i];
+    const char* value = i + 1 < argc ? argv[i + 1] : nullptr;
+    const OptionResult::OptionResult search_option = parseSearchOption(arg, value, options);
+    if (search_option == OptionResult::INVALID) return false;
+    if (search_option == OptionResult::PARSED) {
+      ++i;
+    } else if (arg == "--eval") {
+      options.evaluate_only = true;
+    } else if (arg == "--unordered") {
+      options.ordered = false;
+    } else if (!has_input && (arg == "-" || arg.rfind("--", 0) != 0)) {
+      input_path = std::string(arg);
+      has_input = true;
+    } else {
+      return false;
+    }
+  }
+  return true;
+}
+
+// (function documentation is provided in the corresponding header)
+void printBatchUsage(std::ostream& os) {
+  os << "usage: ./Chess batch [options] [FILE]\n"
+        "  analyzes every FEN or EPD line of FILE (or stdin if FILE is missing or -)\n"
+        "  --depth N       the search depth (default: 4)\n"
+        "  --nodes N       the maximum nodes per position (default: no limit)\n"
+        "  --movetime MS   the maximum time per position in milliseconds (default: no limit)\n"
+        "  --eval          only evaluate each position instead of searching it\n"
+        "  --threads N     the amount of threads (default: one per core)\n"
+        "  --hash MB       the transposition table size per thread (default: 16, at most 4096)\n"
+        "  --unordered     write each result as soon as it is done instead of in input order\n";
+}
+}  // namespace Batch
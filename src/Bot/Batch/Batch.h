@@ -0,0 +1,181 @@
+//
+// Created by timap on 18.10.2026.
+//
+
+#pragma once
+
+#include <algorithm>
+#include <cstdint>
+#include <istream>
+#include <ostream>
+#include <string>
+#include <string_view>
+
+#include "../../IO/Parser/StringParsing.h"
+#include "../MinMax/SearchTypes.h"
+#include "../TranspositionTable/TranspositionTable.h"
+
+/**
+ * @brief Analysis of many positions from a FEN or EPD file in a single process, spread over all cores.
+ */
+namespace Batch {
+/**
+ * @brief how each position of a batch gets analyzed
+ */
+struct BatchOptions {
+  /**
+   * @brief the search depth (ignored with evaluate_only)
+   */
+  int depth = 4;
+  /**
+   * @brief the maximum amount of nodes per position, 0 for no limit
+   */
+  uint64_t nodes = 0;
+  /**
+   * @brief the maximum time per position in milliseconds, 0 for no limit
+   */
+  int64_t movetime = 0;
+  /**
+   * @brief only evaluate each position with evaluateBoard() instead of searching it
+   */
+  bool evaluate_only = false;
+  /**
+   * @brief the amount of worker threads, 0 for one per core
+   */
+  unsigned threads = 0;
+  /**
+   * @brief the size of the transposition table of each worker thread in megabytes
+   */
+  uint64_t hash_mb = TranspositionTable::default_size_mb;
+  /**
+   * @brief true to write the results in the order of the input, false to write them as soon as they are done
+   * (every result is tagged with the id of its position either way)
+   */
+  bool ordered = true;
+};
+
+/**
+ * @brief the largest amount of worker threads the options allow
+ */
+constexpr unsigned max_threads = 1024;
+
+/**
+ * @brief the namespace holding the OptionResult enum in order to not pollute the main namespace
+ */
+namespace OptionResult {
+/**
+ * @brief what parseSearchOption() did with a command line argument
+ */
+enum OptionResult : uint8_t { UNKNOWN, PARSED, INVALID };
+}  // namespace OptionResult
+
+/**
+ * @brief parses one of the options the batch and the epd mode share (--depth, --nodes, --movetime, --threads and
+ * --hash)
+ *
+ * @tparam Options BatchOptions or SuiteOptions
+ * @param arg the command line argument
+ * @param value the argument after it, nullptr if there is none
+ * @param options the options to set
+ * @return PARSED if arg is one of these options and value was used as its number, UNKNOWN if arg is none of them,
+ * INVALID if the value is missing or not a number (e.g. it has a sign or trailing characters)
+ *
+ * @note numbers above the allowed maximum (e.g. TranspositionTable::max_size_mb for --hash) are reduced to it
+ */
+template <class Options>
+OptionResult::OptionResult parseSearchOption(std::string_view arg, const char* value, Options& options) {
+  const bool is_search_option =
+      arg == "--depth" || arg == "--nodes" || arg == "--movetime" || arg == "--threads" || arg == "--hash";
+  if (!is_search_option) return OptionResult::UNKNOWN;
+
+  uint64_t number = 0;
+  if (value == nullptr) return OptionResult::INVALID;
+  if (arg == "--depth") {
+    if (!parseNumber(value, MAX_SEARCH_PLY - 1, number)) return OptionResult::INVALID;
+    options.depth = std::max(1, static_cast<int>(number));
+  } else if (arg == "--nodes") {
+    if (!parseNumber(value, UINT64_MAX, number)) return OptionResult::INVALID;
+    options.nodes = number;
+  } else if (arg == "--movetime") {
+    if (!parseNumber(value, INT64_MAX, number)) return OptionResult::INVALID;
+    options.movetime = static_cast<int64_t>(number);
+  } else if (arg == "--threads") {
+    if (!parseNumber(value, max_threads, number)) return OptionResult::INVALID;
+    options.threads = static_cast<unsigned>(number);
+  } else {
+    if (!parseNumber(value, TranspositionTable::max_size_mb, number)) return OptionResult::INVALID;
+    options.hash_mb = std::max<uint64_t>(1, number);
+  }
+  return OptionResult::PARSED;
+}
+
+/**
+ * @brief the maximum amount of positions per worker thread that are read but not yet written
+ */
+constexpr uint64_t positions_in_flight_per_thread = 4;
+
+/**
+ * @brief a line of the input that contains a position
+ */
+struct InputLine {
+  /**
+   * @brief the number of the line in the input (starting with 1), used as id if the position has none
+   */
+  uint64_t line_number = 0;
+  /**
+   * @brief the line with the position
+   */
+  std::string line;
+};
+
+/**
+ * @brief reads the next line with a position (i.e. skips empty lines and comments)
+ *
+ * @param in the FEN or EPD lines
+ * @param line_number the number of the last read line, gets increased for every read line
+ * @param input set to the read line
+ * @return false if there are no more positions
+ */
+bool readPositionLine(std::istream& in, uint64_t& line_number, InputLine& input);
+
+/**
+ * @param threads the requested amount of threads, 0 for one per core
+ * @return the amount of worker threads to use (at least 1)
+ */
+unsigned threadAmount(unsigned threads);
+
+/**
+ * @brief reads positions (one FEN or EPD line each) and writes one result line per position
+ *
+ * @param in the positions, empty lines and lines starting with '#' are skipped
+ * @param out gets a header line and then one tab separated line per position: the id (the EPD "id" operation, or
+ * the line number), the best move in UCI notation, the score from the view of the player to move ("cp 35" or
+ * "mate 3"), the searched nodes and the time in milliseconds \n
+ * (positions that can not be parsed get "error" and the reason instead)
+ * @param options how the positions get analyzed
+ * @return the amount of positions
+ *
+ * @note reads the input while the positions are searched, and only keeps a few positions per thread in memory,
+ * so arbitrarily large inputs can be analyzed. Each thread keeps its transposition table between its positions
+ */
+uint64_t runBatch(std::istream& in, std::ostream& out, const BatchOptions& options);
+
+/**
+ * @brief parses the command line arguments of the batch mode
+ *
+ * @param argc the amount of arguments
+ * @param argv the arguments, starting with the first argument after "batch"
+ * @param options the options to set
+ * @param input_path set to the input file, or "-" for stdin
+ * @return false if the arguments are invalid (e.g. an unknown option, or a number with a sign or trailing characters)
+ *
+ * @note the search options are parsed with parseSearchOption()
+ */
+bool parseBatchArguments(int argc, const char* const* argv, BatchOptions& options, std::string& input_path);
+
+/**
+ * @brief prints how to use the batch mode
+ * @param os the stream to print to
+ */
+void printBatchUsage(std::ostream& os);
+}  // namespace Batch
@@ -0,0 +1,249 @@
+//
+// Created by timap on 18.10.2026.
+//
+#include "EpdSuite.h"
+
+#include <algorithm>
+#include <chrono>
+#include <iomanip>
+#include <memory>
+#include <string_view>
+#include <vector>
+
+#include "../../IO/Parser/EpdParsing.h"
+#include "../../IO/Parser/SanParsing.h"
+#include "../../IO/Print/Print.h"
+#include "../Search/Search.h"
+#include "Batch.h"
+#include "ParallelRunner.h"
+
+/**
+ * @brief the outcome of a single position of the suite
+ */
+struct SuiteResult {
+  /**
+   * @brief the id of the position (the EPD "id" operation, or the line number)
+   */
+  std::string id;
+  /**
+   * @brief the position could not be checked, error holds the reason
+   */
+  bool is_error = false;
+  /**
+   * @brief the found move is a "bm" move and not an "am" move
+   */
+  bool solved = false;
+  /**
+   * @brief the found move in UCI notation, or the reason of the error
+   */
+  std::string text;
+  /**
+   * @brief the expected moves as given in the EPD line, e.g. "bm Qg6" or "am Bxh7"
+   */
+  std::string expected;
+  /**
+   * @brief the time until the search found the solution and kept it for every deeper depth in milliseconds
+   */
+  int64_t solution_time_ms = 0;
+  /**
+   * @brief the nodes until the search found the solution and kept it for every deeper depth
+   */
+  uint64_t solution_nodes = 0;
+};
+
+/**
+ * @brief converts the moves of a "bm" or "am" operation to legal moves
+ *
+ * @param board the board of the position
+ * @param player the player to move
+ * @param operand the moves in SAN, separated by spaces
+ * @param moves gets the legal moves
+ * @return an empty string, or the SAN that is not a legal move
+ */
+static std::string resolveMoves(const Board& board, Team::Team player, std::string_view operand,
+                                std::vector<Move>& moves) {
+  while (!operand.empty()) {
+    const uint64_t start = operand.find_first_not_of(' ');
+    if (start == std::string_view::npos) break;
+    operand.remove_prefix(start);
+    const std::string_view san = operand.substr(0, operand.find(' '));
+    operand.remove_prefix(san.size());
+
+    const SlimOptional<Move> move = San::findMove(board, player, san);
+    if (!move.has_value()) return std::string(san);
+    moves.push_back(move.data);
+  }
+  return "";
+}
+
+/**
+ * @brief searches a single position and checks the found move
+ *
+ * @param tt the transposition table of the current thread
+ * @param job the line with the position
+ * @param limits the limits of the search
+ * @return the outcome of the position
+ */
+static SuiteResult checkPosition(TranspositionTable& tt, const Batch::InputLine& job, const SearchLimits& limits) {
+  SuiteResult result = SuiteResult();
+  result.id = std::to_string(job.line_number);
+  result.is_error = true;
+  try {
+    const EpdRecord record = Epd::parseLine(job.line);
+    if (const std::string* id_operand = record.findOperand("id")) result.id = *id_operand;
+    const Fen fen = Fen::buildFenFromStr(record.fen);
+    const Board board = Board(fen);
+    const Team::Team player = fen.current_player;
+
+    const std::string* best_moves_san = record.findOperand("bm");
+    const std::string* avoid_moves_san = record.findOperand("am");
+    if (best_moves_san == nullptr && avoid_moves_san == nullptr) {
+      result.text = "no bm or am operation";
+      return result;
+    }
+    std::vector<Move> best_moves;
+    std::vector<Move> avoid_moves;
+    if (best_moves_san != nullptr) {
+      result.expected = "bm " + *best_moves_san;
+      const std::string illegal = resolveMoves(board, player, *best_moves_san, best_moves);
+      if (!illegal.empty()) {
+        result.text = "illegal bm move " + illegal;
+        return result;
+      }
+    }
+    if (avoid_moves_san != nullptr) {
+      result.expected += (result.expected.empty() ? "am " : ", am ") + *avoid_moves_san;
+      const std::string illegal = resolveMoves(board, player, *avoid_moves_san, avoid_moves);
+      if (!illegal.empty()) {
+        result.text = "illegal am move " + illegal;
+        return result;
+      }
+    }
+
+    const auto isSolution = [&](SlimOptional<Move> move) {
+      if (!move.has_value()) return false;
+      const auto contains = [&move](const std::vector<Move>& moves) {
+        return std::find(moves.begin(), moves.end(), move.data) != moves.end();
+      };
+      return (best_moves_san == nullptr || contains(best_moves)) && !contains(avoid_moves);
+    };
+
+    // the solution counts from the depth since which the search kept finding it
+    bool found_solution = false;
+    SearchControl control = SearchControl();
+    Search::applyLimits(control, limits, player);
+    const SearchResult search = Search::iterativeDeepening(
+        board, player, limits, control,
+        [&](const Search::SearchInfo& info) {
+          if (!isSolution(info.result.best_move)) {
+            found_solution = false;
+          } else if (!found_solution) {
+            found_solution = true;
+            result.solution_time_ms = info.time_ms;
+            result.solution_nodes = info.nodes;
+          }
+        },
+        &tt);
+
+    result.is_error = false;
+    result.solved = isSolution(search.best_move);
+    result.text = search.best_move.has_value() ? Print::move_as_uci(search.best_move.data) : "-";
+  } catch (const FenParsingException& e) {
+    result.text = e.what();
+    std::replace(result.text.begin(), result.text.end(), '\n', ' ');
+  }
+  return result;
+}
+
+namespace Batch {
+
+// (function documentation is provided in the corresponding header)
+SuiteSummary runEpdSuite(std::istream& in, std::ostream& out, const SuiteOptions& options) {
+  SearchLimits limits = SearchLimits();
+  limits.depth = options.depth;
+  limits.nodes = options.nodes;
+  limits.movetime = options.movetime;
+  if (limits.depth <= 0 && limits.nodes == 0 && limits.movetime <= 0) limits.movetime = default_suite_movetime_ms;
+
+  const unsigned threads = threadAmount(options.threads);
+  uint64_t line_number = 0;
+  SuiteSummary summary = SuiteSummary();
+  const auto start = std::chrono::steady_clock::now();
+
+  out << "# id\tresult\tmove\texpected\ttime_ms\tnodes\n";
+  runInParallel<InputLine, SuiteResult>(
+      threads, threads * positions_in_flight_per_thread, true,
+      [&in, &line_number](InputLine& job) { return readPositionLine(in, line_number, job); },
+      [&options]() { return std::make_unique<TranspositionTable>(options.hash_mb); },
+      [&limits](std::unique_ptr<TranspositionTable>& tt, const InputLine& job) {
+        return checkPosition(*tt, job, limits);
+      },
+      [&out, &summary](const SuiteResult& result) {
+        summary.positions++;
+        if (result.is_error) {
+          summary.errors++;
+          out << result.id << "\terror\t" << result.text << '\n';
+          return;
+        }
+        out << result.id << (result.solved ? "\tsolved\t" : "\tfailed\t") << result.text << '\t' << result.expected;
+        if (result.solved) {
+          summary.solved++;
+          summary.solution_time_ms += result.solution_time_ms;
+          summary.solution_nodes += result.solution_nodes;
+          out << '\t' << result.solution_time_ms << '\t' << result.solution_nodes;
+        }
+        out << '\n';
+      });
+  const auto total_ms =
+      std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - start).count();
+
+  const uint64_t checked = summary.positions - summary.errors;
+  out << "solved " << summary.solved << " of " << checked << " positions (" << std::fixed << std::setprecision(1)
+      << (checked > 0 ? 100.0 * static_cast<double>(summary.solved) / static_cast<double>(checked) : 0.0) << "%)";
+  if (summary.errors > 0) out << ", " << summary.errors << " positions with errors";
+  out << '\n';
+  if (summary.solved > 0) {
+    out << "average time to solution: "
+        << static_cast<double>(summary.solution_time_ms) / static_cast<double>(summary.solved) << " ms\n";
+    out << "average nodes to solution: "
+        << static_cast<double>(summary.solution_nodes) / static_cast<double>(summary.solved) << '\n';
+  }
+  out << "total time: " << total_ms << " ms on " << threads << " threads" << std::endl;
+  out.unsetf(std::ios::floatfield);
+  return summary;
+}
+
+// (function documentation is provided in the corresponding header)
+bool parseSuiteArguments(int argc, const char* const* argv, SuiteOptions& options, std::string& input_path) {
+  input_path = "-";
+  bool has_input = false;
+  for (int i = 0; i < argc; ++i) {
+    const std::string_view arg = argv[i];
+    const char* value = i + 1 < argc ? argv[i + 1] : nullptr;
+    const OptionResult::OptionResult search_option = parseSearchOption(arg, value, options);
+    if (search_option == OptionResult::INVALID) return false;
+    if (search_option == OptionResult::PARSED) {
+      ++i;
+    } else if (!has_input && (arg == "-" || arg.rfind("--", 0) != 0)) {
+      input_path = std::string(arg);
+      has_input = true;
+    } else {
+      return false;
+    }
+  }
+  return true;
+}
+
+// (function documentation is provided in the corresponding header)
+void printSuiteUsage(std::ostream& os) {
+  os << "usage: ./Chess epd [options] [FILE]\n"
+        "  searches every position of the EPD test suite FILE (or stdin if FILE is missing or -)\n"
+        "  and checks the found moves against the bm and am operations\n"
+        "  --depth N       the maximum search depth (default: no limit)\n"
+        "  --nodes N       the maximum nodes per position (default: no limit)\n"
+        "  --movetime MS   the maximum time per position in milliseconds\n"
+        "                  (default: 1000 if there is no other limit)\n"
+        "  --threads N     the amount of threads (default: one per core)\n"
+        "  --hash MB       the transposition table size per thread (default: 16, at most 4096)\n";
+}
+}  // namespace Batch
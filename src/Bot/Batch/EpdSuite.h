@@ -0,0 +1,106 @@
+//
+// Created by timap on 18.10.2026.
+//
+
+#pragma once
+
+#include <cstdint>
+#include <istream>
+#include <ostream>
+#include <string>
+
+#include "../TranspositionTable/TranspositionTable.h"
+
+namespace Batch {
+/**
+ * @brief how each position of a test suite gets searched
+ * @note without any limit each position is searched for default_suite_movetime_ms
+ */
+struct SuiteOptions {
+  /**
+   * @brief the maximum search depth, 0 for no limit
+   */
+  int depth = 0;
+  /**
+   * @brief the maximum amount of nodes per position, 0 for no limit
+   */
+  uint64_t nodes = 0;
+  /**
+   * @brief the maximum time per position in milliseconds, 0 for no limit
+   */
+  int64_t movetime = 0;
+  /**
+   * @brief the amount of worker threads, 0 for one per core
+   */
+  unsigned threads = 0;
+  /**
+   * @brief the size of the transposition table of each worker thread in megabytes
+   */
+  uint64_t hash_mb = TranspositionTable::default_size_mb;
+};
+
+/**
+ * @brief the time per position if SuiteOptions has no limit
+ */
+constexpr int64_t default_suite_movetime_ms = 1000;
+
+/**
+ * @brief the totals of a test suite
+ */
+struct SuiteSummary {
+  /**
+   * @brief the amount of positions (including the ones with errors)
+   */
+  uint64_t positions = 0;
+  /**
+   * @brief the amount of positions where the search found a "bm" move and no "am" move
+   */
+  uint64_t solved = 0;
+  /**
+   * @brief the amount of positions that could not be parsed or have no "bm" and no "am" operation
+   */
+  uint64_t errors = 0;
+  /**
+   * @brief the sum of the times to solution of all solved positions in milliseconds
+   */
+  int64_t solution_time_ms = 0;
+  /**
+   * @brief the sum of the nodes to solution of all solved positions
+   */
+  uint64_t solution_nodes = 0;
+};
+
+/**
+ * @brief searches every position of an EPD test suite and checks the result against its "bm" (best move) and "am"
+ * (avoid move) operations
+ *
+ * @param in the EPD lines (moves in SAN), empty lines and lines starting with '#' are skipped
+ * @param out gets one tab separated line per position: the id, "solved", "failed" or "error", the found move in
+ * UCI notation, the expected moves, and for solved positions the time in milliseconds and the nodes until the
+ * search found the solution and kept it for every deeper depth; followed by the solve rate and the averages
+ * @param options how the positions get searched
+ * @return the totals of the suite
+ *
+ * @note the positions are spread over all cores like runBatch(), and the results are written in input order
+ */
+SuiteSummary runEpdSuite(std::istream& in, std::ostream& out, const SuiteOptions& options);
+
+/**
+ * @brief parses the command line arguments of the test suite mode
+ *
+ * @param argc the amount of arguments
+ * @param argv the arguments, starting with the first argument after "epd"
+ * @param options the options to set
+ * @param input_path set to the input file, or "-" for stdin
+ * @return false if the arguments are invalid (e.g. an unknown option, or a number with a sign or trailing characters)
+ *
+ * @note the search options are parsed with parseSearchOption(), the same as in the batch mode
+ */
+bool parseSuiteArguments(int argc, const char* const* argv, SuiteOptions& options, std::string& input_path);
+
+/**
+ * @brief prints how to use the test suite mode
+ * @param os the stream to print to
+ */
+void printSuiteUsage(std::ostream& os);
+}  // namespace Batch
@@ -0,0 +1,134 @@
+//
+// Created by timap on 18.10.2026.
+//
+
+#pragma once
+
+#include <algorithm>
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <map>
+#include <mutex>
+#include <thread>
+#include <utility>
+#include <vector>
+
+namespace Batch {
+/**
+ * @brief splits a range of indices evenly between threads and waits for all of them
+ *
+ * @param threads the amount of threads (at most one per index, at least 1)
+ * @param amount the size of the range
+ * @param process called on each thread with its own part of [0, amount): void(unsigned thread, uint64_t begin,
+ * uint64_t end)
+ *
+ * @note unlike runInParallel() the work is known upfront, e.g. the positions of the tuner or the boards of a tablebase
+ */
+template <class Process>
+void parallelRanges(unsigned threads, uint64_t amount, Process process) {
+  threads = static_cast<unsigned>(std::clamp<uint64_t>(amount, 1, std::max(1u, threads)));
+  std::vector<std::thread> workers;
+  for (unsigned i = 0; i < threads; ++i) {
+    workers.emplace_back(process, i, amount * i / threads, amount * (i + 1) / threads);
+  }
+  for (std::thread& worker : workers) worker.join();
+}
+
+/**
+ * @brief processes a stream of jobs on several threads, while keeping only a bounded amount of jobs in memory
+ *
+ * @tparam Job the input of a single job
+ * @tparam Result the output of a single job
+ * @param threads the amount of worker threads (at least 1)
+ * @param max_in_flight the maximum amount of jobs that were read but whose results were not yet emitted \n
+ * (this bounds the memory, no matter how many jobs there are)
+ * @param ordered true to emit the results in the order the jobs were read, false to emit them as soon as they are done
+ * @param next_job called on the calling thread to read the next job: bool(Job&), returns false if there are no more
+ * @param make_state called once on each worker thread to create the state the thread keeps between its jobs
+ * (e.g. its own transposition table)
+ * @param process called on the worker threads for each job: Result(State&, Job&)
+ * @param emit called on the calling thread for each result: void(const Result&)
+ * @return the amount of processed jobs
+ *
+ * @note the calling thread only reads jobs and emits results, so the callbacks of the calling thread do not need to
+ * be thread safe
+ */
+template <class Job, class Result, class NextJob, class MakeState, class Process, class Emit>
+uint64_t runInParallel(unsigned threads, uint64_t max_in_flight, bool ordered, NextJob next_job, MakeState make_state,
+                       Process process, Emit emit) {
+  std::mutex mutex;
+  // notified when a job was added or no more jobs will be added
+  std::condition_variable job_added;
+  // notified when a job is done
+  std::condition_variable job_done;
+
+  std::deque<std::pair<uint64_t, Job>> queue;
+  // the finished results, by the index of their job
+  std::map<uint64_t, Result> finished;
+  uint64_t in_flight = 0;
+  uint64_t next_to_emit = 0;
+  bool no_more_jobs = false;
+
+  std::vector<std::thread> workers;
+  for (unsigned i = 0; i < std::max(1u, threads); ++i) {
+    workers.emplace_back([&]() {
+      auto state = make_state();
+      while (true) {
+        std::unique_lock<std::mutex> lock(mutex);
+        job_added.wait(lock, [&] { return !queue.empty() || no_more_jobs; });
+        if (queue.empty()) return;
+        std::pair<uint64_t, Job> job = std::move(queue.front());
+        queue.pop_front();
+        lock.unlock();
+
+        Result result = process(state, job.second);
+
+        lock.lock();
+        finished.emplace(job.first, std::move(result));
+        lock.unlock();
+        job_done.notify_one();
+      }
+    });
+  }
+
+  // emits all results that can be emitted, the lock has to be held
+  const auto emitReady = [&]() {
+    while (!finished.empty()) {
+      auto it = ordered ? finished.find(next_to_emit) : finished.begin();
+      if (it == finished.end()) break;
+      emit(it->second);
+      finished.erase(it);
+      next_to_emit++;
+      in_flight--;
+    }
+  };
+
+  uint64_t amount = 0;
+  Job job;
+  while (next_job(job)) {
+    std::unique_lock<std::mutex> lock(mutex);
+    job_done.wait(lock, [&] {
+      emitReady();
+      return in_flight < max_in_flight;
+    });
+    queue.emplace_back(amount++, std::move(job));
+    in_flight++;
+    lock.unlock();
+    job_added.notify_one();
+    job = Job();
+  }
+
+  {
+    std::unique_lock<std::mutex> lock(mutex);
+    no_more_jobs = true;
+    job_added.notify_all();
+    job_done.wait(lock, [&] {
+      emitReady();
+      return in_flight == 0;
+    });
+  }
+  for (std::thread& worker : workers) worker.join();
+  return amount;
+}
+}  // namespace Batch
@@ -0,0 +1,92 @@
+//
+// Created by timap on 18.10.2026.
+//
+
+#pragma once
+
+#include <cstdint>
+#include <ostream>
+
+namespace Bench {
+/**
+ * @brief the search depth used by the bench command when no depth is given
+ */
+constexpr int default_bench_depth = 4;
+
+/**
+ * @brief the result of running the bench
+ */
+struct BenchResult {
+  /**
+   * @brief the total amount of nodes searched over all bench positions
+   * @note deterministic for the same depth and search, which makes it usable as a signature of the search behavior
+   */
+  uint64_t nodes = 0;
+  /**
+   * @brief the total time in milliseconds that all searches took
+   */
+  int64_t time_ms = 0;
+  /**
+   * @brief the total amount of pawn hash lookups of all searches
+   */
+  uint64_t pawn_hash_probes = 0;
+  /**
+   * @brief the total amount of pawn hash lookups of all searches that found their pawn structure
+   */
+  uint64_t pawn_hash_hits = 0;
+  /**
+   * @brief the total amount of evaluation cache lookups of all searches
+   */
+  uint64_t eval_cache_probes = 0;
+  /**
+   * @brief the total amount of evaluation cache lookups of all searches that found their evaluation
+   */
+  uint64_t eval_cache_hits = 0;
+  /**
+   * @brief the total amount of windowed evaluations of all searches
+   */
+  uint64_t windowed_evals = 0;
+  /**
+   * @brief the total amount of windowed evaluations of all searches that skipped the expensive terms
+   */
+  uint64_t lazy_evals = 0;
+
+  /**
+   * @return the searched nodes per second
+   */
+  [[nodiscard]] inline uint64_t nodesPerSecond() const {
+    // +1 to not divide by 0 when the bench was faster than a millisecond
+    return nodes * 1000 / static_cast<uint64_t>(time_ms + 1);
+  }
+
+  /**
+   * @return the share of pawn hash lookups that found their pawn structure in percent
+   */
+  [[nodiscard]] inline double pawnHashHitRate() const {
+    return pawn_hash_probes == 0 ? 0.0 : static_cast<double>(pawn_hash_hits) * 100 / pawn_hash_probes;
+  }
+
+  /**
+   * @return the share of evaluation cache lookups that found their evaluation in percent
+   */
+  [[nodiscard]] inline double evalCacheHitRate() const {
+    return eval_cache_probes == 0 ? 0.0 : static_cast<double>(eval_cache_hits) * 100 / eval_cache_probes;
+  }
+
+  /**
+   * @return the share of windowed evaluations that skipped the expensive terms in percent
+   */
+  [[nodiscard]] inline double lazyEvalRate() const {
+    return windowed_evals == 0 ? 0.0 : static_cast<double>(lazy_evals) * 100 / windowed_evals;
+  }
+};
+
+/**
+ * @brief searches each position of a fixed built-in set of positions to a fixed depth
+ *
+ * @param depth the depth to search each position with
+ * @param os the output stream to print the progress and the final summary to
+ * @return the total nodes and time of all searches
+ */
+BenchResult runBench(int depth, std::ostream& os);
+}  // namespace Bench
@@ -0,0 +1,175 @@
+//
+// Created by timap on 18.10.2026.
+//
+#include "AttackMaps.h"
+
+#include <array>
+
+#include "../../Types/Vec2.h"
+
+/**
+ * @brief the directions of the sliding pieces, the first 4 towards larger squares and the last 4 towards smaller
+ * squares (that way the first piece hit on a ray is the lowest / highest square of the ray) \n
+ * the even directions are the ones of a castle, the odd ones the ones of a bishop
+ */
+constexpr Vec2 ray_directions[8] = {{1, 0}, {1, 1}, {0, 1}, {-1, 1}, {-1, 0}, {-1, -1}, {0, -1}, {1, -1}};
+
+/**
+ * @brief the squares from (but without) a square to the edge of the board in a direction (indexed with
+ * [direction][square], see ray_directions)
+ */
+constexpr std::array<std::array<uint64_t, BOARD_SIZE>, 8> rays = [] {
+  std::array<std::array<uint64_t, BOARD_SIZE>, 8> result = {};
+  for (int direction = 0; direction < 8; ++direction) {
+    for (int8_t square = 0; square < BOARD_SIZE; ++square) {
+      const Vec2 step = ray_directions[direction];
+      for (Vec2 to_2D = Vec2::newVec2(square) + step; !to_2D.outsideBoard(); to_2D += step) {
+        result[direction][square] |= uint64_t(1) << to_2D.getPos();
+      }
+    }
+  }
+  return result;
+}();
+
+/**
+ * @brief the squares a piece that moves a single step with the given offsets attacks from each square
+ *
+ * @param offsets the offsets of the piece
+ * @return the attacked squares, indexed with the square of the piece
+ */
+static constexpr std::array<uint64_t, BOARD_SIZE> step_attacks(const std::array<Vec2, 8>& offsets) {
+  std::array<uint64_t, BOARD_SIZE> result = {};
+  for (int8_t square = 0; square < BOARD_SIZE; ++square) {
+    for (Vec2 offset : offsets) {
+      const Vec2 to_2D = Vec2::newVec2(square) + offset;
+      if (!to_2D.outsideBoard()) result[square] |= uint64_t(1) << to_2D.getPos();
+    }
+  }
+  return result;
+}
+
+/**
+ * @brief the squares a knight attacks from each square
+ */
+constexpr std::array<uint64_t, BOARD_SIZE> knight_attacks =
+    step_attacks({{{-2, -1}, {-2, 1}, {2, -1}, {2, 1}, {-1, -2}, {-1, 2}, {1, -2}, {1, 2}}});
+/**
+ * @brief the squares a king attacks from each square
+ */
+constexpr std::array<uint64_t, BOARD_SIZE> king_attacks =
+    step_attacks({{{-1, -1}, {1, -1}, {-1, 1}, {1, 1}, {0, -1}, {0, 1}, {-1, 0}, {1, 0}}});
+
+/**
+ * @brief all squares except the ones on file a (i.e. the squares a pawn can capture to the left from)
+ */
+constexpr uint64_t not_file_a = 0xFEFEFEFEFEFEFEFEULL;
+/**
+ * @brief all squares except the ones on file h (i.e. the squares a pawn can capture to the right from)
+ */
+constexpr uint64_t not_file_h = 0x7F7F7F7F7F7F7F7FULL;
+
+/**
+ * @param bits a set of squares that is not empty
+ * @return the set with only the highest square of bits
+ */
+static constexpr uint64_t highest_square(uint64_t bits) noexcept {
+  bits |= bits >> 1;
+  bits |= bits >> 2;
+  bits |= bits >> 4;
+  bits |= bits >> 8;
+  bits |= bits >> 16;
+  bits |= bits >> 32;
+  return bits ^ (bits >> 1);
+}
+
+/**
+ * @brief the squares a sliding piece attacks in the given directions, until (and including) the first piece hit
+ *
+ * @param square the square of the piece
+ * @param occupied the squares with a piece of any team on them
+ * @param first_direction the first direction of the piece (see ray_directions)
+ * @param direction_step the step between the directions of the piece (1 for queens, 2 for bishops and castles)
+ * @return the attacked squares (including squares with pieces of the own team)
+ */
+static constexpr uint64_t slider_attacks(int8_t square, uint64_t occupied, int first_direction,
+                                         int direction_step) noexcept {
+  uint64_t attacks = 0;
+  // without branches, as whether a ray is blocked is hard to predict
+  for (int direction = first_direction; direction < 4; direction += direction_step) {
+    // towards larger squares: everything up to the lowest blocker (or the whole ray if there is none)
+    const uint64_t ray = rays[direction][square];
+    const uint64_t blockers = ray & occupied;
+    const uint64_t blocker = blockers & (0 - blockers);
+    attacks |= ray & ((blocker << 1) - 1);
+  }
+  for (int direction = first_direction + 4; direction < 8; direction += direction_step) {
+    // towards smaller squares: everything down to the highest blocker (square 0 if there is none)
+    const uint64_t ray = rays[direction][square];
+    const uint64_t blockers = ray & occupied;
+    attacks |= ray & ~(highest_square(blockers | 1) - 1);
+  }
+  return attacks;
+}
+
+/**
+ * @brief adds the attacks of all pieces of a type of a team to the attack maps
+ *
+ * @tparam type the type of the pieces (knight, bishop, castle or queen)
+ * @param maps the attack maps to add to (the occupied squares and the pawn attacks of the enemy have to be already set)
+ * @param board the current board state
+ * @param team the team of the pieces
+ */
+template <PieceType::PieceType type>
+static constexpr void add_piece_attacks(AttackMaps& maps, const Board& board, Team::Team team) noexcept {
+  const uint64_t occupied = maps.occupied_by[Team::BLACK] | maps.occupied_by[Team::WHITE];
+  // squares with own pieces or attacked by enemy pawns do not count as mobility
+  const uint64_t unsafe = maps.occupied_by[team] | maps.attacked_by[Team::getEnemyTeam(team)][PieceType::PAWN];
+  const Board_Positions::PositionsSlice pieces = board.positions.getVec(team, type);
+  for (int i = 0; i < pieces.size; ++i) {
+    uint64_t attacks = 0;
+    if constexpr (type == PieceType::KNIGHT) attacks = knight_attacks[pieces[i]];
+    if constexpr (type == PieceType::CASTLE) attacks = slider_attacks(pieces[i], occupied, 0, 2);
+    if constexpr (type == PieceType::BISHOP) attacks = slider_attacks(pieces[i], occupied, 1, 2);
+    if constexpr (type == PieceType::QUEEN) attacks = slider_attacks(pieces[i], occupied, 0, 1);
+    maps.attacked_by[team][type] |= attacks;
+    maps.mobility[team][type] += amountSquares(attacks & ~unsafe);
+  }
+  maps.attacked_by[team][0] |= maps.attacked_by[team][type];
+}
+
+// (function documentation is provided in the corresponding header)
+AttackMaps AttackMaps::build(const Board& board) noexcept {
+  AttackMaps maps = AttackMaps();
+  for (Team::Team team : {Team::BLACK, Team::WHITE}) {
+    for (int i = 1; i < PIECETYPE_AMOUNT; ++i) {
+      const Board_Positions::PositionsSlice pieces = board.positions.getVec(team, static_cast<PieceType::PieceType>(i));
+      for (int j = 0; j < pieces.size; ++j) maps.occupied_by[team] |= uint64_t(1) << pieces[j];
+    }
+  }
+
+  // pawns first, as the mobility of the other pieces does not count squares attacked by enemy pawns
+  // white pawns attack towards smaller squares (up), black pawns towards larger squares (down)
+  uint64_t white_pawns = 0;
+  uint64_t black_pawns = 0;
+  const Board_Positions::PositionsSlice white_pawn_list = board.positions.getVec(Team::WHITE, PieceType::PAWN);
+  const Board_Positions::PositionsSlice black_pawn_list = board.positions.getVec(Team::BLACK, PieceType::PAWN);
+  for (int i = 0; i < white_pawn_list.size; ++i) white_pawns |= uint64_t(1) << white_pawn_list[i];
+  for (int i = 0; i < black_pawn_list.size; ++i) black_pawns |= uint64_t(1) << black_pawn_list[i];
+  maps.attacked_by[Team::WHITE][PieceType::PAWN] =
+      ((white_pawns & not_file_a) >> 9) | ((white_pawns & not_file_h) >> 7);
+  maps.attacked_by[Team::BLACK][PieceType::PAWN] =
+      ((black_pawns & not_file_a) << 7) | ((black_pawns & not_file_h) << 9);
+
+  for (Team::Team team : {Team::BLACK, Team::WHITE}) {
+    maps.attacked_by[team][0] |= maps.attacked_by[team][PieceType::PAWN];
+    add_piece_attacks<PieceType::KNIGHT>(maps, board, team);
+    add_piece_attacks<PieceType::BISHOP>(maps, board, team);
+    add_piece_attacks<PieceType::CASTLE>(maps, board, team);
+    add_piece_attacks<PieceType::QUEEN>(maps, board, team);
+    const int8_t king_pos = board.positions.getKingPos(team);
+    maps.attacked_by[team][PieceType::KING] = king_attacks[king_pos];
+    maps.king_zone[team] = king_attacks[king_pos] | uint64_t(1) << king_pos;
+    maps.attacked_by[team][0] |= maps.attacked_by[team][PieceType::KING];
+  }
+  return maps;
+}
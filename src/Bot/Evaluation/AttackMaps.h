@@ -0,0 +1,58 @@
+//
+// Created by timap on 18.10.2026.
+//
+
+#pragma once
+
+#include <cstdint>
+
+#include "../../Board/Board.h"
+
+/**
+ * @param bits a set of squares (bit i = square i)
+ * @return the amount of squares in the set
+ */
+constexpr int amountSquares(uint64_t bits) noexcept {
+  // counts the bits in parallel in groups of 2, 4 and 8 bits (no std::popcount before C++20)
+  bits = bits - ((bits >> 1) & 0x5555555555555555ULL);
+  bits = (bits & 0x3333333333333333ULL) + ((bits >> 2) & 0x3333333333333333ULL);
+  bits = (bits + (bits >> 4)) & 0x0F0F0F0F0F0F0F0FULL;
+  return static_cast<int>((bits * 0x0101010101010101ULL) >> 56);
+}
+
+/**
+ * @brief the squares attacked by each piece type of each team, and how many squares each piece type can safely
+ * move to, calculated in a single pass over the pieces of a board
+ *
+ * @note built once per evaluated board and shared by all evaluation terms that need attacked squares (e.g. mobility
+ * and king danger), so that the pieces do not have to be walked through once per term. \n
+ * The squares are stored as bit sets with bit i being square i (0 = a8, 63 = h1)
+ */
+struct AttackMaps {
+  /**
+   * @brief the squares attacked by the pieces of a type of a team (indexed with [team][type], [team][0] are the
+   * squares attacked by any piece of the team)
+   * @note a square with a piece of the own team on it counts as attacked (i.e. protected)
+   */
+  uint64_t attacked_by[TEAM_AMOUNT][PIECETYPE_AMOUNT] = {};
+  /**
+   * @brief the squares with a piece of each team on them (indexed with [team])
+   */
+  uint64_t occupied_by[TEAM_AMOUNT] = {};
+  /**
+   * @brief the square of the king of each team and all squares next to it (indexed with [team])
+   */
+  uint64_t king_zone[TEAM_AMOUNT] = {};
+  /**
+   * @brief the sum of the squares the pieces of a type of a team can move to, without the squares with own pieces and
+   * the squares attacked by enemy pawns (indexed with [team][type], only for knights, bishops, castles and queens)
+   */
+  int mobility[TEAM_AMOUNT][PIECETYPE_AMOUNT] = {};
+
+  /**
+   * @brief calculates the attack maps of a board
+   * @param board the board (both kings have to exist)
+   * @return the attack maps of both teams
+   */
+  static AttackMaps build(const Board& board) noexcept;
+};
@@ -0,0 +1,21 @@
+//
+// Created by timap on 18.10.2026.
+//
+#include "EvalCache.h"
+
+// (function documentation is provided in the corresponding header)
+EvalCache::EvalCache(uint64_t size_kb) {
+  const uint64_t max_entries = size_kb * 1024 / sizeof(uint64_t);
+  if (max_entries == 0) return;
+  uint64_t amount = 1;
+  while (amount * 2 <= max_entries) amount *= 2;
+  entries = std::make_unique<std::atomic<uint64_t>[]>(amount);
+  amount_entries = amount;
+  index_mask = amount - 1;
+  clear();
+}
+
+// (function documentation is provided in the corresponding header)
+void EvalCache::clear() {
+  for (uint64_t i = 0; i < amount_entries; i++) entries[i].store(0, std::memory_order_relaxed);
+}
@@ -0,0 +1,119 @@
+//
+// Created by timap on 18.10.2026.
+//
+
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+
+/**
+ * @brief a small lossy cache of the evaluations of boards, found through their Zobrist hash (see Zobrist::hashBoard())
+ *
+ * @note the leaves of a search tree often reach the same board through different move orders, and those boards then
+ * do not need to be evaluated again. \n
+ * Direct mapped: every hash has exactly one slot, and a new evaluation always replaces the old one. \n
+ * Each entry is a single 64 bit word (the upper 40 bits of the hash and the score), which is read and written
+ * atomically, so the cache can even be shared by several threads without any lock (a torn entry can not happen, a
+ * race only loses an evaluation). \n
+ * The slot already uses the lower bits of the hash, so only the upper 40 bits have to be compared.
+ */
+class EvalCache {
+ private:
+  /**
+   * @brief the amount of bits of an entry that hold the score
+   */
+  static constexpr int score_bits = 24;
+  /**
+   * @brief added to a score so that it is stored as an unsigned value
+   */
+  static constexpr int score_offset = 1 << (score_bits - 1);
+  /**
+   * @brief the lower bits of an entry that hold the score
+   */
+  static constexpr uint64_t score_mask = (uint64_t(1) << score_bits) - 1;
+
+  /**
+   * @brief the entries, with an amount that is a power of 2 (0 means empty)
+   */
+  std::unique_ptr<std::atomic<uint64_t>[]> entries;
+  /**
+   * @brief the amount of entries
+   */
+  uint64_t amount_entries = 0;
+  /**
+   * @brief the amount of entries - 1, used to get the slot of a hash
+   */
+  uint64_t index_mask = 0;
+  /**
+   * @brief the amount of lookups so far
+   */
+  uint64_t amount_probes = 0;
+  /**
+   * @brief the amount of lookups so far that found their hash
+   */
+  uint64_t amount_hits = 0;
+
+ public:
+  /**
+   * @brief the default size of a cache in kilobytes
+   */
+  static constexpr uint64_t default_size_kb = 256;
+
+  /**
+   * @brief constructs an empty cache
+   * @param size_kb the maximum size of the cache in kilobytes (rounded down to a power of 2 amount of entries),
+   * 0 for a cache that never finds anything
+   */
+  explicit EvalCache(uint64_t size_kb = default_size_kb);
+
+  /**
+   * @brief looks up the evaluation of a board
+   *
+   * @param hash the Zobrist hash of the board
+   * @param score set to the cached evaluation if there is one
+   * @return true if the evaluation was cached
+   */
+  inline bool probe(uint64_t hash, int& score) {
+    if (amount_entries == 0) return false;
+    amount_probes++;
+    const uint64_t entry = entries[hash & index_mask].load(std::memory_order_relaxed);
+    if (entry == 0 || (entry >> score_bits) != (hash >> score_bits)) return false;
+    amount_hits++;
+    score = static_cast<int>(entry & score_mask) - score_offset;
+    return true;
+  }
+
+  /**
+   * @brief stores the evaluation of a board, replacing the old entry of the slot
+   *
+   * @param hash the Zobrist hash of the board
+   * @param score the evaluation (scores outside of +-2^23 are not stored)
+   */
+  inline void store(uint64_t hash, int score) {
+    if (amount_entries == 0 || score <= -score_offset || score >= score_offset) return;
+    const uint64_t entry = (hash & ~score_mask) | static_cast<uint64_t>(score + score_offset);
+    entries[hash & index_mask].store(entry, std::memory_order_relaxed);
+  }
+
+  /**
+   * @brief removes all entries
+   */
+  void clear();
+
+  /**
+   * @return the amount of lookups since the cache was constructed
+   */
+  [[nodiscard]] inline uint64_t probes() const { return amount_probes; }
+
+  /**
+   * @return the amount of lookups since the cache was constructed that found a cached evaluation
+   */
+  [[nodiscard]] inline uint64_t hits() const { return amount_hits; }
+
+  /**
+   * @return the amount of entries the cache can hold
+   */
+  [[nodiscard]] inline uint64_t capacity() const { return amount_entries; }
+};
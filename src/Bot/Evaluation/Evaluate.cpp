@@ -4,8 +4,19 @@
 #include "Evaluate.h"
 
 #include <algorithm>
+#include <cstdint>
+#include <cstdlib>
 
+#if defined(__AVX2__)
+#include <immintrin.h>
+#endif
+
+#include "../../Profiling/Profiler.h"
 #include "../../Types/Vec2.h"
+#include "../TranspositionTable/Zobrist.h"
+#include "./AttackMaps.h"
+#include "./KpkBitbase.h"
+#include "./eval_constants.h"
 #include "./pesto_tables.h"
 
 /**
@@ -14,27 +25,107 @@
  * @note This constant is used to cap the game phase percentage to 24.
  */
 constexpr int max_phase_percentage = 24;
+
 /**
- * @brief Advantage for the player who is allowed to move next.
+ * @brief The trace of a normal evaluation, which records nothing (so the compiler removes all of its calls).
+ *
+ * @note a trace gets told every use of a tunable constant (see EvalCoefficients) with the team that uses it
  */
-constexpr int movers_advantage = 15;
+struct NoTrace {
+  constexpr void material(Team::Team, PieceType::PieceType, int) noexcept {}
+  constexpr void pst(Team::Team, PieceType::PieceType, int8_t) noexcept {}
+  constexpr void mobility(Team::Team, PieceType::PieceType, int) noexcept {}
+  constexpr void doubledPawns(Team::Team, int) noexcept {}
+  constexpr void isolatedPawns(Team::Team, int) noexcept {}
+  constexpr void passedPawn(Team::Team, int) noexcept {}
+  constexpr void protectedKing(Team::Team, int) noexcept {}
+  constexpr void phase(int) noexcept {}
+  constexpr void kingDanger(Team::Team, int, int) noexcept {}
+};
+
 /**
- * @brief Factor for each piece that is next to and protecting the king
+ * @brief The trace that sums up the coefficients of the tunable constants (white positive, black negative).
  */
-constexpr int protected_king_factor = 1;
+struct CoefficientTrace {
+  /**
+   * @brief the coefficients that get summed up
+   */
+  EvalCoefficients& coefficients;
+
+  static constexpr int sign(Team::Team team) noexcept { return team == Team::WHITE ? 1 : -1; }
+  constexpr void material(Team::Team team, PieceType::PieceType type, int amount) noexcept {
+    coefficients.material[type] += sign(team) * amount;
+  }
+  constexpr void pst(Team::Team team, PieceType::PieceType type, int8_t table_pos) noexcept {
+    coefficients.pst[type][table_pos] += sign(team);
+  }
+  constexpr void mobility(Team::Team team, PieceType::PieceType type, int squares) noexcept {
+    coefficients.mobility[type] += sign(team) * squares;
+  }
+  constexpr void doubledPawns(Team::Team team, int amount) noexcept {
+    coefficients.doubled_pawns += sign(team) * amount;
+  }
+  constexpr void isolatedPawns(Team::Team team, int amount) noexcept {
+    coefficients.isolated_pawns += sign(team) * amount;
+  }
+  constexpr void passedPawn(Team::Team team, int advance) noexcept { coefficients.passed_pawns[advance] += sign(team); }
+  constexpr void protectedKing(Team::Team team, int fields) noexcept {
+    coefficients.protected_king += sign(team) * fields;
+  }
+  constexpr void phase(int mid_game_phase) noexcept { coefficients.mid_game_phase = mid_game_phase; }
+  constexpr void kingDanger(Team::Team team, int danger, int mid_game_phase) noexcept {
+    coefficients.fixed -= sign(team) * danger * mid_game_phase;
+  }
+};
 
 /**
- * @brief Struct to hold the board value for midgame and endgame.
- *
- * @note
- * mg = the midgame value \n
- * eg = the endgame value
+ * @brief The trace that records the value of every term for each team (see EvalTrace).
  */
-struct BoardValue {
-  int mg = 0;
-  int eg = 0;
+struct TermTrace {
+  /**
+   * @brief the terms that get recorded
+   */
+  EvalTrace& terms;
+
+  inline void add(Team::Team team, EvalTerm::EvalTerm term, int mg, int eg) noexcept {
+    terms.mg[team][term] += mg;
+    terms.eg[team][term] += eg;
+  }
+  inline void material(Team::Team team, PieceType::PieceType type, int amount) noexcept {
+    add(team, EvalTerm::MATERIAL, amount * mg_value[type], amount * eg_value[type]);
+  }
+  inline void pst(Team::Team team, PieceType::PieceType type, int8_t table_pos) noexcept {
+    add(team, EvalTerm::PST, mg_pesto_table[type][table_pos], eg_pesto_table[type][table_pos]);
+  }
+  inline void mobility(Team::Team team, PieceType::PieceType type, int squares) noexcept {
+    add(team, EvalTerm::MOBILITY, squares * mobility_bonus[type].mg, squares * mobility_bonus[type].eg);
+  }
+  inline void doubledPawns(Team::Team team, int amount) noexcept {
+    add(team, EvalTerm::PAWN_STRUCTURE, -amount * doubled_pawn_penalty.mg, -amount * doubled_pawn_penalty.eg);
+  }
+  inline void isolatedPawns(Team::Team team, int amount) noexcept {
+    add(team, EvalTerm::PAWN_STRUCTURE, -amount * isolated_pawn_penalty.mg, -amount * isolated_pawn_penalty.eg);
+  }
+  inline void passedPawn(Team::Team team, int advance) noexcept {
+    add(team, EvalTerm::PAWN_STRUCTURE, passed_pawn_bonus[advance].mg, passed_pawn_bonus[advance].eg);
+  }
+  inline void protectedKing(Team::Team team, int fields) noexcept {
+    add(team, EvalTerm::PROTECTED_KING, fields * protected_king_factor, 0);
+  }
+  inline void phase(int mid_game_phase) noexcept { terms.mid_game_phase = mid_game_phase; }
+  inline void kingDanger(Team::Team team, int danger, int) noexcept { add(team, EvalTerm::KING_DANGER, -danger, 0); }
 };
 
+/**
+ * @brief The attack units of each enemy piece type attacking the king zone, counted once per attacked square of the
+ * zone (kings and pawns are not counted).
+ */
+constexpr int king_attack_weight[PIECETYPE_AMOUNT] = {0, 0, 5, 2, 2, 3, 0};
+/**
+ * @brief The maximum midgame penalty for an attacked king, as the penalty grows with the square of the attack units.
+ */
+constexpr int max_king_danger = 300;
+
 /**
  * @brief Calculates the piece values for a given team \n
  * and increases the mid game percentage (i.e. how much the board is still in the midgame).
@@ -42,11 +133,14 @@ struct BoardValue {
  * @param board The current board state
  * @param team The team for which to calculate the piece values
  * @param mid_game_percentage A reference to the game phase variable to be updated
+ * @param trace gets told the amount of pieces of each type
  * @return A BoardValue struct containing the midgame and endgame piece values for the specified team
  *
  * @note always returns positive values meaning it still needs to be negated for Team Black
  */
-static constexpr BoardValue piece_values(const Board& board, Team::Team team, int& mid_game_percentage) {
+template <class Trace>
+static constexpr BoardValue piece_values(const Board& board, Team::Team team, int& mid_game_percentage,
+                                         Trace& trace) {
   BoardValue value = {0};
   for (int i = 1; i < PIECETYPE_AMOUNT; ++i) {
     PieceType::PieceType type = static_cast<PieceType::PieceType>(i);
@@ -54,6 +148,7 @@ static constexpr BoardValue piece_values(const Board& board, Team::Team team, in
     value.mg += amount_pieces * mg_value[i];
     value.eg += amount_pieces * eg_value[i];
     mid_game_percentage += amount_pieces * mid_game_factors[type];
+    trace.material(team, type, amount_pieces);
   }
   return value;
 }
@@ -63,13 +158,14 @@ static constexpr BoardValue piece_values(const Board& board, Team::Team team, in
  *
  * @tparam team the team for which to calculate the positional advantage
  * @param board The current board state
+ * @param trace gets told the table position of each piece
  * @return A BoardValue struct containing the midgame and endgame Positional advantage values
  *
  * @note always returns "positive*" values meaning it still needs to be negated for Team Black \n
  * (* = can also be negativ because of negative valued squares)
  */
-template <Team::Team team>
-static constexpr BoardValue positional_advantage(const Board& board) {
+template <Team::Team team, class Trace>
+static constexpr BoardValue positional_advantage(const Board& board, Trace& trace) {
   constexpr int flip_row = team == Team::WHITE ? 0 : 56;
   BoardValue value = {};
   for (int i = 1; i < PIECETYPE_AMOUNT; ++i) {
@@ -80,6 +176,7 @@ static constexpr BoardValue positional_advantage(const Board& board) {
       int8_t table_pos = current_pos ^ flip_row;
       value.mg += mg_pesto_table[type][table_pos];
       value.eg += eg_pesto_table[type][table_pos];
+      trace.pst(team, type, table_pos);
     }
   }
   return value;
@@ -90,11 +187,13 @@ static constexpr BoardValue positional_advantage(const Board& board) {
  *
  * @param board The current board state
  * @param team The team for which to calculate the king protection score.
+ * @param trace gets told the amount of protected fields
  * @return The king protection score (i.e. how well the king is currently protected).
  *
  * @note always returns positive values meaning it still needs to be negated for Team Black
  */
-static constexpr int protected_king(const Board& board, Team::Team team) {
+template <class Trace>
+static constexpr int protected_king(const Board& board, Team::Team team, Trace& trace) {
   int fields_protected = 0;
   int8_t king_pos = board.positions.getKingPos(team);
   Vec2 king_pos_2d = Vec2::newVec2(king_pos);
@@ -108,47 +207,322 @@ static constexpr int protected_king(const Board& board, Team::Team team) {
     if (board.grid[new_pos_2D.getPos()].team == team) fields_protected++;
   }
 
+  trace.protectedKing(team, fields_protected);
   return fields_protected * protected_king_factor;
 }
 
+/**
+ * @brief Calculates the mobility score of the pieces of a given team.
+ *
+ * @param maps The attack maps of the current board
+ * @param team The team for which to calculate the mobility
+ * @param trace gets told the amount of safe squares of each piece type
+ * @return A BoardValue struct containing the midgame and endgame mobility values
+ *
+ * @note always returns positive values meaning it still needs to be negated for Team Black
+ */
+template <class Trace>
+static constexpr BoardValue mobility(const AttackMaps& maps, Team::Team team, Trace& trace) {
+  BoardValue value = {};
+  for (int i = 1; i < PIECETYPE_AMOUNT; ++i) {
+    trace.mobility(team, static_cast<PieceType::PieceType>(i), maps.mobility[team][i]);
+    value.mg += maps.mobility[team][i] * mobility_bonus[i].mg;
+    value.eg += maps.mobility[team][i] * mobility_bonus[i].eg;
+  }
+  return value;
+}
+
+/**
+ * @brief Calculates how much the king of the given team is in danger from attacks next to it.
+ *
+ * @param maps The attack maps of the current board
+ * @param team The team for which to calculate the king danger.
+ * @return The king danger (i.e. how much the squares around the king are attacked by enemy pieces).
+ *
+ * @note always returns positive values meaning it still needs to be negated for Team Black \n
+ * grows with the square of the attack units, so a single attacker barely counts but several attackers do
+ */
+static constexpr int king_danger(const AttackMaps& maps, Team::Team team) {
+  const Team::Team enemy = Team::getEnemyTeam(team);
+  int attack_units = 0;
+  for (int i = 1; i < PIECETYPE_AMOUNT; ++i) {
+    if (king_attack_weight[i] == 0) continue;
+    attack_units += king_attack_weight[i] * amountSquares(maps.attacked_by[enemy][i] & maps.king_zone[team]);
+  }
+  return std::min(attack_units * attack_units / 2, max_king_danger);
+}
+
+/**
+ * @brief the pawns of both teams, counted by file and with the most advanced pawn of each file
+ */
+struct PawnFiles {
+  /**
+   * @brief the amount of pawns of each team on each file (indexed with [team][file])
+   */
+  int amount[TEAM_AMOUNT][8] = {};
+  /**
+   * @brief the smallest row (i.e. nearest to row 8) of a pawn of each team on each file, 8 if there is none
+   */
+  int min_row[TEAM_AMOUNT][8] = {{8, 8, 8, 8, 8, 8, 8, 8}, {8, 8, 8, 8, 8, 8, 8, 8}};
+  /**
+   * @brief the largest row (i.e. nearest to row 1) of a pawn of each team on each file, -1 if there is none
+   */
+  int max_row[TEAM_AMOUNT][8] = {{-1, -1, -1, -1, -1, -1, -1, -1}, {-1, -1, -1, -1, -1, -1, -1, -1}};
+};
+
+/**
+ * @brief Calculates the pawn structure score of a given team.
+ *
+ * @tparam team the team for which to calculate the pawn structure
+ * @param board The current board state
+ * @param files the pawns of both teams by file
+ * @param trace gets told the amount of doubled and isolated pawns and the advance of each passed pawn
+ * @return the penalties for doubled and isolated pawns and the bonus for passed pawns
+ *
+ * @note always returns "positive*" values meaning it still needs to be negated for Team Black \n
+ * (* = negative if the penalties are larger than the bonus)
+ */
+template <Team::Team team, class Trace>
+static constexpr PawnScore pawn_structure(const Board& board, const PawnFiles& files, Trace& trace) {
+  constexpr Team::Team enemy = Team::getEnemyTeam(team);
+  PawnScore score = {};
+
+  for (int file = 0; file < 8; ++file) {
+    const int amount = files.amount[team][file];
+    if (amount == 0) continue;
+    score.mg -= (amount - 1) * doubled_pawn_penalty.mg;
+    score.eg -= (amount - 1) * doubled_pawn_penalty.eg;
+    trace.doubledPawns(team, amount - 1);
+    const bool has_left_neighbour = file > 0 && files.amount[team][file - 1] > 0;
+    const bool has_right_neighbour = file < 7 && files.amount[team][file + 1] > 0;
+    if (!has_left_neighbour && !has_right_neighbour) {
+      score.mg -= amount * isolated_pawn_penalty.mg;
+      score.eg -= amount * isolated_pawn_penalty.eg;
+      trace.isolatedPawns(team, amount);
+    }
+  }
+
+  const Board_Positions::PositionsSlice pawns = board.positions.getVec(team, PieceType::PAWN);
+  for (int i = 0; i < pawns.size; ++i) {
+    const int row = pawns[i] >> 3;
+    const int file = pawns[i] & 0b111;
+    bool is_passed = true;
+    for (int enemy_file = std::max(0, file - 1); enemy_file <= std::min(7, file + 1); ++enemy_file) {
+      // white moves to smaller rows, black to larger rows
+      if (team == Team::WHITE ? files.min_row[enemy][enemy_file] < row : files.max_row[enemy][enemy_file] > row)
+        is_passed = false;
+    }
+    if (!is_passed) continue;
+    // clamped, as a FEN can also put pawns on the first or last row
+    const int advance = std::clamp(team == Team::WHITE ? 6 - row : row - 1, 0, 5);
+    score.mg += passed_pawn_bonus[advance].mg;
+    score.eg += passed_pawn_bonus[advance].eg;
+    trace.passedPawn(team, advance);
+  }
+  return score;
+}
+
+/**
+ * @brief Evaluates the pawn structure of the current board (see evaluatePawnStructure()).
+ *
+ * @param board The current board state
+ * @param trace gets told the pawn structure of both teams
+ * @return the midgame and endgame score of the pawn structure
+ */
+template <class Trace>
+static PawnScore pawn_structure_score(const Board& board, Trace& trace) {
+  PawnFiles files = PawnFiles();
+  for (Team::Team team : {Team::BLACK, Team::WHITE}) {
+    const Board_Positions::PositionsSlice pawns = board.positions.getVec(team, PieceType::PAWN);
+    for (int i = 0; i < pawns.size; ++i) {
+      const int row = pawns[i] >> 3;
+      const int file = pawns[i] & 0b111;
+      files.amount[team][file]++;
+      files.min_row[team][file] = std::min(files.min_row[team][file], row);
+      files.max_row[team][file] = std::max(files.max_row[team][file], row);
+    }
+  }
+  const PawnScore white = pawn_structure<Team::WHITE>(board, files, trace);
+  const PawnScore black = pawn_structure<Team::BLACK>(board, files, trace);
+  return {white.mg - black.mg, white.eg - black.eg};
+}
+
 // (function documentation is provided in the corresponding header)
-int evaluateBoard(const Board& board, Team::Team) {
-#ifdef DIFFERENT_DEPTHS
-  const int current_player_factor = player == Team::WHITE ? 1 : -1;
-#endif
-  int result_score = 0;
-  int mid_game_phase_percentage = 0;
+PawnScore evaluatePawnStructure(const Board& board) {
+  NoTrace trace = NoTrace();
+  return pawn_structure_score(board, trace);
+}
+
+/**
+ * @brief the terms of the evaluation that are cheap enough to always calculate (material and PeSTO tables)
+ */
+struct CheapScore {
+  /**
+   * @brief the midgame and endgame score of the material and the PeSTO tables (white minus black)
+   */
+  BoardValue value;
+  /**
+   * @brief how far the board is still in the midgame (0 = endgame, 24 = midgame)
+   */
+  int mid_game_phase = 0;
+};
+
+/**
+ * @brief interpolates between a midgame and an endgame score depending on how far the board is in the endgame
+ *
+ * @param value the midgame and endgame score
+ * @param mid_game_phase how far the board is still in the midgame (0 ..= 24)
+ * @return the interpolated score (without the "/ 24", because if the score can fit in an int why make it smaller
+ * again and lose precision)
+ */
+static constexpr int interpolate(BoardValue value, int mid_game_phase) {
+  return value.mg * mid_game_phase + value.eg * (max_phase_percentage - mid_game_phase);
+}
+
+/**
+ * @brief Calculates the material and PeSTO scores and the phase of the current board.
+ *
+ * @param board The current board state
+ * @param trace gets told the pieces, their table positions and the phase
+ * @return the cheap terms of the evaluation (see CheapScore)
+ */
+template <class Trace>
+static CheapScore cheap_score(const Board& board, Trace& trace) {
+  CheapScore cheap = CheapScore();
 
   // piece Value
-  BoardValue white_piece_value = piece_values(board, Team::WHITE, mid_game_phase_percentage);
-  BoardValue black_piece_value = piece_values(board, Team::BLACK, mid_game_phase_percentage);
+  BoardValue white_piece_value = piece_values(board, Team::WHITE, cheap.mid_game_phase, trace);
+  BoardValue black_piece_value = piece_values(board, Team::BLACK, cheap.mid_game_phase, trace);
 
   // pesto
-  BoardValue white_pesto = positional_advantage<Team::WHITE>(board);
-  BoardValue black_pesto = positional_advantage<Team::BLACK>(board);
+  BoardValue white_pesto = positional_advantage<Team::WHITE>(board, trace);
+  BoardValue black_pesto = positional_advantage<Team::BLACK>(board, trace);
 
   // calculate Pesto current board value with (https://www.chessprogramming.org/PeSTO%27s_Evaluation_Function)
   // modified because the original code is basically unintelligible
+  cheap.value.mg = (white_piece_value.mg - black_piece_value.mg) + (white_pesto.mg - black_pesto.mg);
+  cheap.value.eg = (white_piece_value.eg - black_piece_value.eg) + (white_pesto.eg - black_pesto.eg);
 
-  // score as if the board is currently in the midgame
-  int midgame_score = (white_piece_value.mg - black_piece_value.mg) + (white_pesto.mg - black_pesto.mg);
-  // score as if the board is currently in the endgame
-  int endgame_score = (white_piece_value.eg - black_piece_value.eg) + (white_pesto.eg - black_pesto.eg);
   // cap midgame phase percentage to 24
-  mid_game_phase_percentage = std::min(mid_game_phase_percentage, max_phase_percentage);
-  // make inverse of midgame phase percentage into endgame phase percentage
-  int endgame_phase_percentage = max_phase_percentage - mid_game_phase_percentage;
+  cheap.mid_game_phase = std::min(cheap.mid_game_phase, max_phase_percentage);
+  trace.phase(cheap.mid_game_phase);
+  return cheap;
+}
 
-  // interpolate between the data depending on how far the current board state is in the endgame
-  // removed "/ 24", because if the score can fit in an int why make it smaller again and lose precision
-  result_score += (midgame_score * mid_game_phase_percentage) + (endgame_score * endgame_phase_percentage);
+/**
+ * @brief Calculates the terms of the evaluation besides the cheap ones (pawn structure, mobility and king safety).
+ *
+ * @param board The current board state
+ * @param pawns The score of the pawn structure of the board
+ * @param mid_game_phase how far the board is still in the midgame (see CheapScore)
+ * @param trace gets told the mobility, the protected king squares and the king danger
+ * @return the interpolated score of the expensive terms (added to the interpolated cheap score it gives the score of
+ * evaluateBoard())
+ */
+template <class Trace>
+static int expensive_score(const Board& board, PawnScore pawns, int mid_game_phase, Trace& trace) {
+  // attacked squares, shared by mobility and king danger
+  const AttackMaps maps = AttackMaps::build(board);
+  BoardValue white_mobility = mobility(maps, Team::WHITE, trace);
+  BoardValue black_mobility = mobility(maps, Team::BLACK, trace);
 
-  // extra
+  const BoardValue value = {pawns.mg + (white_mobility.mg - black_mobility.mg),
+                            pawns.eg + (white_mobility.eg - black_mobility.eg)};
+  int result_score = interpolate(value, mid_game_phase);
 
   // king is protected
-  int difference_king_protection = protected_king(board, Team::WHITE) - protected_king(board, Team::BLACK);
+  int difference_king_protection =
+      protected_king(board, Team::WHITE, trace) - protected_king(board, Team::BLACK, trace);
   // reuse the previously calculated percentage of how far the board is still in the midgame here
-  result_score += difference_king_protection * mid_game_phase_percentage;
+  result_score += difference_king_protection * mid_game_phase;
+
+  // king is attacked (only matters while there are enough pieces left to attack it)
+  const int white_king_danger = king_danger(maps, Team::WHITE);
+  const int black_king_danger = king_danger(maps, Team::BLACK);
+  trace.kingDanger(Team::WHITE, white_king_danger, mid_game_phase);
+  trace.kingDanger(Team::BLACK, black_king_danger, mid_game_phase);
+  result_score += (black_king_danger - white_king_danger) * mid_game_phase;
+  return result_score;
+}
+
+/**
+ * @brief The most squares a piece of each type can move to (i.e. on an empty board), which bounds its mobility
+ * (kings and pawns are not counted).
+ */
+constexpr int max_mobility_squares[PIECETYPE_AMOUNT] = {0, 0, 27, 8, 13, 14, 0};
+
+/**
+ * @return the largest amount the pawn structure score can change by with each pawn (it can be doubled, isolated and
+ * passed at the same time)
+ */
+static constexpr BoardValue max_pawn_structure_per_pawn() {
+  BoardValue bound = {std::abs(doubled_pawn_penalty.mg) + std::abs(isolated_pawn_penalty.mg),
+                      std::abs(doubled_pawn_penalty.eg) + std::abs(isolated_pawn_penalty.eg)};
+  int max_passed_mg = 0;
+  int max_passed_eg = 0;
+  for (PawnScore bonus : passed_pawn_bonus) {
+    max_passed_mg = std::max(max_passed_mg, std::abs(bonus.mg));
+    max_passed_eg = std::max(max_passed_eg, std::abs(bonus.eg));
+  }
+  bound.mg += max_passed_mg;
+  bound.eg += max_passed_eg;
+  return bound;
+}
+
+/**
+ * @brief Calculates the largest amount the expensive terms (see expensive_score()) can change the score of a board by,
+ * only from the amount of pieces.
+ *
+ * @param board The current board state
+ * @param mid_game_phase how far the board is still in the midgame (see CheapScore)
+ * @param pawns_known whether the pawn structure score is already known (and therefore does not need to be bounded)
+ * @return the bound of the absolute value of the interpolated expensive score
+ */
+static int expensive_score_bound(const Board& board, int mid_game_phase, bool pawns_known) {
+  BoardValue bound = {};
+  int max_king_dangers[TEAM_AMOUNT] = {};
+  for (Team::Team team : {Team::BLACK, Team::WHITE}) {
+    // the attack units if every piece attacked every square of the enemy king zone (the king and its 8 neighbours)
+    int max_attack_units = 0;
+    for (int i = 1; i < PIECETYPE_AMOUNT; ++i) {
+      const int amount = board.positions.getAmount(team, static_cast<PieceType::PieceType>(i));
+      bound.mg += amount * max_mobility_squares[i] * std::abs(mobility_bonus[i].mg);
+      bound.eg += amount * max_mobility_squares[i] * std::abs(mobility_bonus[i].eg);
+      max_attack_units += amount * king_attack_weight[i] * 9;
+    }
+    max_king_dangers[Team::getEnemyTeam(team)] = std::min(max_attack_units * max_attack_units / 2, max_king_danger);
+    if (!pawns_known) {
+      constexpr BoardValue per_pawn = max_pawn_structure_per_pawn();
+      const int amount_pawns = board.positions.getAmount(team, PieceType::PAWN);
+      bound.mg += amount_pawns * per_pawn.mg;
+      bound.eg += amount_pawns * per_pawn.eg;
+    }
+  }
+  int result_bound = interpolate(bound, mid_game_phase);
+  // both teams protect between 0 and 8 squares next to their king
+  result_bound += 8 * std::abs(protected_king_factor) * mid_game_phase;
+  // both king dangers are at least 0, so their difference is at most the larger one
+  result_bound += std::max(max_king_dangers[Team::WHITE], max_king_dangers[Team::BLACK]) * mid_game_phase;
+  return result_bound;
+}
+
+/**
+ * @brief Evaluates the current board with an already calculated pawn structure.
+ *
+ * @param board The current board state
+ * @param pawns The score of the pawn structure of the board
+ * @param trace gets told the use of every tunable constant (besides the pawn structure), the phase and the king danger
+ * @return The calculated score for a given board (see evaluateBoard())
+ */
+template <class Trace>
+static int evaluate_with_pawns(const Board& board, PawnScore pawns, Trace& trace) {
+  PROFILE_ZONE(EVALUATE_BOARD);
+#ifdef DIFFERENT_DEPTHS
+  const int current_player_factor = player == Team::WHITE ? 1 : -1;
+#endif
+  const CheapScore cheap = cheap_score(board, trace);
+  int result_score = interpolate(cheap.value, cheap.mid_game_phase);
+  result_score += expensive_score(board, pawns, cheap.mid_game_phase, trace);
 
   // just realized: the following is basically useless because all scores are calculated at the same depth
   // meaning the following just shifts all values in one direction for now
@@ -159,3 +533,290 @@ int evaluateBoard(const Board& board, Team::Team) {
 #endif
   return result_score;
 }
+
+// (function documentation is provided in the corresponding header)
+int evaluateBoard(const Board& board, Team::Team player) {
+  if (Kpk::isKpk(board)) return Kpk::evaluate(board, player);
+  NoTrace trace = NoTrace();
+  return evaluate_with_pawns(board, evaluatePawnStructure(board), trace);
+}
+
+// (function documentation is provided in the corresponding header)
+int evaluateBoard(const Board& board, Team::Team player, PawnHashTable& pawn_table) {
+  if (Kpk::isKpk(board)) return Kpk::evaluate(board, player);
+  const uint64_t key = Zobrist::hashPawns(board);
+  NoTrace trace = NoTrace();
+  if (const PawnEntry* entry = pawn_table.probe(key)) return evaluate_with_pawns(board, entry->score, trace);
+  const PawnScore pawns = evaluatePawnStructure(board);
+  pawn_table.store(key, pawns);
+  return evaluate_with_pawns(board, pawns, trace);
+}
+
+// (function documentation is provided in the corresponding header)
+WindowedEval evaluateBoard(const Board& board, Team::Team player, PawnHashTable& pawn_table, int alpha, int beta) {
+  PROFILE_ZONE(EVALUATE_BOARD);
+  if (Kpk::isKpk(board)) return {Kpk::evaluate(board, player), false};
+  NoTrace trace = NoTrace();
+  const CheapScore cheap = cheap_score(board, trace);
+  const int cheap_result = interpolate(cheap.value, cheap.mid_game_phase);
+
+  // a pawn structure from the table is as cheap as the material, so it is known before the bound gets checked
+  const uint64_t key = Zobrist::hashPawns(board);
+  const PawnEntry* entry = pawn_table.probe(key);
+  int known_result = cheap_result;
+  if (entry != nullptr) known_result += interpolate({entry->score.mg, entry->score.eg}, cheap.mid_game_phase);
+
+  // the other terms can not bring the score back into the window, so the bound is all the search needs
+  const int bound = expensive_score_bound(board, cheap.mid_game_phase, entry != nullptr);
+  if (known_result - bound >= beta) return {known_result - bound, true};
+  if (known_result + bound <= alpha) return {known_result + bound, true};
+
+  PawnScore pawns = {};
+  if (entry != nullptr) {
+    pawns = entry->score;
+  } else {
+    pawns = evaluatePawnStructure(board);
+    pawn_table.store(key, pawns);
+  }
+  return {cheap_result + expensive_score(board, pawns, cheap.mid_game_phase, trace), false};
+}
+
+/**
+ * @brief the amount of boards whose cheap terms are calculated at once (one per AVX2 lane when tapering)
+ */
+constexpr int batch_lanes = 8;
+
+#if defined(__AVX2__)
+/**
+ * @param team the team of the piece
+ * @param type the type of the piece (not PieceType::NONE)
+ * @param pos the square of the piece
+ * @return the index of the piece on the square in PieceSquareValues
+ *
+ * @note the types are in reverse order (a row per type, the kings last), so that row 0 of each team only holds zeros
+ * and is what the empty slots after the last piece of the team point to
+ */
+static constexpr int piece_square_index(Team::Team team, int type, int pos) {
+  return (team * PIECETYPE_AMOUNT + PIECETYPE_AMOUNT - type) * BOARD_SIZE + pos;
+}
+
+/**
+ * @brief the material and PeSTO table values of every piece on every square (negative for black), so that the cheap
+ * score of a board is the sum of one entry per piece
+ *
+ * @note each entry holds the midgame value in its lower and the endgame value in its upper 16 bits, so that one gather
+ * loads both and 16 bit additions sum them up separately (a single value is far below the limit of 8191, which keeps
+ * the sum of the 4 entries of a lane inside of 16 bits)
+ */
+struct PieceSquareValues {
+  /**
+   * @brief the packed values, indexed with piece_square_index()
+   */
+  alignas(32) int32_t packed[TEAM_AMOUNT * PIECETYPE_AMOUNT * BOARD_SIZE] = {};
+};
+
+/**
+ * @return the values of every piece on every square, with the current constants of the evaluation
+ */
+static const PieceSquareValues& piece_square_values() {
+  static const PieceSquareValues values = [] {
+    PieceSquareValues result = PieceSquareValues();
+    for (Team::Team team : {Team::BLACK, Team::WHITE}) {
+      const int sign = team == Team::WHITE ? 1 : -1;
+      const int flip_row = team == Team::WHITE ? 0 : 56;
+      for (int type = 1; type < PIECETYPE_AMOUNT; ++type) {
+        for (int pos = 0; pos < BOARD_SIZE; ++pos) {
+          const int mg = sign * (mg_value[type] + mg_pesto_table[type][pos ^ flip_row]);
+          const int eg = sign * (eg_value[type] + eg_pesto_table[type][pos ^ flip_row]);
+#ifndef NO_ASSERTS
+          assert(std::abs(mg) <= 8191 && std::abs(eg) <= 8191);
+#endif
+          const uint32_t packed = static_cast<uint16_t>(mg) | (static_cast<uint32_t>(static_cast<uint16_t>(eg)) << 16);
+          result.packed[piece_square_index(team, type, pos)] = static_cast<int32_t>(packed);
+        }
+      }
+    }
+    return result;
+  }();
+  return values;
+}
+
+/**
+ * @param values 8 integers
+ * @return the sum of the integers
+ */
+static int32_t horizontal_sum(__m256i values) {
+  __m128i sum = _mm_add_epi32(_mm256_castsi256_si128(values), _mm256_extracti128_si256(values, 1));
+  sum = _mm_add_epi32(sum, _mm_shuffle_epi32(sum, 0b01001110));
+  sum = _mm_add_epi32(sum, _mm_shuffle_epi32(sum, 0b10110001));
+  return _mm_cvtsi128_si32(sum);
+}
+
+/**
+ * @param values 4 unsigned 64 bit integers
+ * @return the sum of the integers
+ */
+static int horizontal_sum_64(__m256i values) {
+  const __m128i sum = _mm_add_epi64(_mm256_castsi256_si128(values), _mm256_extracti128_si256(values, 1));
+  return static_cast<int>(_mm_cvtsi128_si64(_mm_add_epi64(sum, _mm_unpackhi_epi64(sum, sum))));
+}
+
+/**
+ * @brief Sums up the material and PeSTO values and the phase of all pieces of a board at once.
+ *
+ * @param board The current board state
+ * @param values the values of every piece on every square
+ * @param phase set to the not yet capped midgame phase
+ * @return the not yet interpolated midgame and endgame score (the same as CheapScore::value)
+ *
+ * @note the 32 slots of the position lists of both teams are the lanes: the type of each slot is counted from the
+ * ends of the types (a slot after the last piece of its team counts 0 and gets the zero row), and the values of all
+ * slots are loaded with 4 gathers
+ */
+static BoardValue piece_square_sum(const Board& board, const PieceSquareValues& values, int& phase) {
+  // black in the lower 16 bytes, white in the upper 16 bytes (the squares after the last piece can be anything)
+  const __m256i positions = _mm256_and_si256(
+      _mm256_loadu_si256(reinterpret_cast<const __m256i*>(board.positions.getAllPositions())), _mm256_set1_epi8(63));
+  // the ends of black in the bytes 0 ..= 6 and the ends of white in the bytes 9 ..= 15 (both loads stay inside the
+  // ends, unlike a single load of 16 bytes)
+  const int8_t* ends = board.positions.getAllEnds()[0];
+  const __m256i both_ends = _mm256_broadcastsi128_si256(
+      _mm_unpacklo_epi64(_mm_loadl_epi64(reinterpret_cast<const __m128i*>(ends)),
+                         _mm_loadl_epi64(reinterpret_cast<const __m128i*>(ends + PIECETYPE_AMOUNT - 1))));
+  const __m256i slots = _mm256_setr_epi8(0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15,  //
+                                         0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15);
+  // the amount of types whose end is after the slot, i.e. 7 - type (or 0 after the last piece)
+  __m256i reversed_types = _mm256_setzero_si256();
+  for (int type = 1; type < PIECETYPE_AMOUNT; ++type) {
+    // the end of the type of black in the lower half, the one of white in the upper half
+    const __m256i end = _mm256_shuffle_epi8(both_ends, _mm256_setr_m128i(_mm_set1_epi8(static_cast<char>(type)),
+                                                                          _mm_set1_epi8(static_cast<char>(type + 9))));
+    reversed_types = _mm256_sub_epi8(reversed_types, _mm256_cmpgt_epi8(end, slots));
+  }
+
+  // the phase of each slot looked up by its reversed type
+  alignas(16) static constexpr int8_t reversed_factors[16] = {
+      0, mid_game_factors[6], mid_game_factors[5], mid_game_factors[4], mid_game_factors[3], mid_game_factors[2],
+      mid_game_factors[1]};
+  const __m256i slot_phases = _mm256_shuffle_epi8(
+      _mm256_broadcastsi128_si256(_mm_load_si128(reinterpret_cast<const __m128i*>(reversed_factors))), reversed_types);
+  phase = horizontal_sum_64(_mm256_sad_epu8(slot_phases, _mm256_setzero_si256()));
+
+  // the rows of white come after the rows of black
+  const __m256i rows = _mm256_add_epi8(reversed_types, _mm256_setr_m128i(_mm_setzero_si128(), _mm_set1_epi8(7)));
+  __m256i sum = _mm256_setzero_si256();
+  for (int half = 0; half < 2; ++half) {
+    const __m128i team_rows = half == 0 ? _mm256_castsi256_si128(rows) : _mm256_extracti128_si256(rows, 1);
+    const __m128i team_positions =
+        half == 0 ? _mm256_castsi256_si128(positions) : _mm256_extracti128_si256(positions, 1);
+    const __m256i idx = _mm256_or_si256(_mm256_slli_epi16(_mm256_cvtepu8_epi16(team_rows), 6),
+                                        _mm256_cvtepu8_epi16(team_positions));
+    for (const __m128i quarter : {_mm256_castsi256_si128(idx), _mm256_extracti128_si256(idx, 1)}) {
+      sum = _mm256_add_epi16(sum, _mm256_i32gather_epi32(values.packed, _mm256_cvtepi16_epi32(quarter), 4));
+    }
+  }
+  // sign extends the 16 bit sums of each lane before they are added up
+  const __m256i mg = _mm256_srai_epi32(_mm256_slli_epi32(sum, 16), 16);
+  const __m256i eg = _mm256_srai_epi32(sum, 16);
+  return {horizontal_sum(mg), horizontal_sum(eg)};
+}
+#endif
+
+/**
+ * @brief Calculates the cheap terms (see cheap_score()) of up to batch_lanes boards at once.
+ *
+ * @param boards the boards
+ * @param amount the amount of boards (1 ..= batch_lanes)
+ * @param scores set to the interpolated cheap score of each board
+ * @param phases set to the capped midgame phase of each board
+ *
+ * @note with AVX2 the pieces of each board are summed up with piece_square_sum(), and the boards are the lanes of the
+ * interpolation, otherwise this is cheap_score() board by board
+ */
+static void cheap_scores(const Board* boards, int amount, int* scores, int* phases) {
+#if defined(__AVX2__)
+  const PieceSquareValues& values = piece_square_values();
+  alignas(32) int32_t lane_mg[batch_lanes] = {};
+  alignas(32) int32_t lane_eg[batch_lanes] = {};
+  alignas(32) int32_t lane_phases[batch_lanes] = {};
+  for (int lane = 0; lane < amount; ++lane) {
+    const BoardValue value = piece_square_sum(boards[lane], values, lane_phases[lane]);
+    lane_mg[lane] = value.mg;
+    lane_eg[lane] = value.eg;
+  }
+
+  const __m256i max_phase = _mm256_set1_epi32(max_phase_percentage);
+  const __m256i phase = _mm256_min_epi32(_mm256_load_si256(reinterpret_cast<const __m256i*>(lane_phases)), max_phase);
+  const __m256i mg = _mm256_load_si256(reinterpret_cast<const __m256i*>(lane_mg));
+  const __m256i eg = _mm256_load_si256(reinterpret_cast<const __m256i*>(lane_eg));
+  const __m256i score =
+      _mm256_add_epi32(_mm256_mullo_epi32(mg, phase), _mm256_mullo_epi32(eg, _mm256_sub_epi32(max_phase, phase)));
+  alignas(32) int32_t lane_scores[batch_lanes];
+  _mm256_store_si256(reinterpret_cast<__m256i*>(lane_scores), score);
+  _mm256_store_si256(reinterpret_cast<__m256i*>(lane_phases), phase);
+  std::copy(lane_scores, lane_scores + amount, scores);
+  std::copy(lane_phases, lane_phases + amount, phases);
+#else
+  NoTrace trace = NoTrace();
+  for (int lane = 0; lane < amount; ++lane) {
+    const CheapScore cheap = cheap_score(boards[lane], trace);
+    scores[lane] = interpolate(cheap.value, cheap.mid_game_phase);
+    phases[lane] = cheap.mid_game_phase;
+  }
+#endif
+}
+
+// (function documentation is provided in the corresponding header)
+void evaluateMaterial(const Board* boards, uint64_t amount, int* scores, int* phases) {
+  for (uint64_t start = 0; start < amount; start += batch_lanes) {
+    const int lanes = static_cast<int>(std::min<uint64_t>(batch_lanes, amount - start));
+    cheap_scores(boards + start, lanes, scores + start, phases + start);
+  }
+}
+
+// (function documentation is provided in the corresponding header)
+void evaluateBoards(const Board* boards, const Team::Team* players, uint64_t amount, int* scores,
+                    PawnHashTable& pawn_table) {
+  NoTrace trace = NoTrace();
+  int phases[batch_lanes];
+  for (uint64_t start = 0; start < amount; start += batch_lanes) {
+    const int lanes = static_cast<int>(std::min<uint64_t>(batch_lanes, amount - start));
+    cheap_scores(boards + start, lanes, scores + start, phases);
+    for (int lane = 0; lane < lanes; ++lane) {
+      const uint64_t i = start + lane;
+      if (Kpk::isKpk(boards[i])) {
+        scores[i] = Kpk::evaluate(boards[i], players[i]);
+        continue;
+      }
+      const uint64_t key = Zobrist::hashPawns(boards[i]);
+      PawnScore pawns = {};
+      if (const PawnEntry* entry = pawn_table.probe(key)) {
+        pawns = entry->score;
+      } else {
+        pawns = evaluatePawnStructure(boards[i]);
+        pawn_table.store(key, pawns);
+      }
+      scores[i] += expensive_score(boards[i], pawns, phases[lane], trace);
+    }
+  }
+}
+
+// (function documentation is provided in the corresponding header)
+EvalCoefficients evaluationCoefficients(const Board& board) {
+  EvalCoefficients coefficients = EvalCoefficients();
+  CoefficientTrace trace = CoefficientTrace{coefficients};
+  evaluate_with_pawns(board, pawn_structure_score(board, trace), trace);
+  return coefficients;
+}
+
+// (function documentation is provided in the corresponding header)
+EvalTrace evaluationTrace(const Board& board, Team::Team player) {
+  EvalTrace terms = EvalTrace();
+  TermTrace trace = TermTrace{terms};
+  terms.score = evaluate_with_pawns(board, pawn_structure_score(board, trace), trace);
+  if (Kpk::isKpk(board)) {
+    terms.from_bitbase = true;
+    terms.score = Kpk::evaluate(board, player);
+  }
+  return terms;
+}
@@ -5,6 +5,7 @@
 #pragma once
 
 #include "../../Board/Board.h"
+#include "PawnHashTable.h"
 
 /**
  * @brief Evaluates the current board.
@@ -15,6 +16,222 @@
  *
  * @note
  * positive value : white's advantage \n
- * negative value : black's advantage
+ * negative value : black's advantage \n
+ * a king and a pawn against a king is evaluated with the bitbase instead (see Kpk::evaluate())
  */
 int evaluateBoard(const Board& board, Team::Team player);
+
+/**
+ * @brief Evaluates the current board, with the pawn structure taken from (and stored in) the given table.
+ *
+ * @param board The current board state
+ * @param player The player who can currently make a move
+ * @param pawn_table the cache of the pawn structure scores
+ * @return The same score as evaluateBoard() without a table
+ */
+int evaluateBoard(const Board& board, Team::Team player, PawnHashTable& pawn_table);
+
+/**
+ * @brief the result of an evaluation with the window of the search (see evaluateBoard())
+ */
+struct WindowedEval {
+  /**
+   * @brief the score of evaluateBoard(), or if lazy only a bound of it outside of the window
+   */
+  int score = 0;
+  /**
+   * @brief true if the expensive terms were skipped, as the score was already clearly outside of the window
+   */
+  bool lazy = false;
+};
+
+/**
+ * @brief Evaluates the current board lazily for a search with the given window.
+ *
+ * First calculates the cheap terms (material, PeSTO tables and the pawn structure if it is in the table), and only
+ * calculates the expensive terms (mobility, king safety and otherwise the pawn structure) if they can still move the
+ * score into the window. Their largest possible change is bounded by the amount of pieces on the board.
+ *
+ * @param board The current board state
+ * @param player The player who can currently make a move
+ * @param pawn_table the cache of the pawn structure scores
+ * @param alpha the score white already has (the lower end of the window)
+ * @param beta the score black already has (the upper end of the window)
+ * @return the same score as evaluateBoard() if it is inside the window, otherwise either that score or with lazy = true
+ * a bound of it that is still outside the window (a lower bound \>= beta or an upper bound \<= alpha)
+ */
+WindowedEval evaluateBoard(const Board& board, Team::Team player, PawnHashTable& pawn_table, int alpha, int beta);
+
+/**
+ * @brief Evaluates many independent boards at once (e.g. the positions of a dataset).
+ *
+ * @param boards the boards
+ * @param players the player who can currently make a move on each board (only changes the score of a king and a pawn
+ * against a king, see Kpk::evaluate())
+ * @param amount the amount of boards
+ * @param scores set to the score of each board, the same as evaluateBoard() gives
+ * @param pawn_table the cache of the pawn structure scores, which boards of the same game mostly share
+ *
+ * @note the material, the PeSTO tables and the phase are calculated with evaluateMaterial(), only the other terms
+ * board by board
+ */
+void evaluateBoards(const Board* boards, const Team::Team* players, uint64_t amount, int* scores,
+                    PawnHashTable& pawn_table);
+
+/**
+ * @brief Calculates only the cheap terms of the evaluation (material and PeSTO tables) of many boards at once.
+ *
+ * @param boards the boards
+ * @param amount the amount of boards
+ * @param scores set to the material and PeSTO score of each board, interpolated between midgame and endgame with the
+ * same scale as evaluateBoard() (white positive, without Kpk::evaluate())
+ * @param phases set to how far each board is still in the midgame (0 = endgame, 24 = midgame)
+ *
+ * @note when compiled with AVX2 (-mavx2) the 32 pieces of a board are summed up at once (their types come from the
+ * position lists and their values are gathered from one table), and the interpolation is done for 8 boards at once.
+ * Otherwise the same sums are calculated piece by piece
+ */
+void evaluateMaterial(const Board* boards, uint64_t amount, int* scores, int* phases);
+
+/**
+ * @brief Evaluates the pawn structure of the current board (doubled, isolated and passed pawns).
+ *
+ * @param board The current board state
+ * @return the midgame and endgame score of the pawn structure
+ *
+ * @note
+ * positive value : white's advantage \n
+ * negative value : black's advantage \n
+ * only depends on the pawns, which is why it can be cached by the pawn hash (see Zobrist::hashPawns())
+ */
+PawnScore evaluatePawnStructure(const Board& board);
+
+/**
+ * @brief the evaluation of a board as a linear function of its tunable constants (see eval_constants.h and
+ * pesto_tables.h), used by the tuner
+ *
+ * @note every coefficient is how often white uses the constant minus how often black uses it, so that \n
+ * evaluateBoard() = mid_game_phase * (sum of coefficient * midgame value) \n
+ * + (24 - mid_game_phase) * (sum of coefficient * endgame value) \n
+ * + mid_game_phase * protected_king * protected_king_factor + fixed
+ */
+struct EvalCoefficients {
+  /**
+   * @brief how far the board is still in the midgame (0 = endgame, 24 = midgame)
+   */
+  int mid_game_phase = 0;
+  /**
+   * @brief the part of the score that does not depend on the tunable constants (the king danger)
+   */
+  int fixed = 0;
+  /**
+   * @brief the pieces of each type (for mg_value and eg_value)
+   */
+  int material[PIECETYPE_AMOUNT] = {};
+  /**
+   * @brief the pieces of each type on each square, from the view of white (for the PeSTO tables)
+   */
+  int pst[PIECETYPE_AMOUNT][BOARD_SIZE] = {};
+  /**
+   * @brief the safe squares of the pieces of each type (for mobility_bonus)
+   */
+  int mobility[PIECETYPE_AMOUNT] = {};
+  /**
+   * @brief the pawns behind another pawn of the same team (for doubled_pawn_penalty, i.e. counts negatively)
+   */
+  int doubled_pawns = 0;
+  /**
+   * @brief the isolated pawns (for isolated_pawn_penalty, i.e. counts negatively)
+   */
+  int isolated_pawns = 0;
+  /**
+   * @brief the passed pawns by how far they have moved forward (for passed_pawn_bonus)
+   */
+  int passed_pawns[6] = {};
+  /**
+   * @brief the protected squares next to the king (for protected_king_factor, only counts in the midgame)
+   */
+  int protected_king = 0;
+};
+
+/**
+ * @brief Calculates the coefficients of the tunable constants in the evaluation of the current board.
+ *
+ * @param board The current board state
+ * @return the coefficients, which give the same score as evaluateBoard() with the current constants
+ */
+EvalCoefficients evaluationCoefficients(const Board& board);
+
+/**
+ * @brief the namespace holding the terms of the evaluation in order to not pollute the main namespace
+ */
+namespace EvalTerm {
+/**
+ * @brief the terms the evaluation of a board is the sum of (see EvalTrace)
+ */
+enum EvalTerm : uint8_t { MATERIAL = 0, PST, MOBILITY, PAWN_STRUCTURE, PROTECTED_KING, KING_DANGER };
+}  // namespace EvalTerm
+
+/**
+ * @brief the amount of terms in EvalTerm::EvalTerm
+ */
+constexpr int EVAL_TERM_AMOUNT = 6;
+
+/**
+ * @brief the evaluation of a board split into its terms, for each team
+ *
+ * @note every value is from the view of the team it belongs to (i.e. positive is good for that team, also for black),
+ * and the penalties (king danger, doubled and isolated pawns) are negative. \n
+ * The protected king and the king danger only have a midgame value (their endgame value stays 0). \n
+ * evaluateBoard() = sum of termScore() over all terms, unless the score comes from the KPK bitbase
+ */
+struct EvalTrace {
+  /**
+   * @brief how far the board is still in the midgame (0 = endgame, 24 = midgame)
+   */
+  int mid_game_phase = 0;
+  /**
+   * @brief the midgame value of each term (indexed with [team][term])
+   */
+  int mg[TEAM_AMOUNT][EVAL_TERM_AMOUNT] = {};
+  /**
+   * @brief the endgame value of each term (indexed with [team][term])
+   */
+  int eg[TEAM_AMOUNT][EVAL_TERM_AMOUNT] = {};
+  /**
+   * @brief the score evaluateBoard() gives the board
+   */
+  int score = 0;
+  /**
+   * @brief true if the board is a king and a pawn against a king, whose score comes from the bitbase (see
+   * Kpk::evaluate()) instead of the terms
+   */
+  bool from_bitbase = false;
+
+  /**
+   * @param team the team of the value
+   * @param term the term of the value
+   * @return the value of a term of one team, interpolated between midgame and endgame like the score
+   */
+  [[nodiscard]] constexpr int teamScore(Team::Team team, EvalTerm::EvalTerm term) const noexcept {
+    return mg[team][term] * mid_game_phase + eg[team][term] * (24 - mid_game_phase);
+  }
+
+  /**
+   * @param term the term of the score
+   * @return the part of the score of a term (white minus black, in the same scale as evaluateBoard())
+   */
+  [[nodiscard]] constexpr int termScore(EvalTerm::EvalTerm term) const noexcept {
+    return teamScore(Team::WHITE, term) - teamScore(Team::BLACK, term);
+  }
+};
+
+/**
+ * @brief Evaluates the current board and records the value of every term (the normal evaluateBoard() records nothing
+ * and does not pay for this).
+ *
+ * @param board The current board state
+ * @param player The player who can currently make a move
+ * @return the terms of the evaluation and its score, the same as evaluateBoard()
+ */
+EvalTrace evaluationTrace(const Board& board, Team::Team player);
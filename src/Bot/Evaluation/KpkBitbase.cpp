@@ -0,0 +1,254 @@
+//
+// Created by timap on 18.10.2026.
+//
+#include "KpkBitbase.h"
+
+#include <algorithm>
+#include <array>
+#include <cstdlib>
+#include <vector>
+
+/**
+ * @brief the amount of boards in the bitbase (the team that moves next, 24 pawn squares and both kings)
+ */
+constexpr int amount_boards = 2 * 24 * BOARD_SIZE * BOARD_SIZE;
+
+/**
+ * @brief the classification of a board during the generation (combined with "|" over all moves of a board)
+ */
+enum KpkResult : uint8_t { INVALID = 0, UNKNOWN = 1, DRAW = 2, WIN = 4 };
+
+/**
+ * @brief the bits of the bitbase, one for each board (set if the team with the pawn wins)
+ */
+using KpkBits = std::array<uint64_t, amount_boards / 64>;
+
+/**
+ * @brief a board of the bitbase, from the view of the team with the pawn (the strong team) moving to smaller rows,
+ * i.e. like white in the board (square 0 = a8), with the pawn on the files a to d
+ */
+struct KpkBoard {
+  int8_t strong_king;
+  int8_t weak_king;
+  int8_t pawn;
+  bool weak_to_move;
+};
+
+/**
+ * @param board a board of the bitbase
+ * @return the index of the board in the bitbase
+ *
+ * @note the pawn is on the rows 1 ..= 6 (the rows 7 to 2 in chess notation) and the files 0 ..= 3
+ */
+static constexpr int kpk_index(KpkBoard board) {
+  return board.strong_king | (board.weak_king << 6) | (board.weak_to_move << 12) | ((board.pawn & 0b111) << 13) |
+         (((board.pawn >> 3) - 1) << 15);
+}
+
+/**
+ * @param idx the index of a board in the bitbase (see kpk_index())
+ * @return the board of the index
+ */
+static constexpr KpkBoard kpk_board(int idx) {
+  const int file = (idx >> 13) & 0b11;
+  const int row = (idx >> 15) + 1;
+  return {static_cast<int8_t>(idx & 0b111111), static_cast<int8_t>((idx >> 6) & 0b111111),
+          static_cast<int8_t>(row * 8 + file), ((idx >> 12) & 1) != 0};
+}
+
+/**
+ * @return the distance between two squares in king moves
+ */
+static int king_distance(int pos, int other_pos) {
+  return std::max(std::abs((pos >> 3) - (other_pos >> 3)), std::abs((pos & 0b111) - (other_pos & 0b111)));
+}
+
+/**
+ * @return the squares a king on each square can move to (as a bitboard with bit i for square i)
+ */
+static const std::array<uint64_t, BOARD_SIZE>& king_moves() {
+  static const std::array<uint64_t, BOARD_SIZE> moves = [] {
+    std::array<uint64_t, BOARD_SIZE> result = {};
+    for (int pos = 0; pos < BOARD_SIZE; ++pos) {
+      for (int other_pos = 0; other_pos < BOARD_SIZE; ++other_pos) {
+        if (king_distance(pos, other_pos) == 1) result[pos] |= uint64_t(1) << other_pos;
+      }
+    }
+    return result;
+  }();
+  return moves;
+}
+
+/**
+ * @param pawn the square of the pawn of the strong team
+ * @return the squares the pawn attacks (as a bitboard)
+ */
+static uint64_t pawn_attacks(int pawn) {
+  uint64_t attacks = 0;
+  if ((pawn & 0b111) > 0) attacks |= uint64_t(1) << (pawn - 9);
+  if ((pawn & 0b111) < 7) attacks |= uint64_t(1) << (pawn - 7);
+  return attacks;
+}
+
+/**
+ * @param board a board of the bitbase
+ * @return the result of the board if it is directly known, otherwise UNKNOWN
+ */
+static KpkResult initial_result(KpkBoard board) {
+  const uint64_t pawn_bit = uint64_t(1) << board.pawn;
+  if (king_distance(board.strong_king, board.weak_king) <= 1 || board.strong_king == board.pawn ||
+      board.weak_king == board.pawn)
+    return INVALID;
+  // the king of the weak team can be captured
+  if (!board.weak_to_move && (pawn_attacks(board.pawn) & (uint64_t(1) << board.weak_king)) != 0) return INVALID;
+
+  const uint64_t weak_moves = king_moves()[board.weak_king];
+  const uint64_t strong_attacks = king_moves()[board.strong_king];
+  const int promotion_pos = board.pawn - 8;
+  // the pawn promotes without the new queen being captured
+  if (!board.weak_to_move && (board.pawn >> 3) == 1 && board.strong_king != promotion_pos &&
+      (king_distance(board.weak_king, promotion_pos) > 1 || king_distance(board.strong_king, promotion_pos) == 1))
+    return WIN;
+  // stalemate
+  if (board.weak_to_move && (weak_moves & ~(strong_attacks | pawn_attacks(board.pawn))) == 0) return DRAW;
+  // the pawn gets captured
+  if (board.weak_to_move && (weak_moves & ~strong_attacks & pawn_bit) != 0) return DRAW;
+  return UNKNOWN;
+}
+
+/**
+ * @brief classifies a board from the current classification of the boards after each of its moves
+ *
+ * @param results the current classification of all boards
+ * @param board a board of the bitbase with an UNKNOWN result
+ * @return WIN or DRAW if one move of the team to move reaches its best result or all moves reach the worse result,
+ * otherwise still UNKNOWN
+ */
+static KpkResult classify(const std::vector<uint8_t>& results, KpkBoard board) {
+  const KpkResult good = board.weak_to_move ? DRAW : WIN;
+  const KpkResult bad = board.weak_to_move ? WIN : DRAW;
+  int reachable = INVALID;
+
+  const int8_t king = board.weak_to_move ? board.weak_king : board.strong_king;
+  for (int row_offset = -1; row_offset <= 1; ++row_offset) {
+    for (int file_offset = -1; file_offset <= 1; ++file_offset) {
+      const int row = (king >> 3) + row_offset;
+      const int file = (king & 0b111) + file_offset;
+      if ((row_offset == 0 && file_offset == 0) || row < 0 || row > 7 || file < 0 || file > 7) continue;
+      KpkBoard next = board;
+      (board.weak_to_move ? next.weak_king : next.strong_king) = static_cast<int8_t>(row * 8 + file);
+      next.weak_to_move = !board.weak_to_move;
+      // moves next to the other king or onto an attacked square reach an INVALID board
+      reachable |= results[kpk_index(next)];
+    }
+  }
+
+  if (!board.weak_to_move) {
+    KpkBoard next = board;
+    next.weak_to_move = true;
+    // (a promotion is already classified by initial_result())
+    if ((board.pawn >> 3) > 1) {
+      next.pawn = static_cast<int8_t>(board.pawn - 8);
+      // a blocked pawn reaches an INVALID board, which does not change the result
+      reachable |= results[kpk_index(next)];
+    }
+    const int8_t single_step = static_cast<int8_t>(board.pawn - 8);
+    if ((board.pawn >> 3) == 6 && single_step != board.strong_king && single_step != board.weak_king) {
+      next.pawn = static_cast<int8_t>(board.pawn - 16);
+      reachable |= results[kpk_index(next)];
+    }
+  }
+
+  if (reachable & good) return good;
+  if (reachable & UNKNOWN) return UNKNOWN;
+  return bad;
+}
+
+/**
+ * @return the bitbase, generated on the first call
+ */
+static const KpkBits& kpk_bits() {
+  static const KpkBits bits = [] {
+    std::vector<uint8_t> results(amount_boards);
+    for (int idx = 0; idx < amount_boards; ++idx) results[idx] = initial_result(kpk_board(idx));
+
+    // every pass can classify the boards one move further away from the directly known ones
+    bool changed = true;
+    while (changed) {
+      changed = false;
+      for (int idx = 0; idx < amount_boards; ++idx) {
+        if (results[idx] != UNKNOWN) continue;
+        results[idx] = classify(results, kpk_board(idx));
+        changed |= results[idx] != UNKNOWN;
+      }
+    }
+
+    // the boards that are still unknown can never be won, so they are draws
+    KpkBits result = {};
+    for (int idx = 0; idx < amount_boards; ++idx) {
+      if (results[idx] == WIN) result[idx / 64] |= uint64_t(1) << (idx % 64);
+    }
+    return result;
+  }();
+  return bits;
+}
+
+/**
+ * @param board a board with a king and a pawn against a king
+ * @param player the player who can currently make a move
+ * @param strong set to the team with the pawn
+ * @return the board from the view of the team with the pawn (see KpkBoard)
+ */
+static KpkBoard normalize(const Board& board, Team::Team player, Team::Team& strong) {
+  strong = board.positions.hasPiece(Team::WHITE, PieceType::PAWN) ? Team::WHITE : Team::BLACK;
+  const Team::Team weak = Team::getEnemyTeam(strong);
+  int8_t pawn = board.positions.getVec(strong, PieceType::PAWN)[0];
+  // black pawns move to larger rows, so the rows get flipped
+  const int8_t flip_row = strong == Team::WHITE ? 0 : 56;
+  const int8_t flip_file = (pawn & 0b111) > 3 ? 7 : 0;
+  const int8_t flip = static_cast<int8_t>(flip_row | flip_file);
+  pawn = static_cast<int8_t>(pawn ^ flip);
+  return {static_cast<int8_t>(board.positions.getKingPos(strong) ^ flip),
+          static_cast<int8_t>(board.positions.getKingPos(weak) ^ flip), pawn, player == weak};
+}
+
+namespace Kpk {
+
+// (function documentation is provided in the corresponding header)
+void init() { kpk_bits(); }
+
+// (function documentation is provided in the corresponding header)
+bool isKpk(const Board& board) noexcept {
+  int amount_pawns = 0;
+  for (Team::Team team : {Team::WHITE, Team::BLACK}) {
+    if (!board.positions.hasPiece(team, PieceType::KING)) return false;
+    for (int type = PieceType::QUEEN; type < PieceType::PAWN; ++type) {
+      if (board.positions.hasPiece(team, static_cast<PieceType::PieceType>(type))) return false;
+    }
+    amount_pawns += board.positions.getAmount(team, PieceType::PAWN);
+  }
+  if (amount_pawns != 1) return false;
+  const Team::Team strong = board.positions.hasPiece(Team::WHITE, PieceType::PAWN) ? Team::WHITE : Team::BLACK;
+  const int row = board.positions.getVec(strong, PieceType::PAWN)[0] >> 3;
+  return row != 0 && row != 7;
+}
+
+// (function documentation is provided in the corresponding header)
+bool isWin(const Board& board, Team::Team player) {
+  Team::Team strong = Team::WHITE;
+  const int idx = kpk_index(normalize(board, player, strong));
+  return (kpk_bits()[idx / 64] >> (idx % 64)) & 1;
+}
+
+// (function documentation is provided in the corresponding header)
+int evaluate(const Board& board, Team::Team player) {
+  Team::Team strong = Team::WHITE;
+  const KpkBoard kpk = normalize(board, player, strong);
+  const int idx = kpk_index(kpk);
+  if (((kpk_bits()[idx / 64] >> (idx % 64)) & 1) == 0) return 0;
+  // moving the pawn forward and keeping the defending king away from it is progress
+  const int advance = 6 - (kpk.pawn >> 3);
+  const int score = win_score + 24 * (30 * advance + 5 * king_distance(kpk.weak_king, kpk.pawn));
+  return strong == Team::WHITE ? score : -score;
+}
+}  // namespace Kpk
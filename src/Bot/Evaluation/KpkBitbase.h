@@ -0,0 +1,61 @@
+//
+// Created by timap on 18.10.2026.
+//
+
+#pragma once
+
+#include <cstdint>
+
+#include "../../Board/Board.h"
+
+/**
+ * @brief a bitbase with the perfect result of every board with only a king and a pawn against a king (KPK)
+ *
+ * @note generated once (on the first lookup, or with init()) by retrograde analysis: starting from the boards whose
+ * result is directly known (a safe promotion, a stalemate or a capture of the pawn), the boards before them get
+ * classified again and again until nothing changes anymore, every board that is still unknown is then a draw. \n
+ * The boards are looked up from the view of the team with the pawn moving to row 8, with the pawn on the files a to d
+ * (the other files are mirrored), so only one bit per board is needed: 2 * 24 * 64 * 64 bits = 24 KB
+ */
+namespace Kpk {
+/**
+ * @brief the score of a won KPK board before the bonus for the advance of the pawn (in the scale of evaluateBoard(),
+ * i.e. centipawns * 24)
+ *
+ * @note smaller than the score of a queen, so that promoting the pawn is still better than keeping it
+ */
+constexpr int win_score = 400 * 24;
+
+/**
+ * @brief generates the bitbase, if it was not generated yet
+ *
+ * @note thread safe, and also called by every lookup, so calling it is only needed to not pay for the generation
+ * during the first lookup
+ */
+void init();
+
+/**
+ * @param board the current board state
+ * @return true if the board has both kings and only a single pawn besides them (which is not on the first or last row)
+ */
+bool isKpk(const Board& board) noexcept;
+
+/**
+ * @param board a board with a king and a pawn against a king (see isKpk())
+ * @param player the player who can currently make a move
+ * @return true if the team with the pawn wins with perfect play, false if it is a draw
+ *
+ * @note boards which can not be reached in a game (e.g. the enemy king can be captured directly) are draws
+ */
+bool isWin(const Board& board, Team::Team player);
+
+/**
+ * @brief Evaluates a board with a king and a pawn against a king with the bitbase.
+ *
+ * @param board a board with a king and a pawn against a king (see isKpk())
+ * @param player the player who can currently make a move
+ * @return 0 for a draw, otherwise win_score plus a bonus for the advance of the pawn and the distance of the defending
+ * king, positive if white has the pawn and negative if black has it
+ */
+int evaluate(const Board& board, Team::Team player);
+}  // namespace Kpk
@@ -0,0 +1,336 @@
+//
+// Created by timap on 18.10.2026.
+//
+#include "Nnue.h"
+
+#include <algorithm>
+#include <array>
+#include <fstream>
+
+#if defined(__AVX2__) || defined(__SSE4_1__)
+#include <immintrin.h>
+#endif
+
+// the SIMD layers work on 32 activations and 4 neurons at a time
+static_assert(2 * Nnue::hidden_size % 32 == 0 && Nnue::layer_1_size % 32 == 0);
+static_assert(Nnue::layer_1_size % 4 == 0 && Nnue::layer_2_size % 4 == 0);
+
+/**
+ * @brief the dot product of the activations of a layer with the weights of a neuron, without SIMD instructions
+ *
+ * @param input the activations (0..=activation_max)
+ * @param weights the weights of the neuron
+ * @param size the amount of activations
+ * @return the sum of the products
+ */
+static int32_t dot_scalar(const uint8_t* input, const int8_t* weights, int size) noexcept {
+  int32_t sum = 0;
+  for (int i = 0; i < size; ++i) sum += static_cast<int32_t>(input[i]) * weights[i];
+  return sum;
+}
+
+/**
+ * @brief the sums of the neurons of a layer (bias plus the dot product of the activations with the weights), without
+ * SIMD instructions
+ *
+ * @param input the activations of the previous layer (0..=activation_max)
+ * @param input_size the amount of activations
+ * @param weights the weights of the layer (indexed with [neuron * input_size + input])
+ * @param bias the bias of each neuron
+ * @param output set to the sum of each neuron
+ * @param output_size the amount of neurons
+ */
+static void affine_scalar(const uint8_t* input, int input_size, const int8_t* weights, const int32_t* bias,
+                          int32_t* output, int output_size) noexcept {
+  for (int i = 0; i < output_size; ++i) output[i] = bias[i] + dot_scalar(input, weights + i * input_size, input_size);
+}
+
+/**
+ * @brief the sums of the neurons of a layer, with the available SIMD instructions
+ *
+ * @note the same as affine_scalar(), but input and weights have to be aligned to 32 bytes, input_size has to be a
+ * multiple of 32 and output_size a multiple of 4. \n
+ * The pairwise products are added as int16 (maddubs), which can not overflow as the activations are at most 127. \n
+ * Four neurons are calculated together, so that their sums can be added up horizontally at the same time
+ */
+static void affine_simd(const uint8_t* input, int input_size, const int8_t* weights, const int32_t* bias,
+                        int32_t* output, int output_size) noexcept {
+#if defined(__AVX2__)
+  const __m256i ones = _mm256_set1_epi16(1);
+  for (int i = 0; i < output_size; i += 4) {
+    __m256i sums[4] = {_mm256_setzero_si256(), _mm256_setzero_si256(), _mm256_setzero_si256(),
+                       _mm256_setzero_si256()};
+    for (int j = 0; j < input_size; j += 32) {
+      const __m256i in = _mm256_load_si256(reinterpret_cast<const __m256i*>(input + j));
+      for (int k = 0; k < 4; ++k) {
+        const __m256i w = _mm256_load_si256(reinterpret_cast<const __m256i*>(weights + (i + k) * input_size + j));
+        sums[k] = _mm256_add_epi32(sums[k], _mm256_madd_epi16(_mm256_maddubs_epi16(in, w), ones));
+      }
+    }
+    const __m256i sum = _mm256_hadd_epi32(_mm256_hadd_epi32(sums[0], sums[1]), _mm256_hadd_epi32(sums[2], sums[3]));
+    const __m128i sum_128 = _mm_add_epi32(_mm256_castsi256_si128(sum), _mm256_extracti128_si256(sum, 1));
+    const __m128i biased = _mm_add_epi32(sum_128, _mm_loadu_si128(reinterpret_cast<const __m128i*>(bias + i)));
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(output + i), biased);
+  }
+#elif defined(__SSE4_1__)
+  const __m128i ones = _mm_set1_epi16(1);
+  for (int i = 0; i < output_size; i += 4) {
+    __m128i sums[4] = {_mm_setzero_si128(), _mm_setzero_si128(), _mm_setzero_si128(), _mm_setzero_si128()};
+    for (int j = 0; j < input_size; j += 16) {
+      const __m128i in = _mm_load_si128(reinterpret_cast<const __m128i*>(input + j));
+      for (int k = 0; k < 4; ++k) {
+        const __m128i w = _mm_load_si128(reinterpret_cast<const __m128i*>(weights + (i + k) * input_size + j));
+        sums[k] = _mm_add_epi32(sums[k], _mm_madd_epi16(_mm_maddubs_epi16(in, w), ones));
+      }
+    }
+    const __m128i sum = _mm_hadd_epi32(_mm_hadd_epi32(sums[0], sums[1]), _mm_hadd_epi32(sums[2], sums[3]));
+    const __m128i biased = _mm_add_epi32(sum, _mm_loadu_si128(reinterpret_cast<const __m128i*>(bias + i)));
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(output + i), biased);
+  }
+#else
+  affine_scalar(input, input_size, weights, bias, output, output_size);
+#endif
+}
+
+/**
+ * @brief the clipped ReLU of a hidden neuron
+ * @param sum the bias plus the dot product of the neuron
+ * @return the activation of the neuron (0..=activation_max)
+ */
+static constexpr uint8_t clipped_relu(int32_t sum) noexcept {
+  return static_cast<uint8_t>(std::clamp(sum >> Nnue::weight_shift, 0, Nnue::activation_max));
+}
+
+/**
+ * @brief calculates the output of the network
+ *
+ * @tparam use_simd whether the dot products use SIMD instructions
+ * @param network the weights
+ * @param accumulator the accumulators of the board
+ * @param player the player who can currently make a move
+ * @return the score in the scale of evaluateBoard() (positive value: white's advantage)
+ */
+template <bool use_simd>
+static int propagate_impl(const Nnue::Network& network, const Nnue::Accumulator& accumulator,
+                          Team::Team player) noexcept {
+  const auto affine = use_simd ? affine_simd : affine_scalar;
+
+  // the accumulator of the player to move comes first, so the network always sees the board from the mover's side
+  alignas(32) uint8_t transformed[2 * Nnue::hidden_size];
+  const Team::Team perspectives[2] = {player, Team::getEnemyTeam(player)};
+  for (int half = 0; half < 2; ++half) {
+    const int16_t* values = accumulator.values[perspectives[half]];
+    for (int i = 0; i < Nnue::hidden_size; ++i) {
+      transformed[half * Nnue::hidden_size + i] =
+          static_cast<uint8_t>(std::clamp<int>(values[i], 0, Nnue::activation_max));
+    }
+  }
+
+  int32_t sums[Nnue::layer_1_size];
+  affine(transformed, 2 * Nnue::hidden_size, &network.layer_1_weights[0][0], network.layer_1_bias, sums,
+         Nnue::layer_1_size);
+  alignas(32) uint8_t layer_1[Nnue::layer_1_size];
+  for (int i = 0; i < Nnue::layer_1_size; ++i) layer_1[i] = clipped_relu(sums[i]);
+
+  affine(layer_1, Nnue::layer_1_size, &network.layer_2_weights[0][0], network.layer_2_bias, sums,
+         Nnue::layer_2_size);
+  alignas(32) uint8_t layer_2[Nnue::layer_2_size];
+  for (int i = 0; i < Nnue::layer_2_size; ++i) layer_2[i] = clipped_relu(sums[i]);
+
+  // a single neuron, so there is nothing to gain from SIMD instructions
+  const int32_t output = network.output_bias + dot_scalar(layer_2, network.output_weights, Nnue::layer_2_size);
+  const int score = output / Nnue::output_divisor * Nnue::score_scale;
+  return player == Team::WHITE ? score : -score;
+}
+
+/**
+ * @return the sizes of the network, in the order they are stored in a network file
+ */
+static constexpr std::array<uint32_t, 4> network_sizes() noexcept {
+  return {Nnue::feature_amount, Nnue::hidden_size, Nnue::layer_1_size, Nnue::layer_2_size};
+}
+
+/**
+ * @brief the network loaded by loadNetwork()
+ */
+static std::unique_ptr<Nnue::Network>& loaded_network() {
+  static std::unique_ptr<Nnue::Network> network = nullptr;
+  return network;
+}
+
+namespace Nnue {
+
+// (function documentation is provided in the corresponding header)
+void refreshAccumulator(const Network& network, const Board& board, Team::Team perspective,
+                        Accumulator& accumulator) noexcept {
+  int16_t* values = accumulator.values[perspective];
+  std::copy(network.feature_bias, network.feature_bias + hidden_size, values);
+  const int8_t king_pos = board.positions.getKingPos(perspective);
+  for (Team::Team team : {Team::BLACK, Team::WHITE}) {
+    for (int i = PieceType::QUEEN; i < PIECETYPE_AMOUNT; ++i) {
+      const Piece piece = Piece(team, static_cast<PieceType::PieceType>(i));
+      const Board_Positions::PositionsSlice pieces = board.positions.getVec(team, piece.type);
+      for (int j = 0; j < pieces.size; ++j) {
+        const int16_t* weights = network.feature_weights[featureIndex(perspective, king_pos, piece, pieces[j])];
+        for (int k = 0; k < hidden_size; ++k) values[k] += weights[k];
+      }
+    }
+  }
+}
+
+// (function documentation is provided in the corresponding header)
+int propagate(const Network& network, const Accumulator& accumulator, Team::Team player) noexcept {
+  return propagate_impl<true>(network, accumulator, player);
+}
+
+// (function documentation is provided in the corresponding header)
+int propagateScalar(const Network& network, const Accumulator& accumulator, Team::Team player) noexcept {
+  return propagate_impl<false>(network, accumulator, player);
+}
+
+// (function documentation is provided in the corresponding header)
+int evaluate(const Network& network, const Board& board, Team::Team player) noexcept {
+  Accumulator accumulator;
+  refreshAccumulator(network, board, Team::WHITE, accumulator);
+  refreshAccumulator(network, board, Team::BLACK, accumulator);
+  return propagate(network, accumulator, player);
+}
+
+// (function documentation is provided in the corresponding header)
+std::unique_ptr<Network> readNetwork(std::istream& in) {
+  char magic[4] = {};
+  uint32_t version = 0;
+  std::array<uint32_t, 4> sizes = {};
+  in.read(magic, sizeof(magic));
+  in.read(reinterpret_cast<char*>(&version), sizeof(version));
+  in.read(reinterpret_cast<char*>(sizes.data()), sizeof(sizes));
+  if (!in || std::string_view(magic, sizeof(magic)) != file_magic || version != file_version ||
+      sizes != network_sizes())
+    return nullptr;
+
+  std::unique_ptr<Network> network = std::make_unique<Network>();
+  in.read(reinterpret_cast<char*>(network->feature_bias), sizeof(network->feature_bias));
+  in.read(reinterpret_cast<char*>(network->feature_weights), sizeof(network->feature_weights));
+  in.read(reinterpret_cast<char*>(network->layer_1_bias), sizeof(network->layer_1_bias));
+  in.read(reinterpret_cast<char*>(network->layer_1_weights), sizeof(network->layer_1_weights));
+  in.read(reinterpret_cast<char*>(network->layer_2_bias), sizeof(network->layer_2_bias));
+  in.read(reinterpret_cast<char*>(network->layer_2_weights), sizeof(network->layer_2_weights));
+  in.read(reinterpret_cast<char*>(&network->output_bias), sizeof(network->output_bias));
+  in.read(reinterpret_cast<char*>(network->output_weights), sizeof(network->output_weights));
+  if (!in) return nullptr;
+  return network;
+}
+
+// (function documentation is provided in the corresponding header)
+bool writeNetwork(std::ostream& out, const Network& network) {
+  const uint32_t version = file_version;
+  const std::array<uint32_t, 4> sizes = network_sizes();
+  out.write(file_magic.data(), static_cast<std::streamsize>(file_magic.size()));
+  out.write(reinterpret_cast<const char*>(&version), sizeof(version));
+  out.write(reinterpret_cast<const char*>(sizes.data()), sizeof(sizes));
+  out.write(reinterpret_cast<const char*>(network.feature_bias), sizeof(network.feature_bias));
+  out.write(reinterpret_cast<const char*>(network.feature_weights), sizeof(network.feature_weights));
+  out.write(reinterpret_cast<const char*>(network.layer_1_bias), sizeof(network.layer_1_bias));
+  out.write(reinterpret_cast<const char*>(network.layer_1_weights), sizeof(network.layer_1_weights));
+  out.write(reinterpret_cast<const char*>(network.layer_2_bias), sizeof(network.layer_2_bias));
+  out.write(reinterpret_cast<const char*>(network.layer_2_weights), sizeof(network.layer_2_weights));
+  out.write(reinterpret_cast<const char*>(&network.output_bias), sizeof(network.output_bias));
+  out.write(reinterpret_cast<const char*>(network.output_weights), sizeof(network.output_weights));
+  return static_cast<bool>(out);
+}
+
+// (function documentation is provided in the corresponding header)
+bool loadNetwork(const std::string& path) {
+  std::ifstream file(path, std::ios::binary);
+  if (!file) return false;
+  std::unique_ptr<Network> network = readNetwork(file);
+  if (network == nullptr) return false;
+  loaded_network() = std::move(network);
+  return true;
+}
+
+// (function documentation is provided in the corresponding header)
+const Network* loadedNetwork() noexcept { return loaded_network().get(); }
+
+// (function documentation is provided in the corresponding header)
+void AccumulatorStack::reset(const Network& root_network, const Board& board) noexcept {
+  network = &root_network;
+  top = 0;
+  refreshAccumulator(*network, board, Team::WHITE, stack[0]);
+  refreshAccumulator(*network, board, Team::BLACK, stack[0]);
+}
+
+// (function documentation is provided in the corresponding header)
+void AccumulatorStack::push(const Board& board, Move move) noexcept {
+  // the pieces (and their squares) that the move removes from and adds to the board, kings are no features
+  Piece removed[2] = {};
+  int8_t removed_pos[2] = {};
+  int amount_removed = 0;
+  Piece added[2] = {};
+  int8_t added_pos[2] = {};
+  int amount_added = 0;
+
+  const Team::Team team = move.piece.team;
+  if (move.piece.type != PieceType::KING) {
+    removed[amount_removed] = move.piece;
+    removed_pos[amount_removed++] = move.from;
+    added[amount_added] = move.promote.has_value() ? Piece(team, move.promote.data) : move.piece;
+    added_pos[amount_added++] = move.to;
+  }
+  const int8_t capture_pos = move.specialMove.data == SpecialMove::en_Passant
+                                 ? board.extra.getPosOfPassantablePiece().data
+                                 : move.to;
+  const Piece capture = board.grid[capture_pos];
+  if (capture.team != Team::NONE && capture.type != PieceType::KING) {
+    removed[amount_removed] = capture;
+    removed_pos[amount_removed++] = capture_pos;
+  }
+  if (move.specialMove.data == SpecialMove::CastleKingSide || move.specialMove.data == SpecialMove::CastleQueenSide) {
+    const bool king_side = move.specialMove.data == SpecialMove::CastleKingSide;
+    removed[amount_removed] = Piece(team, PieceType::CASTLE);
+    removed_pos[amount_removed++] = static_cast<int8_t>(king_side ? move.from + 3 : move.from - 4);
+    added[amount_added] = Piece(team, PieceType::CASTLE);
+    added_pos[amount_added++] = static_cast<int8_t>(king_side ? move.from + 1 : move.from - 1);
+  }
+
+  const Accumulator& parent = stack[top];
+  Accumulator& child = stack[++top];
+  for (Team::Team perspective : {Team::BLACK, Team::WHITE}) {
+    int16_t* values = child.values[perspective];
+
+    if (move.piece.type == PieceType::KING && team == perspective) {
+      // all features depend on the own king, so the accumulator is calculated from the pieces after the move
+      std::copy(network->feature_bias, network->feature_bias + hidden_size, values);
+      for (Team::Team piece_team : {Team::BLACK, Team::WHITE}) {
+        for (int i = PieceType::QUEEN; i < PIECETYPE_AMOUNT; ++i) {
+          const Piece piece = Piece(piece_team, static_cast<PieceType::PieceType>(i));
+          const Board_Positions::PositionsSlice pieces = board.positions.getVec(piece_team, piece.type);
+          for (int j = 0; j < pieces.size; ++j) {
+            if (amount_removed > 0 && pieces[j] == removed_pos[0]) continue;
+            if (amount_removed > 1 && pieces[j] == removed_pos[1]) continue;
+            const int16_t* weights = network->feature_weights[featureIndex(perspective, move.to, piece, pieces[j])];
+            for (int k = 0; k < hidden_size; ++k) values[k] += weights[k];
+          }
+        }
+      }
+      for (int i = 0; i < amount_added; ++i) {
+        const int16_t* weights = network->feature_weights[featureIndex(perspective, move.to, added[i], added_pos[i])];
+        for (int k = 0; k < hidden_size; ++k) values[k] += weights[k];
+      }
+      continue;
+    }
+
+    const int8_t king_pos = board.positions.getKingPos(perspective);
+    std::copy(parent.values[perspective], parent.values[perspective] + hidden_size, values);
+    for (int i = 0; i < amount_removed; ++i) {
+      const int16_t* weights =
+          network->feature_weights[featureIndex(perspective, king_pos, removed[i], removed_pos[i])];
+      for (int k = 0; k < hidden_size; ++k) values[k] -= weights[k];
+    }
+    for (int i = 0; i < amount_added; ++i) {
+      const int16_t* weights = network->feature_weights[featureIndex(perspective, king_pos, added[i], added_pos[i])];
+      for (int k = 0; k < hidden_size; ++k) values[k] += weights[k];
+    }
+  }
+}
+}  // namespace Nnue
@@ -0,0 +1,256 @@
+//
+// Created by timap on 18.10.2026.
+//
+
+#pragma once
+
+#include <cstdint>
+#include <istream>
+#include <memory>
+#include <ostream>
+#include <string>
+#include <string_view>
+
+#include "../../Board/Board.h"
+#include "../MinMax/SearchTypes.h"
+
+/**
+ * @brief an optional neural network evaluation (NNUE) with HalfKP input features
+ *
+ * the network is made up of: \n
+ * 1. a feature transformer from the HalfKP features of each team (the square of the own king combined with the team,
+ * type and square of a non king piece) to an accumulator of hidden_size int16 values per team \n
+ * 2. two small int8 layers with clipped ReLU on the concatenated accumulators (the team to move first) \n
+ * 3. a single int8 output neuron
+ *
+ * @note the search only uses the network if the engine is built with -DUSE_NNUE and a network was loaded
+ * (see loadNetwork()), otherwise evaluateBoard() is used. \n
+ * The accumulators are not part of Board (copying them would make every copied board about 1 KB larger), instead
+ * the search keeps them in an AccumulatorStack that is updated with every made move and popped when it is undone.
+ */
+namespace Nnue {
+/**
+ * @brief the amount of squares a king can be on
+ */
+constexpr int king_squares = BOARD_SIZE;
+/**
+ * @brief the amount of different non king pieces per king square (own and enemy pieces of 5 types on 64 squares)
+ */
+constexpr int piece_features = TEAM_AMOUNT * 5 * BOARD_SIZE;
+/**
+ * @brief the amount of HalfKP input features per team
+ */
+constexpr int feature_amount = king_squares * piece_features;
+/**
+ * @brief the size of the accumulator of each team
+ */
+constexpr int hidden_size = 128;
+/**
+ * @brief the sizes of the two hidden layers after the feature transformer
+ */
+constexpr int layer_1_size = 32;
+constexpr int layer_2_size = 32;
+/**
+ * @brief the maximum value of the clipped ReLU activations (the activations fit into an uint8)
+ */
+constexpr int activation_max = 127;
+/**
+ * @brief the right shift applied to the sums of the hidden layers to get back to the activation range
+ */
+constexpr int weight_shift = 6;
+/**
+ * @brief the divisor of the sum of the output neuron to get centipawns
+ */
+constexpr int output_divisor = 16;
+/**
+ * @brief the factor between centipawns and the scores of evaluateBoard() (the maximum game phase of 24)
+ */
+constexpr int score_scale = 24;
+
+/**
+ * @brief the magic at the start of a network file
+ */
+constexpr std::string_view file_magic = "CNUE";
+/**
+ * @brief the version of the network file format
+ */
+constexpr uint32_t file_version = 1;
+
+/**
+ * @brief the quantized weights of a network
+ *
+ * @note about 10 MB large (mostly the feature transformer), so it should only be created on the heap
+ */
+struct Network {
+  alignas(32) int16_t feature_bias[hidden_size];
+  /**
+   * @brief the weights of each input feature (indexed with [feature][hidden])
+   */
+  alignas(32) int16_t feature_weights[feature_amount][hidden_size];
+  alignas(32) int32_t layer_1_bias[layer_1_size];
+  /**
+   * @brief the weights of each neuron of the first layer (indexed with [neuron][input])
+   */
+  alignas(32) int8_t layer_1_weights[layer_1_size][2 * hidden_size];
+  alignas(32) int32_t layer_2_bias[layer_2_size];
+  alignas(32) int8_t layer_2_weights[layer_2_size][layer_1_size];
+  int32_t output_bias;
+  alignas(32) int8_t output_weights[layer_2_size];
+};
+
+/**
+ * @brief the accumulators of both teams of a board (the sum of the weights of all active features plus the bias)
+ */
+struct Accumulator {
+  /**
+   * @brief indexed with [team][hidden]
+   */
+  alignas(32) int16_t values[TEAM_AMOUNT][hidden_size];
+};
+
+/**
+ * @brief the index of a HalfKP feature
+ *
+ * @param perspective the team whose accumulator the feature belongs to
+ * @param king_pos the square of the king of perspective
+ * @param piece a non king piece
+ * @param pos the square of the piece
+ * @return the index of the feature (0 ..\< feature_amount)
+ *
+ * @note the squares are mirrored vertically for team black, so that both teams see the board from their side
+ */
+constexpr int featureIndex(Team::Team perspective, int8_t king_pos, Piece piece, int8_t pos) noexcept {
+  const int flip = perspective == Team::WHITE ? 0 : 56;
+  const int own = piece.team == perspective ? 0 : 1;
+  // the piece types without the king start at QUEEN (= 2)
+  const int piece_index = own * 5 + (piece.type - PieceType::QUEEN);
+  return (king_pos ^ flip) * piece_features + piece_index * BOARD_SIZE + (pos ^ flip);
+}
+
+/**
+ * @brief calculates the accumulator of a team from scratch
+ *
+ * @param network the weights
+ * @param board the current board state
+ * @param perspective the team whose accumulator gets calculated
+ * @param accumulator the accumulator to set the values of perspective of
+ */
+void refreshAccumulator(const Network& network, const Board& board, Team::Team perspective,
+                        Accumulator& accumulator) noexcept;
+
+/**
+ * @brief calculates the output of the network with the available SIMD instructions (AVX2, SSE4.1 or none)
+ *
+ * @param network the weights
+ * @param accumulator the accumulators of the board
+ * @param player the player who can currently make a move
+ * @return the score in the scale of evaluateBoard() (positive value: white's advantage)
+ */
+int propagate(const Network& network, const Accumulator& accumulator, Team::Team player) noexcept;
+
+/**
+ * @brief calculates the output of the network without SIMD instructions
+ * @return the same as propagate()
+ */
+int propagateScalar(const Network& network, const Accumulator& accumulator, Team::Team player) noexcept;
+
+/**
+ * @brief evaluates a board by calculating both accumulators from scratch
+ *
+ * @param network the weights
+ * @param board the current board state
+ * @param player the player who can currently make a move
+ * @return the score in the scale of evaluateBoard() (positive value: white's advantage)
+ */
+int evaluate(const Network& network, const Board& board, Team::Team player) noexcept;
+
+/**
+ * @brief reads a network (the magic, the version, the sizes and then all weights in the order of Network, in the byte
+ * order of the machine, i.e. little endian on all common machines)
+ *
+ * @param in the network file
+ * @return the network, or nullptr if the file is not a network file or its sizes do not fit
+ */
+std::unique_ptr<Network> readNetwork(std::istream& in);
+
+/**
+ * @brief writes a network in the format read by readNetwork()
+ *
+ * @param out the stream to write to
+ * @param network the network to write
+ * @return false if writing failed
+ */
+bool writeNetwork(std::ostream& out, const Network& network);
+
+/**
+ * @brief loads the network the search uses (replaces the previously loaded one)
+ *
+ * @param path the path of the network file
+ * @return false if the file could not be read (the previously loaded network stays loaded)
+ *
+ * @note must not be called while a search is running
+ */
+bool loadNetwork(const std::string& path);
+
+/**
+ * @return the network loaded by loadNetwork(), or nullptr if none was loaded
+ */
+const Network* loadedNetwork() noexcept;
+
+/**
+ * @brief the accumulators of the boards along the current line of a search (one per ply)
+ *
+ * @note push() updates the accumulators from the ones of the parent with only the features that the move changes,
+ * and pop() just goes back to the parent, so undoing a move costs nothing. \n
+ * Only a king move has to recalculate the accumulator of its own team, as all its features depend on the king square
+ */
+class AccumulatorStack {
+ private:
+  /**
+   * @brief the network of the accumulators
+   */
+  const Network* network = nullptr;
+  /**
+   * @brief the accumulators of the root and of each ply after it
+   */
+  Accumulator stack[MAX_SEARCH_PLY + 1];
+  /**
+   * @brief the index of the accumulator of the current board
+   */
+  int top = 0;
+
+ public:
+  /**
+   * @brief calculates the accumulators of the root of a search
+   * @param root_network the network to use
+   * @param board the board at the root of the search
+   */
+  void reset(const Network& root_network, const Board& board) noexcept;
+
+  /**
+   * @brief calculates the accumulators of the board after a move
+   *
+   * @param board the current board, before the move is made
+   * @param move the move that is going to be made
+   *
+   * @note at most MAX_SEARCH_PLY moves can be pushed at the same time
+   */
+  void push(const Board& board, Move move) noexcept;
+
+  /**
+   * @brief goes back to the accumulators of the board before the last pushed move
+   */
+  void pop() noexcept { top--; }
+
+  /**
+   * @param player the player who can currently make a move
+   * @return the score of the current board in the scale of evaluateBoard() (positive value: white's advantage)
+   */
+  [[nodiscard]] int evaluate(Team::Team player) const noexcept { return propagate(*network, stack[top], player); }
+
+  /**
+   * @return the accumulators of the current board
+   */
+  [[nodiscard]] const Accumulator& current() const noexcept { return stack[top]; }
+};
+}  // namespace Nnue
@@ -0,0 +1,15 @@
+//
+// Created by timap on 18.10.2026.
+//
+#include "PawnHashTable.h"
+
+#include <algorithm>
+
+// (function documentation is provided in the corresponding header)
+PawnHashTable::PawnHashTable(uint64_t size_kb) {
+  const uint64_t max_entries = std::max<uint64_t>(1, size_kb * 1024 / sizeof(PawnEntry));
+  uint64_t amount = 1;
+  while (amount * 2 <= max_entries) amount *= 2;
+  entries = std::vector<PawnEntry>(amount);
+  index_mask = amount - 1;
+}
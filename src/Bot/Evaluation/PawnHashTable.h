@@ -0,0 +1,111 @@
+//
+// Created by timap on 18.10.2026.
+//
+
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+/**
+ * @brief the score of the pawn structure (for white) for the midgame and the endgame
+ */
+struct PawnScore {
+  /**
+   * @brief the midgame value
+   */
+  int mg = 0;
+  /**
+   * @brief the endgame value
+   */
+  int eg = 0;
+};
+
+/**
+ * @brief the cached pawn structure of a board, found through the Zobrist hash of only its pawns
+ */
+struct PawnEntry {
+  /**
+   * @brief the pawn hash of the board (see Zobrist::hashPawns())
+   */
+  uint64_t key = 0;
+  /**
+   * @brief the score of the pawn structure
+   */
+  PawnScore score = PawnScore();
+};
+
+/**
+ * @brief a small fixed size hash table remembering the pawn structure scores of already evaluated boards
+ *
+ * @note the pawns change only with pawn moves and pawn captures, so nearly every evaluation in a search tree can
+ * reuse a cached score. \n
+ * An empty entry has the key 0, which is the pawn hash of a board without pawns, whose pawn structure score is 0, so
+ * it does not need to be marked as empty. \n
+ * Not thread safe, each search thread uses its own table
+ */
+class PawnHashTable {
+ private:
+  /**
+   * @brief the entries, with an amount that is a power of 2
+   */
+  std::vector<PawnEntry> entries;
+  /**
+   * @brief the amount of entries - 1, used to get the slot of a key
+   */
+  uint64_t index_mask;
+  /**
+   * @brief the amount of lookups so far
+   */
+  uint64_t amount_probes = 0;
+  /**
+   * @brief the amount of lookups so far that found their key
+   */
+  uint64_t amount_hits = 0;
+
+ public:
+  /**
+   * @brief the default size of a table in kilobytes
+   */
+  static constexpr uint64_t default_size_kb = 256;
+
+  /**
+   * @brief constructs an empty table
+   * @param size_kb the maximum size of the table in kilobytes (rounded down to a power of 2 amount of entries)
+   */
+  explicit PawnHashTable(uint64_t size_kb = default_size_kb);
+
+  /**
+   * @param key the pawn hash of the board
+   * @return the entry of the pawn structure, or nullptr if it is not in the table
+   */
+  [[nodiscard]] inline const PawnEntry* probe(uint64_t key) {
+    amount_probes++;
+    const PawnEntry& entry = entries[key & index_mask];
+    if (entry.key != key) return nullptr;
+    amount_hits++;
+    return &entry;
+  }
+
+  /**
+   * @brief stores the score of a pawn structure, replacing the old entry of the slot
+   * @param key the pawn hash of the board
+   * @param score the score of the pawn structure
+   */
+  inline void store(uint64_t key, PawnScore score) { entries[key & index_mask] = {key, score}; }
+
+  /**
+   * @return the amount of lookups since the table was constructed
+   */
+  [[nodiscard]] inline uint64_t probes() const { return amount_probes; }
+
+  /**
+   * @return the amount of lookups since the table was constructed that found a cached score
+   */
+  [[nodiscard]] inline uint64_t hits() const { return amount_hits; }
+
+  /**
+   * @return the amount of entries the table can hold
+   */
+  [[nodiscard]] inline uint64_t capacity() const { return entries.size(); }
+};
@@ -0,0 +1,53 @@
+//
+// Created by timap on 18.10.2026.
+//
+
+#pragma once
+
+#include "PawnHashTable.h"
+
+// the tunable constants of the evaluation besides the PeSTO tables (pesto_tables.h), "./Chess tune" writes a new
+// version of this header and of pesto_tables.h (see Bot/Tuning/Tuner.h)
+
+/**
+ * @brief Struct to hold the board value for midgame and endgame.
+ *
+ * @note
+ * mg = the midgame value \n
+ * eg = the endgame value
+ */
+struct BoardValue {
+  int mg = 0;
+  int eg = 0;
+};
+
+/**
+ * @brief Advantage for the player who is allowed to move next.
+ *
+ * @note only used when compiled with DIFFERENT_DEPTHS, so it is not tuned
+ */
+constexpr int movers_advantage = 15;
+/**
+ * @brief Factor for each piece that is next to and protecting the king
+ */
+constexpr int protected_king_factor = 1;
+
+/**
+ * @brief Penalty for each pawn behind another pawn of the same team on the same file.
+ */
+constexpr PawnScore doubled_pawn_penalty = {10, 20};
+/**
+ * @brief Penalty for each pawn without pawns of the same team on the neighbouring files.
+ */
+constexpr PawnScore isolated_pawn_penalty = {12, 15};
+/**
+ * @brief Bonus for a pawn without enemy pawns in front of it on its own and the neighbouring files, by the amount of
+ * rows it has moved forward from its starting row (at most 5, as it gets promoted after that).
+ */
+constexpr PawnScore passed_pawn_bonus[6] = {{0, 0}, {5, 10}, {10, 20}, {20, 40}, {35, 70}, {60, 120}};
+
+/**
+ * @brief Bonus for each square a piece of a type can safely move to (see AttackMaps::mobility), indexed by the type
+ * of the piece (kings and pawns are not counted).
+ */
+constexpr BoardValue mobility_bonus[7] = {{0, 0}, {0, 0}, {1, 2}, {4, 4}, {5, 5}, {2, 4}, {0, 0}};
@@ -4,13 +4,19 @@
 #include "MinMax.h"
 
 #include <algorithm>
+#include <atomic>
+#include <memory>
 #include <vector>
 
 #include "../../Check/Check.h"
 #include "../../PossibleMoves/PossibleMoves.h"
+#include "../../Profiling/Profiler.h"
+#include "../Evaluation/EvalCache.h"
 #include "../Evaluation/Evaluate.h"
-
-//  {BLACK, WHITE}
+#include "../Evaluation/KpkBitbase.h"
+#include "../Evaluation/Nnue.h"
+#include "../Tablebase/Tablebase.h"
+#include "../TranspositionTable/Zobrist.h"
 
 /*
  * Maximizes value: White
@@ -18,14 +24,197 @@
  */
 
 /**
- * @brief Array representing the best score a node can get for the current player \n
- * (i.e. infinites[Team::WHITE] is the best value for white).
+ * @brief the score of a board in which the given team can directly capture the enemy king
+ *
+ * @param team the team that can capture the enemy king
+ * @param ply the amount of half moves since the root of the search
+ * @return the best score a node can get for the given team \n
+ * (decreasing with ply, so that faster mates are preferred)
+ */
+constexpr int kingCaptureScore(Team::Team team, int ply) {
+  return team == Team::WHITE ? MATE_SCORE - ply : -(MATE_SCORE - ply);
+}
+
+/**
+ * @brief the score of a board that was looked up in the tablebases
+ *
+ * @param result the result of the board
+ * @param player the player who can currently make a move
+ * @param ply the amount of half moves since the root of the search
+ * @return 0 for a draw, otherwise the score the search would give the mate at the end of the perfect line
+ */
+constexpr int tablebaseScore(Tablebase::ProbeResult result, Team::Team player, int ply) {
+  if (result.wdl == Tablebase::Wdl::DRAW) return 0;
+  const Team::Team winner = result.wdl == Tablebase::Wdl::WIN ? player : Team::getEnemyTeam(player);
+  // the king of the mated player could be captured one half move after the mate
+  return kingCaptureScore(winner, ply + result.distance + 1);
+}
+
+/**
+ * @return the pawn hash table of the current thread, kept between searches because the pawns of consecutive searches
+ * are mostly the same
+ */
+static PawnHashTable& threadPawnTable() {
+  static thread_local PawnHashTable pawn_table = PawnHashTable();
+  return pawn_table;
+}
+
+/**
+ * @brief the size of the evaluation caches in kilobytes (see setEvalCacheSize())
+ */
+static std::atomic<uint64_t> eval_cache_size_kb = EvalCache::default_size_kb;
+
+// (function documentation is provided in the corresponding header)
+void setEvalCacheSize(uint64_t size_kb) { eval_cache_size_kb.store(size_kb, std::memory_order_relaxed); }
+
+/**
+ * @return the evaluation cache of the current thread, kept between searches and only recreated when its configured
+ * size changed (see setEvalCacheSize()), or cleared when the evaluation changed (i.e. another network was loaded)
+ */
+static EvalCache& threadEvalCache() {
+  static thread_local uint64_t size_kb = eval_cache_size_kb.load(std::memory_order_relaxed);
+  static thread_local EvalCache eval_cache = EvalCache(size_kb);
+  static thread_local const Nnue::Network* network = Nnue::loadedNetwork();
+  const uint64_t configured_kb = eval_cache_size_kb.load(std::memory_order_relaxed);
+  if (configured_kb != size_kb) {
+    size_kb = configured_kb;
+    eval_cache = EvalCache(size_kb);
+  }
+  if (Nnue::loadedNetwork() != network) {
+    network = Nnue::loadedNetwork();
+    eval_cache.clear();
+  }
+  return eval_cache;
+}
+
+/**
+ * @return the accumulator stack of the current thread, or nullptr if the search uses evaluateBoard() (i.e. the engine
+ * was built without USE_NNUE or no network was loaded)
+ */
+static Nnue::AccumulatorStack* threadAccumulators() {
+#ifdef USE_NNUE
+  if (Nnue::loadedNetwork() == nullptr) return nullptr;
+  // on the heap, as it is too large for the stack of a thread
+  static thread_local std::unique_ptr<Nnue::AccumulatorStack> accumulators = std::make_unique<Nnue::AccumulatorStack>();
+  return accumulators.get();
+#else
+  return nullptr;
+#endif
+}
+
+/**
+ * @brief everything the nodes of a single search share
+ */
+struct SearchContext {
+  /**
+   * @brief the statistics of the current search (e.g. counting each visited board as a node)
+   */
+  SearchStats& stats;
+  /**
+   * @brief can stop the search before it is finished, or nullptr if the search can not be stopped
+   */
+  SearchControl* control;
+  /**
+   * @brief remembers already searched boards across the search (and across searches), or nullptr to not use one
+   */
+  TranspositionTable* tt;
+  /**
+   * @brief the best line of moves of the current node at each ply (i.e. pv_table[ply + 1] is the line of the child)
+   * @note shared by all nodes, so that the lines do not have to be created for every single node
+   */
+  std::vector<PrincipalVariation> pv_table = std::vector<PrincipalVariation>(MAX_SEARCH_PLY + 1);
+  /**
+   * @brief caches the pawn structure scores of the evaluations (see threadPawnTable())
+   */
+  PawnHashTable& pawn_table = threadPawnTable();
+  /**
+   * @brief the accumulators of the neural network evaluation along the current line, or nullptr to use evaluateBoard()
+   * (see threadAccumulators())
+   */
+  Nnue::AccumulatorStack* nnue = threadAccumulators();
+  /**
+   * @brief caches the evaluations of the leaves (see threadEvalCache())
+   */
+  EvalCache& eval_cache = threadEvalCache();
+};
+
+/**
+ * @brief adds the pawn hash and evaluation cache lookups made during its lifetime to the statistics of a search
+ */
+class CacheStatsScope {
+ private:
+  /**
+   * @brief the context of the search
+   */
+  SearchContext& ctx;
+  /**
+   * @brief the amount of lookups of the pawn hash table at the start of the scope
+   */
+  uint64_t pawn_probes_at_start;
+  /**
+   * @brief the amount of hits of the pawn hash table at the start of the scope
+   */
+  uint64_t pawn_hits_at_start;
+  /**
+   * @brief the amount of lookups of the evaluation cache at the start of the scope
+   */
+  uint64_t eval_probes_at_start;
+  /**
+   * @brief the amount of hits of the evaluation cache at the start of the scope
+   */
+  uint64_t eval_hits_at_start;
+
+ public:
+  /**
+   * @param ctx the context of the search, whose statistics get the lookups
+   */
+  explicit CacheStatsScope(SearchContext& ctx)
+      : ctx(ctx),
+        pawn_probes_at_start(ctx.pawn_table.probes()),
+        pawn_hits_at_start(ctx.pawn_table.hits()),
+        eval_probes_at_start(ctx.eval_cache.probes()),
+        eval_hits_at_start(ctx.eval_cache.hits()) {}
+
+  ~CacheStatsScope() {
+    ctx.stats.pawn_hash_probes += ctx.pawn_table.probes() - pawn_probes_at_start;
+    ctx.stats.pawn_hash_hits += ctx.pawn_table.hits() - pawn_hits_at_start;
+    ctx.stats.eval_cache_probes += ctx.eval_cache.probes() - eval_probes_at_start;
+    ctx.stats.eval_cache_hits += ctx.eval_cache.hits() - eval_hits_at_start;
+  }
+
+  CacheStatsScope(const CacheStatsScope&) = delete;
+  CacheStatsScope& operator=(const CacheStatsScope&) = delete;
+};
+
+/**
+ * @brief moves the given move to the front of the move list, so that it gets searched first
+ * @param move_list the moves of a board
+ * @param move the move to search first (e.g. the best move of a previous search), ignored if it is not in the list
+ * @note the order of the other moves stays the same
+ */
+static void searchMoveFirst(std::vector<Move>& move_list, Move move) {
+  if (move.to < 0) return;
+  const auto it = std::find(move_list.begin(), move_list.end(), move);
+  if (it != move_list.end()) std::rotate(move_list.begin(), it, it + 1);
+}
+
+/**
+ * @brief searches the child node after a move, while keeping the accumulators of the neural network up to date
  *
- * This array is used to represent the maximum and minimum possible evaluation values for the MinMax algorithm.
- * The first element is the minimum value (for the black player), and the second element is the maximum value (for the
- * white player).
+ * @tparam Policy how the board of a child node is created and undone again (see MakeMovePolicy.h)
+ * @param ctx the context of the search
+ * @param board the current board
+ * @param move the move to the child node
+ * @param forChild searches the child: int(BoardType& child)
+ * @return the score of the child
  */
-constexpr int infinites[2] = {INT32_MIN, INT32_MAX};
+template <class Policy, typename fn>
+static int searchChild(SearchContext& ctx, typename Policy::BoardType& board, Move move, fn forChild) {
+  if (ctx.nnue != nullptr) ctx.nnue->push(board, move);
+  const int eval = Policy::withMove(board, move, forChild);
+  if (ctx.nnue != nullptr) ctx.nnue->pop();
+  return eval;
+}
 
 /**
  * @brief Implementation of the MinMax algorithm.
@@ -33,70 +222,180 @@ constexpr int infinites[2] = {INT32_MIN, INT32_MAX};
  * This function recursively explores the game tree to a given depth and evaluates the board states.
  * It uses alpha-beta pruning to cut off branches that do not need to be explored.
  *
- * @param board The previous board state to be updated to the current one by move
- * @param move The move to update the previous board state to the current one
+ * @tparam Policy how the board of a child node is created and, if needed, undone again (see MakeMovePolicy.h)
+ * @param ctx the statistics and the control of the current search
+ * @param board The current board state (i.e. with the move leading to this node already executed)
  * @param depth The depth to which the game tree should be explored
  * @param player The current player
 
  * @param alpha The best already explored option along the path to the root for the maximizer
  * @param beta The best already explored option along the path to the root for the minimizer
- * @param turn roughly the amount of half turns that have past
- * @return The evaluation value of the board state
+ * @param ply the amount of half moves since the root of the search (ctx.pv_table[ply] is set to the best line)
+ * @return The evaluation value of the board state (meaningless if the search was aborted)
  *
- * @note done like this with not using board.undoMove() and always copying the board because undoMove was
- * actually around 10% slower in the Perft test with O3 Optimization than just copying the whole board
+ * @note originally this always copied the board, because undoMove was actually around 10% slower in the Perft test
+ * with O3 Optimization than just copying the whole board. \n
+ * Since that trade-off changes with the board layout, the policy is now chosen at build time and can be compared in
+ * Test/benchmark/MakeMovePolicyBenchmark.cpp
  */
-static int MinMax_impl(Board board, int depth, Team::Team player, Move move, int alpha, int beta, int turn) {
-  // get the new board
-  board.movePiece(move);
+template <class Policy>
+static int MinMax_impl(SearchContext& ctx, typename Policy::BoardType& board, int depth, Team::Team player, int alpha,
+                       int beta, int ply) {
+  PROFILE_ZONE(MIN_MAX);
+  ctx.stats.nodes++;
+  PrincipalVariation& pv = ctx.pv_table[ply];
+  pv.length = 0;
+
+  // stop as fast as possible, the result gets thrown away anyway
+  if (ctx.control != nullptr && ctx.control->shouldAbort(ctx.stats.nodes)) return 0;
 
   Team::Team enemy = Team::getEnemyTeam(player);
 
   // return max value if the game has reached a terminal state
-  if (Check::isChecked(board, enemy, board.positions.getKingPos(enemy))) return infinites[player];
+  if (Check::isChecked(board, enemy, board.positions.getKingPos(enemy))) return kingCaptureScore(player, ply);
+
+  // boards with only a few pieces are known exactly from the tablebases, if they are loaded (cheap enough to be looked
+  // up at every node, and at the root it makes each move get the score of its perfect line)
+  Tablebase::ProbeResult tb_result;
+  if (Tablebase::loadedPieces() > 0 && Tablebase::probe(board, player, tb_result)) {
+    return tablebaseScore(tb_result, player, ply);
+  }
+
+  // a king and a pawn against a king is already known exactly, so it does not need to be searched any further
+  if (Kpk::isKpk(board)) return Kpk::evaluate(board, player);
 
   // otherwise if the search has reached the end with the depth left of 0 evaluate the board
-  if (depth <= 0) return evaluateBoard(board, player);
+  // (also when the search is too deep to remember the line of moves)
+  if (depth <= 0 || ply >= MAX_SEARCH_PLY) {
+    const uint64_t leaf_hash = Zobrist::hashBoard(board, player);
+    int score;
+    if (ctx.eval_cache.probe(leaf_hash, score)) return score;
+    if (ctx.nnue != nullptr) {
+      score = ctx.nnue->evaluate(player);
+    } else {
+      const WindowedEval eval = evaluateBoard(board, player, ctx.pawn_table, alpha, beta);
+      ctx.stats.windowed_evals++;
+      // only a bound, which must not be cached as the score of the board
+      if (eval.lazy) {
+        ctx.stats.lazy_evals++;
+        return eval.score;
+      }
+      score = eval.score;
+    }
+    ctx.eval_cache.store(leaf_hash, score);
+    return score;
+  }
+
+  // reuse the result of an earlier search of the same board, if it was deep enough and gives a usable score
+  const int alpha_before = alpha;
+  const int beta_before = beta;
+  uint64_t hash = 0;
+  Move tt_move = Move();
+  if (ctx.tt != nullptr) {
+    hash = Zobrist::hashBoard(board, player);
+    if (const TTEntry* entry = ctx.tt->probe(hash)) {
+      tt_move = entry->best_move;
+      const int tt_score = scoreFromTT(entry->score, ply);
+      if (entry->depth >= depth &&
+          (entry->bound == Bound::EXACT || (entry->bound == Bound::LOWER && tt_score >= beta) ||
+           (entry->bound == Bound::UPPER && tt_score <= alpha))) {
+        if (tt_move.to >= 0) {
+          pv.moves[0] = tt_move;
+          pv.length = 1;
+        }
+        return tt_score;
+      }
+    }
+  }
 
   // get all moves
   std::vector<Move> move_list;
   PossibleMoves::getAllPossibleMoves(board, move_list, player);
+  searchMoveFirst(move_list, tt_move);
+
+  // the score of a child in which the enemy can capture the king of player (i.e. the move was not legal)
+  const int illegal_move_score = kingCaptureScore(enemy, ply + 1);
+  const PrincipalVariation& child_pv = ctx.pv_table[ply + 1];
+  bool has_legal_move = false;
+  int best_eval = illegal_move_score;
+  Move best_move = Move();
 
   // go through all the moves
   if (player == Team::WHITE) {
-    int maxEval = INT32_MIN;
     for (Move nextMove : move_list) {
-      int eval = MinMax_impl(board, depth - 1, Team::BLACK, nextMove, alpha, beta, turn + 1);
-      maxEval = std::max(maxEval, eval);
+      int eval = searchChild<Policy>(ctx, board, nextMove, [&](typename Policy::BoardType& child) {
+        return MinMax_impl<Policy>(ctx, child, depth - 1, Team::BLACK, alpha, beta, ply + 1);
+      });
+      if (eval == illegal_move_score) continue;
+      if (!has_legal_move || eval > best_eval) {
+        best_eval = eval;
+        best_move = nextMove;
+        pv.update(nextMove, child_pv);
+      }
+      has_legal_move = true;
 
       alpha = std::max(alpha, eval);
       if (beta <= alpha) break;
     }
-    return maxEval;
 
   } else {
-    int minEval = INT32_MAX;
     for (Move nextMove : move_list) {
-      int eval = MinMax_impl(board, depth - 1, Team::WHITE, nextMove, alpha, beta, turn + 1);
-      minEval = std::min(minEval, eval);
+      int eval = searchChild<Policy>(ctx, board, nextMove, [&](typename Policy::BoardType& child) {
+        return MinMax_impl<Policy>(ctx, child, depth - 1, Team::WHITE, alpha, beta, ply + 1);
+      });
+      if (eval == illegal_move_score) continue;
+      if (!has_legal_move || eval < best_eval) {
+        best_eval = eval;
+        best_move = nextMove;
+        pv.update(nextMove, child_pv);
+      }
+      has_legal_move = true;
 
       beta = std::min(beta, eval);
       if (beta <= alpha) break;
     }
-    return minEval;
   }
+
+  // without any legal move it is either checkmate (the king will be captured) or stalemate (a draw)
+  if (!has_legal_move && !Check::isChecked(board, player, board.positions.getKingPos(player))) best_eval = 0;
+
+  // an aborted search did not look at all moves, so its score must not be reused
+  if (ctx.tt != nullptr && !(ctx.control != nullptr && ctx.control->isAborted())) {
+    Bound bound = Bound::EXACT;
+    if (has_legal_move && best_eval <= alpha_before) bound = Bound::UPPER;
+    if (has_legal_move && best_eval >= beta_before) bound = Bound::LOWER;
+    ctx.tt->store(hash, depth, best_eval, ply, bound, best_move);
+  }
+  return best_eval;
 }
 
-// (function documentation is provided in the corresponding header)
-SlimOptional<Move> MinMax(const Board& board, int depth, Team::Team player, int current_half_turn) {
-  SlimOptional<Move> best_move = SlimOptional<Move>::nullopt();
-  int alpha = INT32_MIN;
-  int beta = INT32_MAX;
+/**
+ * @brief searches the best moves from the root of the search tree
+ *
+ * @tparam Policy how the board of a child node is created and undone again (see MakeMovePolicy.h)
+ * @param board The current board state
+ * @param depth The depth to which the game tree should be explored
+ * @param player The team for which the best possible Move is searched for
+ * @param multi_pv the amount of best moves whose exact score and line should be found
+ * @param ctx the statistics and the control of the current search
+ * @return the best moves with their score and line, best first, with completed = false if the search was aborted \n
+ * (a single result without a move if there is no legal move)
+ *
+ * @note a move only has to beat the worst of the best multi_pv moves found so far, so every other move is searched
+ * with that score as the bound of its window and gets cut off as early as with a single best move
+ */
+template <class Policy>
+static std::vector<SearchResult> MinMaxRoot(const Board& board, int depth, Team::Team player, int multi_pv,
+                                            SearchContext& ctx) {
+  const CacheStatsScope cache_stats = CacheStatsScope(ctx);
+  ctx.stats.nodes++;
+  SearchResult result = SearchResult();
+  result.depth = depth;
 
   // check if a terminal state has already been reached
   if (!board.positions.hasPiece(Team::WHITE, PieceType::KING) ||
       !board.positions.hasPiece(Team::BLACK, PieceType::KING))
-    return SlimOptional<Move>::nullopt();
+    return {result};
 
   // get all moves
   std::vector<Move> move_list;
@@ -106,36 +405,108 @@ SlimOptional<Move> MinMax(const Board& board, int depth, Team::Team player, int
   // to make sure that both kings still exist in the next depth
   // and no unexpected errors are created
   for (Move move : move_list) {
-    if (board.grid[move.to].type == PieceType::KING) return SlimOptional(move);
+    if (board.grid[move.to].type == PieceType::KING) {
+      result.best_move = SlimOptional(move);
+      result.score = kingCaptureScore(player, 0);
+      result.pv.update(move, PrincipalVariation());
+      return {result};
+    }
   }
 
-  // go through all the moves
-  if (player == Team::WHITE) {
-    int maxEval = INT32_MIN;
-    for (Move nextMove : move_list) {
-      int eval = MinMax_impl(board, depth - 1, Team::BLACK, nextMove, alpha, beta, current_half_turn + 1);
-      if (eval > maxEval) {
-        maxEval = eval;
-        best_move = SlimOptional(nextMove);
-      }
+  // search the best move of the previous (less deep) search first, to get more cutoffs
+  uint64_t hash = 0;
+  if (ctx.tt != nullptr) {
+    hash = Zobrist::hashBoard(board, player);
+    if (const TTEntry* entry = ctx.tt->probe(hash)) searchMoveFirst(move_list, entry->best_move);
+  }
 
-      alpha = std::max(alpha, eval);
-      if (beta <= alpha) break;
+  typename Policy::BoardType root_board = typename Policy::BoardType(board);
+  if (ctx.nnue != nullptr) ctx.nnue->reset(*Nnue::loadedNetwork(), root_board);
+  const int illegal_move_score = kingCaptureScore(Team::getEnemyTeam(player), 1);
+  const PrincipalVariation& child_pv = ctx.pv_table[1];
+  const auto isBetter = [player](int score, int other_score) {
+    return player == Team::WHITE ? score > other_score : score < other_score;
+  };
+  // the best lines found so far, best first
+  std::vector<SearchResult> lines;
+  const uint64_t max_lines = static_cast<uint64_t>(std::max(1, multi_pv));
+
+  // go through all the moves (moves that put the own king in check are never chosen)
+  for (Move nextMove : move_list) {
+    const bool is_full = lines.size() >= max_lines;
+    const int alpha = (player == Team::WHITE && is_full) ? lines.back().score : INT32_MIN;
+    const int beta = (player == Team::BLACK && is_full) ? lines.back().score : INT32_MAX;
+    int eval = searchChild<Policy>(ctx, root_board, nextMove, [&](typename Policy::BoardType& child) {
+      return MinMax_impl<Policy>(ctx, child, depth - 1, Team::getEnemyTeam(player), alpha, beta, 1);
+    });
+    if (ctx.control != nullptr && ctx.control->isAborted()) {
+      result.completed = false;
+      break;
     }
+    if (eval == illegal_move_score) continue;
+    if (is_full && !isBetter(eval, lines.back().score)) continue;
 
-  } else {
-    int minEval = INT32_MAX;
-    for (Move nextMove : move_list) {
-      int eval = MinMax_impl(board, depth - 1, Team::WHITE, nextMove, alpha, beta, current_half_turn + 1);
-      if (eval < minEval) {
-        minEval = eval;
-        best_move = SlimOptional(nextMove);
-      }
+    SearchResult line = result;
+    line.score = eval;
+    line.best_move = SlimOptional(nextMove);
+    line.pv.update(nextMove, child_pv);
+    // behind all equally good lines, so that the earlier move stays first
+    const auto position = std::find_if(lines.begin(), lines.end(),
+                                       [&](const SearchResult& other) { return isBetter(eval, other.score); });
+    lines.insert(position, line);
+    if (lines.size() > max_lines) lines.pop_back();
+  }
 
-      beta = std::min(beta, eval);
-      if (beta <= alpha) break;
-    }
+  // without any legal move it is either checkmate or stalemate
+  if (lines.empty()) {
+    const bool is_checked = Check::isChecked(board, player, board.positions.getKingPos(player));
+    result.score = is_checked ? illegal_move_score : 0;
+    lines.push_back(result);
   }
+  for (SearchResult& line : lines) line.completed = result.completed;
 
-  return best_move;
+  if (ctx.tt != nullptr && result.completed) {
+    ctx.tt->store(hash, depth, lines[0].score, 0, Bound::EXACT, lines[0].best_move.data);
+  }
+  return lines;
+}
+
+// (function documentation is provided in the corresponding header)
+SlimOptional<Move> MinMax(const Board& board, int depth, Team::Team player, int current_half_turn) {
+  SearchStats stats = SearchStats();
+  return MinMax(board, depth, player, current_half_turn, stats);
 }
+
+// (function documentation is provided in the corresponding header)
+SlimOptional<Move> MinMax(const Board& board, int depth, Team::Team player, int current_half_turn, SearchStats& stats) {
+  return MinMaxWithPolicy<DefaultMakeMovePolicy>(board, depth, player, current_half_turn, stats);
+}
+
+// (function documentation is provided in the corresponding header)
+SearchResult MinMaxSearch(const Board& board, int depth, Team::Team player, SearchStats& stats,
+                          SearchControl* control, TranspositionTable* tt) {
+  SearchContext ctx = {stats, control, tt};
+  return MinMaxRoot<DefaultMakeMovePolicy>(board, depth, player, 1, ctx)[0];
+}
+
+// (function documentation is provided in the corresponding header)
+std::vector<SearchResult> MinMaxMultiPV(const Board& board, int depth, Team::Team player, int multi_pv,
+                                        SearchStats& stats, SearchControl* control, TranspositionTable* tt) {
+  SearchContext ctx = {stats, control, tt};
+  return MinMaxRoot<DefaultMakeMovePolicy>(board, depth, player, multi_pv, ctx);
+}
+
+// (function documentation is provided in the corresponding header)
+template <class Policy>
+SlimOptional<Move> MinMaxWithPolicy(const Board& board, int depth, Team::Team player, int, SearchStats& stats) {
+  SearchContext ctx = {stats, nullptr, nullptr};
+  return MinMaxRoot<Policy>(board, depth, player, 1, ctx)[0].best_move;
+}
+
+// all policies are instantiated, so that they can be compared with each other independent of the build time choice
+template SlimOptional<Move> MinMaxWithPolicy<MakeMovePolicy::CopyMake>(const Board&, int, Team::Team, int,
+                                                                       SearchStats&);
+template SlimOptional<Move> MinMaxWithPolicy<MakeMovePolicy::UndoMove>(const Board&, int, Team::Team, int,
+                                                                       SearchStats&);
+template SlimOptional<Move> MinMaxWithPolicy<MakeMovePolicy::UndoStack>(const Board&, int, Team::Team, int,
+                                                                        SearchStats&);
@@ -4,7 +4,12 @@
 
 #pragma once
 
+#include <vector>
+
 #include "../../Board/Board.h"
+#include "../../Board/MakeMovePolicy.h"
+#include "../TranspositionTable/TranspositionTable.h"
+#include "SearchTypes.h"
 
 /**
  * @brief wraps around and executes the MinMax algorithm to find the best move.
@@ -19,3 +24,84 @@
  * @note first checks if the board is actually legal meaning both kings exist in order to establish some invariance
  */
 SlimOptional<Move> MinMax(const Board& board, int depth, Team::Team player, int current_half_turn);
+
+/**
+ * @brief wraps around and executes the MinMax algorithm to find the best move, while collecting search statistics.
+ *
+ * @param board The current board state
+ * @param depth The depth to which the game tree should be explored \n
+ * (if \< 1 -\> function works as if depth = 1 e.g. one move ahead will still be tested)
+ * @param player The team for which the best possible Move is searched for
+ * @param current_half_turn roughly the amount of half turns that have past since the start
+ * @param stats the statistics of this search get added to it (e.g. the amount of searched nodes)
+ * @return The best move possible for the specified player, or nullopt if no move is possible
+ *
+ * @note the amount of searched nodes is deterministic for the same board, depth and player
+ */
+SlimOptional<Move> MinMax(const Board& board, int depth, Team::Team player, int current_half_turn, SearchStats& stats);
+
+/**
+ * @brief searches the best move to a fixed depth and returns it together with its score and line of best moves
+ *
+ * @param board The current board state
+ * @param depth The depth to which the game tree should be explored
+ * @param player The team for which the best possible Move is searched for
+ * @param stats the statistics of this search get added to it (e.g. the amount of searched nodes)
+ * @param control can stop the search before it is finished (or nullptr if the search should always finish)
+ * @param tt the table to reuse earlier results from and store the new ones in (or nullptr to not use one)
+ * @return the best move, or nullopt if no legal move is possible (with a score of 0 for stalemate), and
+ * completed = false if the search was stopped by control
+ *
+ * @note checkmates get scores near MATE_SCORE (see SearchTypes.h) \n
+ * with a table the line of best moves can end early, where the rest of it was taken from the table
+ */
+SearchResult MinMaxSearch(const Board& board, int depth, Team::Team player, SearchStats& stats,
+                          SearchControl* control, TranspositionTable* tt = nullptr);
+
+/**
+ * @brief searches the given amount of best moves to a fixed depth (MultiPV), each with its exact score and line
+ *
+ * @param board The current board state
+ * @param depth The depth to which the game tree should be explored
+ * @param player The team for which the best possible Moves are searched for
+ * @param multi_pv the amount of best moves to search for (at least 1, a larger amount than there are legal moves
+ * gives every legal move)
+ * @param stats the statistics of this search get added to it (e.g. the amount of searched nodes)
+ * @param control can stop the search before it is finished (or nullptr if the search should always finish)
+ * @param tt the table to reuse earlier results from and store the new ones in (or nullptr to not use one)
+ * @return the best moves, best first (between equal scores in the order of the move generation), or a single
+ * result without a move if no legal move is possible (see MinMaxSearch())
+ *
+ * @note the moves that do not get into the best moves are only searched until it is clear that they are worse, so
+ * searching a few moves costs little more than searching only the best one
+ */
+std::vector<SearchResult> MinMaxMultiPV(const Board& board, int depth, Team::Team player, int multi_pv,
+                                        SearchStats& stats, SearchControl* control, TranspositionTable* tt = nullptr);
+
+/**
+ * @brief the same as MinMax() with search statistics, but with an explicitly chosen make/unmake policy
+ *
+ * @tparam Policy how the board of a child node is created and undone again (see MakeMovePolicy.h) \n
+ * (instantiated for MakeMovePolicy::CopyMake, MakeMovePolicy::UndoMove, and MakeMovePolicy::UndoStack)
+ * @param board The current board state
+ * @param depth The depth to which the game tree should be explored
+ * @param player The team for which the best possible Move is searched for
+ * @param current_half_turn roughly the amount of half turns that have past since the start
+ * @param stats the statistics of this search get added to it (e.g. the amount of searched nodes)
+ * @return The best move possible for the specified player, or nullopt if no move is possible
+ *
+ * @note the undo based policies can generate the moves in a different order than CopyMake (see MakeMovePolicy.h),
+ * so the searched amount of nodes and, between equally good moves, the returned move can differ slightly
+ */
+template <class Policy>
+SlimOptional<Move> MinMaxWithPolicy(const Board& board, int depth, Team::Team player, int current_half_turn,
+                                    SearchStats& stats);
+
+/**
+ * @brief sets the size of the evaluation caches of the searches (see EvalCache), each searching thread gets its own
+ * cache of this size
+ *
+ * @param size_kb the size of each cache in kilobytes, 0 to not cache evaluations
+ * @note takes effect with the next search of each thread, which then starts with an empty cache
+ */
+void setEvalCacheSize(uint64_t size_kb);
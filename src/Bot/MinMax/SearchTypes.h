@@ -0,0 +1,355 @@
+//
+// Created by timap on 18.10.2026.
+//
+
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <limits>
+#include <mutex>
+
+#include "../../Types/Move/Move.h"
+
+/**
+ * @brief the score of a board, in which the team to move can directly capture the enemy king
+ *
+ * @note a mate found n half moves (ply) after the root gets the score MATE_SCORE - n, so that faster mates are
+ * preferred and the distance to mate can be calculated from the score (see mateInMoves())
+ */
+constexpr int MATE_SCORE = INT32_MAX - 1;
+
+/**
+ * @brief the maximum amount of half moves a search can look ahead
+ */
+constexpr int MAX_SEARCH_PLY = 64;
+
+/**
+ * @brief the maximum amount of half moves after the root of a mate score
+ *
+ * @note larger than MAX_SEARCH_PLY, as the tablebases know mates that are further away than the search can look
+ * (see Tablebase.h)
+ */
+constexpr int MAX_MATE_PLY = 256;
+
+/**
+ * @param score a score of the search (for white)
+ * @return true if the score means that one of the teams can force a mate
+ */
+constexpr bool isMateScore(int score) {
+  return score >= MATE_SCORE - MAX_MATE_PLY || score <= -(MATE_SCORE - MAX_MATE_PLY);
+}
+
+/**
+ * @brief calculates in how many moves of the given team a mate score ends the game
+ * @param score a mate score (see isMateScore()) for white
+ * @param team the team the amount of moves should be calculated for
+ * @return the amount of own moves until mating the enemy, or the negative amount of own moves until being mated
+ */
+constexpr int mateInMoves(int score, Team::Team team) {
+  const int team_score = team == Team::WHITE ? score : -score;
+  // the king gets captured 2n half moves after the root for mate in n, or 2n+1 half moves for being mated in n
+  if (team_score > 0) return (MATE_SCORE - team_score) / 2;
+  return -((MATE_SCORE + team_score) / 2);
+}
+
+/**
+ * @brief Statistics collected while searching for the best move.
+ */
+struct SearchStats {
+  /**
+   * @brief the amount of nodes (i.e. board states) visited by the search
+   */
+  uint64_t nodes = 0;
+  /**
+   * @brief the amount of evaluations that looked up their pawn structure in the pawn hash table
+   */
+  uint64_t pawn_hash_probes = 0;
+  /**
+   * @brief the amount of evaluations that found their pawn structure in the pawn hash table
+   */
+  uint64_t pawn_hash_hits = 0;
+
+  /**
+   * @return the share of pawn hash lookups that found their pawn structure in percent (0 without any lookups)
+   */
+  [[nodiscard]] inline double pawnHashHitRate() const {
+    return pawn_hash_probes == 0 ? 0.0 : static_cast<double>(pawn_hash_hits) * 100 / pawn_hash_probes;
+  }
+
+  /**
+   * @brief the amount of leaves that looked up their evaluation in the evaluation cache
+   */
+  uint64_t eval_cache_probes = 0;
+  /**
+   * @brief the amount of leaves that found their evaluation in the evaluation cache
+   */
+  uint64_t eval_cache_hits = 0;
+
+  /**
+   * @return the share of evaluation cache lookups that found their evaluation in percent (0 without any lookups)
+   */
+  [[nodiscard]] inline double evalCacheHitRate() const {
+    return eval_cache_probes == 0 ? 0.0 : static_cast<double>(eval_cache_hits) * 100 / eval_cache_probes;
+  }
+
+  /**
+   * @brief the amount of leaves evaluated with the window of the search (i.e. not found in the evaluation cache)
+   */
+  uint64_t windowed_evals = 0;
+  /**
+   * @brief the amount of windowed evaluations that skipped the expensive terms, as the score was clearly outside of
+   * the window
+   */
+  uint64_t lazy_evals = 0;
+
+  /**
+   * @return the share of windowed evaluations that skipped the expensive terms in percent (0 without any evaluations)
+   */
+  [[nodiscard]] inline double lazyEvalRate() const {
+    return windowed_evals == 0 ? 0.0 : static_cast<double>(lazy_evals) * 100 / windowed_evals;
+  }
+};
+
+/**
+ * @brief the best line of moves found by the search, starting with the best move
+ */
+struct PrincipalVariation {
+  /**
+   * @brief the moves of the line in the order they are played
+   */
+  Move moves[MAX_SEARCH_PLY];
+  /**
+   * @brief the amount of moves in the line
+   */
+  int length = 0;
+
+  /**
+   * @brief replaces this line with the given move followed by the given line
+   * @param move the first move of the new line
+   * @param rest the line after move
+   */
+  constexpr void update(Move move, const PrincipalVariation& rest) {
+    moves[0] = move;
+    length = rest.length + 1 < MAX_SEARCH_PLY ? rest.length + 1 : MAX_SEARCH_PLY;
+    for (int i = 1; i < length; ++i) moves[i] = rest.moves[i - 1];
+  }
+};
+
+/**
+ * @brief the limits of a search as given by the user (e.g. through the UCI "go" command)
+ *
+ * @note a value of 0 (or less) means that there is no such limit
+ */
+struct SearchLimits {
+  /**
+   * @brief the maximum search depth
+   */
+  int depth = 0;
+  /**
+   * @brief the maximum amount of nodes
+   */
+  uint64_t nodes = 0;
+  /**
+   * @brief the exact time to search for in milliseconds
+   */
+  int64_t movetime = 0;
+  /**
+   * @brief the time left on the clock of white/black in milliseconds
+   */
+  int64_t wtime = 0, btime = 0;
+  /**
+   * @brief the increment per move of white/black in milliseconds
+   */
+  int64_t winc = 0, binc = 0;
+  /**
+   * @brief the amount of moves until the next time control
+   */
+  int movestogo = 0;
+  /**
+   * @brief search until stopped, ignoring all other limits
+   */
+  bool infinite = false;
+  /**
+   * @brief search until stopped like infinite, but switch to the other limits once ponderHit() is called on the
+   * SearchControl (UCI "go ponder" followed by "ponderhit")
+   */
+  bool ponder = false;
+  /**
+   * @brief the amount of best moves to search with their exact score and line (MultiPV), at least 1
+   */
+  int multi_pv = 1;
+};
+
+/**
+ * @brief lets other threads stop a running search and tells the search when to stop by itself
+ *
+ * @note the search only checks the time every few nodes, so a stop can take a few microseconds to take effect
+ */
+class SearchControl {
+ private:
+  /**
+   * @brief the value of deadline without a deadline
+   */
+  static constexpr std::chrono::steady_clock::rep no_deadline =
+      std::numeric_limits<std::chrono::steady_clock::rep>::max();
+  /**
+   * @brief set by requestStop(), read by the search
+   */
+  std::atomic<bool> stop_requested{false};
+  /**
+   * @brief set by the search when it stopped before finishing the current depth
+   */
+  bool aborted = false;
+  /**
+   * @brief set while the search ponders, cleared by ponderHit()
+   */
+  std::atomic<bool> pondering{false};
+  /**
+   * @brief the maximum amount of nodes, 0 if there is no limit (atomic, as it gets set during a pondering search)
+   */
+  std::atomic<uint64_t> node_limit{0};
+  /**
+   * @brief the ticks of the steady clock at which the search has to stop, no_deadline if it has none (atomic, as
+   * it gets set during a pondering search)
+   */
+  std::atomic<std::chrono::steady_clock::rep> deadline{no_deadline};
+  /**
+   * @brief used to wake up waitForStop() and waitWhilePondering()
+   */
+  std::mutex mutex;
+  /**
+   * @brief notified by requestStop() and ponderHit()
+   */
+  std::condition_variable stop_condition;
+
+ public:
+  /**
+   * @brief the amount of nodes between two looks at the clock
+   */
+  static constexpr uint64_t time_check_interval = 1024;
+
+  /**
+   * @brief stops the search as soon as possible (can be called from any thread)
+   */
+  void requestStop() {
+    {
+      std::lock_guard<std::mutex> lock(mutex);
+      stop_requested.store(true, std::memory_order_relaxed);
+    }
+    stop_condition.notify_all();
+  }
+
+  /**
+   * @return true if requestStop() was called
+   */
+  [[nodiscard]] bool isStopRequested() const { return stop_requested.load(std::memory_order_relaxed); }
+
+  /**
+   * @brief blocks until requestStop() is called
+   */
+  void waitForStop() {
+    std::unique_lock<std::mutex> lock(mutex);
+    stop_condition.wait(lock, [this] { return stop_requested.load(std::memory_order_relaxed); });
+  }
+
+  /**
+   * @brief lets the search ignore its limits until ponderHit() is called
+   */
+  void startPondering() { pondering.store(true, std::memory_order_relaxed); }
+
+  /**
+   * @brief ends the pondering, the limits set beforehand (setNodeLimit(), setDeadline()) apply from now on \n
+   * (can be called from any thread)
+   */
+  void ponderHit() {
+    {
+      std::lock_guard<std::mutex> lock(mutex);
+      pondering.store(false, std::memory_order_relaxed);
+    }
+    stop_condition.notify_all();
+  }
+
+  /**
+   * @return true if the search ponders (startPondering() was called, but not yet ponderHit())
+   */
+  [[nodiscard]] bool isPondering() const { return pondering.load(std::memory_order_relaxed); }
+
+  /**
+   * @brief blocks until requestStop() or ponderHit() is called (returns immediately if the search does not ponder)
+   */
+  void waitWhilePondering() {
+    std::unique_lock<std::mutex> lock(mutex);
+    stop_condition.wait(lock, [this] {
+      return stop_requested.load(std::memory_order_relaxed) || !pondering.load(std::memory_order_relaxed);
+    });
+  }
+
+  /**
+   * @param nodes the maximum amount of nodes to search (0 for no limit)
+   */
+  void setNodeLimit(uint64_t nodes) { node_limit.store(nodes, std::memory_order_relaxed); }
+
+  /**
+   * @param time_point the time at which the search has to stop
+   */
+  void setDeadline(std::chrono::steady_clock::time_point time_point) {
+    deadline.store(time_point.time_since_epoch().count(), std::memory_order_relaxed);
+  }
+
+  /**
+   * @return true if a deadline was set and it has passed
+   */
+  [[nodiscard]] bool isPastDeadline() const {
+    const std::chrono::steady_clock::rep ticks = deadline.load(std::memory_order_relaxed);
+    return ticks != no_deadline && std::chrono::steady_clock::now().time_since_epoch().count() >= ticks;
+  }
+
+  /**
+   * @brief called by the search for every node, to check whether it has to stop
+   * @param nodes the amount of nodes the search has visited so far
+   * @return true if the search has to stop (remembered, see isAborted())
+   */
+  inline bool shouldAbort(uint64_t nodes) {
+    if (aborted) return true;
+    const uint64_t max_nodes = node_limit.load(std::memory_order_relaxed);
+    if (isStopRequested() || (max_nodes > 0 && nodes >= max_nodes) ||
+        (nodes % time_check_interval == 0 && isPastDeadline())) {
+      aborted = true;
+    }
+    return aborted;
+  }
+
+  /**
+   * @return true if the search stopped before it was finished (its result is not reliable)
+   */
+  [[nodiscard]] bool isAborted() const { return aborted; }
+};
+
+/**
+ * @brief the result of searching a board to a fixed depth
+ */
+struct SearchResult {
+  /**
+   * @brief the best move found, or nullopt if the team can not make a legal move
+   */
+  SlimOptional<Move> best_move = SlimOptional<Move>::nullopt();
+  /**
+   * @brief the score of the best move (for white)
+   */
+  int score = 0;
+  /**
+   * @brief the depth that was searched
+   */
+  int depth = 0;
+  /**
+   * @brief the best line of moves starting with best_move
+   */
+  PrincipalVariation pv = PrincipalVariation();
+  /**
+   * @brief false if the search was aborted before it finished searching all moves
+   */
+  bool completed = true;
+};
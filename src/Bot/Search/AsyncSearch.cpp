@@ -0,0 +1,46 @@
+//
+// Created by timap on 18.10.2026.
+//
+#include "AsyncSearch.h"
+
+#include <utility>
+
+// (function documentation is provided in the corresponding header)
+void AsyncSearch::start(const Board& board, Team::Team player, const SearchLimits& limits,
+                        Search::InfoCallback on_info, DoneCallback on_done, TranspositionTable* tt) {
+  stop();
+
+  control = std::make_shared<SearchControl>();
+  this->limits = limits;
+  this->player = player;
+  Search::applyLimits(*control, limits, player);
+
+  worker = std::thread([board, player, limits, tt, control = control, on_info = std::move(on_info),
+                        on_done = std::move(on_done)]() {
+    const SearchResult result = Search::iterativeDeepening(board, player, limits, *control, on_info, tt);
+    // an infinite search may only report its result after it was stopped, a pondering one after the ponder hit
+    if (limits.infinite) control->waitForStop();
+    control->waitWhilePondering();
+    if (on_done) on_done(result);
+  });
+}
+
+// (function documentation is provided in the corresponding header)
+void AsyncSearch::ponderHit() {
+  if (!control || !control->isPondering()) return;
+  SearchLimits timed_limits = limits;
+  timed_limits.ponder = false;
+  Search::applyLimits(*control, timed_limits, player);
+  control->ponderHit();
+}
+
+// (function documentation is provided in the corresponding header)
+void AsyncSearch::stop() {
+  if (control) control->requestStop();
+  wait();
+}
+
+// (function documentation is provided in the corresponding header)
+void AsyncSearch::wait() {
+  if (worker.joinable()) worker.join();
+}
@@ -0,0 +1,87 @@
+//
+// Created by timap on 18.10.2026.
+//
+
+#pragma once
+
+#include <functional>
+#include <memory>
+#include <thread>
+
+#include "Search.h"
+
+/**
+ * @brief runs a search on its own thread, so that the caller can keep reading input and stop it at any time
+ *
+ * @note only one search runs at a time, starting a new one stops the previous one first
+ */
+class AsyncSearch {
+ public:
+  /**
+   * @brief gets called on the search thread with the final result of the search
+   */
+  using DoneCallback = std::function<void(const SearchResult&)>;
+
+ private:
+  /**
+   * @brief the thread of the current (or last) search
+   */
+  std::thread worker;
+  /**
+   * @brief the control of the current search (shared with the worker, so it stays alive as long as the worker needs it)
+   */
+  std::shared_ptr<SearchControl> control;
+  /**
+   * @brief the limits of the current search (used by ponderHit())
+   */
+  SearchLimits limits;
+  /**
+   * @brief the team the current search searches the best move for (used by ponderHit())
+   */
+  Team::Team player = Team::WHITE;
+
+ public:
+  AsyncSearch() = default;
+  AsyncSearch(const AsyncSearch&) = delete;
+  AsyncSearch& operator=(const AsyncSearch&) = delete;
+
+  /**
+   * @brief stops the current search and waits for it to finish
+   */
+  ~AsyncSearch() { stop(); }
+
+  /**
+   * @brief starts a new search in the background (stops the previous search first)
+   *
+   * @param board the board to search the best move on
+   * @param player the team to search the best move for
+   * @param limits the limits of the search
+   * @param on_info called on the search thread after each finished depth
+   * @param on_done called on the search thread with the final result \n
+   * (with limits.infinite only after stop() was called, and with limits.ponder only after ponderHit() or stop() was
+   * called, like the UCI protocol requires)
+   * @param tt the table the search uses, or nullptr to not use one \n
+   * (it must outlive the search and must not be used by anything else until the search was stopped or waited for)
+   */
+  void start(const Board& board, Team::Team player, const SearchLimits& limits, Search::InfoCallback on_info,
+             DoneCallback on_done, TranspositionTable* tt = nullptr);
+
+  /**
+   * @brief ends the pondering of the current search: from now on it searches with the time and node limits it was
+   * started with, as if it was started now
+   * @note does nothing if the current search does not ponder
+   */
+  void ponderHit();
+
+  /**
+   * @brief stops the current search and waits until its final result was reported
+   * @note does nothing if no search is running
+   */
+  void stop();
+
+  /**
+   * @brief waits until the current search finished by itself (e.g. because its depth was reached)
+   * @note must not be used for infinite searches, as they only end with stop()
+   */
+  void wait();
+};
@@ -0,0 +1,81 @@
+//
+// Created by timap on 18.10.2026.
+//
+#include "Search.h"
+
+#include <algorithm>
+#include <chrono>
+
+#include "../MinMax/MinMax.h"
+
+/**
+ * @brief the time in milliseconds kept on the clock for the communication with the GUI
+ */
+constexpr int64_t move_overhead_ms = 30;
+
+/**
+ * @brief the amount of moves the remaining time is divided by, if the GUI does not send movestogo
+ */
+constexpr int default_moves_to_go = 30;
+
+namespace Search {
+
+// (function documentation is provided in the corresponding header)
+void applyLimits(SearchControl& control, const SearchLimits& limits, Team::Team player) {
+  control.setNodeLimit(limits.infinite || limits.ponder ? 0 : limits.nodes);
+  if (limits.infinite) return;
+  if (limits.ponder) {
+    // the other limits get applied with ponder = false once the pondering ends
+    control.startPondering();
+    return;
+  }
+
+  const auto start = std::chrono::steady_clock::now();
+  if (limits.movetime > 0) {
+    control.setDeadline(start + std::chrono::milliseconds(std::max<int64_t>(1, limits.movetime - move_overhead_ms)));
+    return;
+  }
+
+  const int64_t time_left = player == Team::WHITE ? limits.wtime : limits.btime;
+  const int64_t increment = player == Team::WHITE ? limits.winc : limits.binc;
+  if (time_left <= 0) return;
+
+  const int moves_to_go = limits.movestogo > 0 ? limits.movestogo : default_moves_to_go;
+  int64_t time_for_move = time_left / moves_to_go + increment * 3 / 4;
+  // never plan to use more time than is left on the clock
+  time_for_move = std::min(time_for_move, time_left - move_overhead_ms);
+  control.setDeadline(start + std::chrono::milliseconds(std::max<int64_t>(1, time_for_move)));
+}
+
+// (function documentation is provided in the corresponding header)
+SearchResult iterativeDeepening(const Board& board, Team::Team player, const SearchLimits& limits,
+                                SearchControl& control, const InfoCallback& on_info, TranspositionTable* tt) {
+  const auto start = std::chrono::steady_clock::now();
+  const int max_depth = (limits.depth > 0 && !limits.infinite) ? std::min(limits.depth, MAX_SEARCH_PLY - 1)
+                                                                : MAX_SEARCH_PLY - 1;
+  SearchStats stats = SearchStats();
+  SearchResult best = SearchResult();
+
+  for (int depth = 1; depth <= max_depth; ++depth) {
+    // the first depth can not be stopped, so that there always is a move to play
+    const std::vector<SearchResult> lines =
+        MinMaxMultiPV(board, depth, player, limits.multi_pv, stats, depth == 1 ? nullptr : &control, tt);
+    if (!lines[0].completed) break;
+    best = lines[0];
+
+    if (on_info) {
+      const auto elapsed = std::chrono::steady_clock::now() - start;
+      on_info({best, lines, stats.nodes, std::chrono::duration_cast<std::chrono::milliseconds>(elapsed).count(), stats});
+    }
+
+    // nothing left to search (no legal moves, or a forced mate that the search already sees completely)
+    if (!best.best_move.has_value()) break;
+    // a pondering search has no limits until the ponder hit
+    const bool unlimited = limits.infinite || control.isPondering();
+    if (isMateScore(best.score) && !unlimited) break;
+    if (control.isStopRequested() || control.isPastDeadline()) break;
+    if (limits.nodes > 0 && stats.nodes >= limits.nodes && !unlimited) break;
+  }
+  return best;
+}
+}  // namespace Search
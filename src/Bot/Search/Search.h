@@ -0,0 +1,74 @@
+//
+// Created by timap on 18.10.2026.
+//
+
+#pragma once
+
+#include <cstdint>
+#include <functional>
+#include <vector>
+
+#include "../../Board/Board.h"
+#include "../MinMax/SearchTypes.h"
+#include "../TranspositionTable/TranspositionTable.h"
+
+namespace Search {
+/**
+ * @brief what the search reports after each finished depth
+ */
+struct SearchInfo {
+  /**
+   * @brief the finished depth with its best move, score (for white) and line of best moves
+   */
+  const SearchResult& result;
+  /**
+   * @brief the best moves of the finished depth, best first (only more than one with SearchLimits::multi_pv)
+   */
+  const std::vector<SearchResult>& lines;
+  /**
+   * @brief the amount of nodes searched over all depths so far
+   */
+  uint64_t nodes;
+  /**
+   * @brief the time since the start of the search in milliseconds
+   */
+  int64_t time_ms;
+  /**
+   * @brief all statistics of the search over all depths so far (e.g. the pawn hash hit rate)
+   */
+  const SearchStats& stats;
+};
+
+/**
+ * @brief gets called after each finished depth of the iterative deepening
+ */
+using InfoCallback = std::function<void(const SearchInfo&)>;
+
+/**
+ * @brief calculates how long the search may take for the given limits and sets the limits on the control
+ *
+ * @param control the control of the search that is about to start
+ * @param limits the limits given by the user
+ * @param player the team to search the best move for (i.e. whose clock is used)
+ *
+ * @note with wtime/btime the search uses a fraction of the remaining time plus most of the increment. With
+ * limits.ponder only the pondering gets started, the other limits are applied by calling this again with ponder set to
+ * false before SearchControl::ponderHit()
+ */
+void applyLimits(SearchControl& control, const SearchLimits& limits, Team::Team player);
+
+/**
+ * @brief searches the best move with increasing depth until the limits are reached or the search gets stopped
+ *
+ * @param board the board to search the best move on
+ * @param player the team to search the best move for
+ * @param limits the limits of the search (see applyLimits(), which has to be called on control beforehand)
+ * @param control can stop the search from another thread
+ * @param on_info called after each finished depth (can be empty)
+ * @param tt the table shared by all depths (and kept for later searches), or nullptr to not use one
+ * @return the result of the deepest finished depth \n
+ * (depth 1 always finishes, so there is always a move if the player has any legal move)
+ */
+SearchResult iterativeDeepening(const Board& board, Team::Team player, const SearchLimits& limits,
+                                SearchControl& control, const InfoCallback& on_info, TranspositionTable* tt = nullptr);
+}  // namespace Search
@@ -0,0 +1,926 @@
+//
+// Created by timap on 18.10.2026.
+//
+#include "Tablebase.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <memory>
+#include <thread>
+#include <utility>
+
+#include "../../IO/Parser/MappedFile.h"
+#include "../Batch/ParallelRunner.h"
+
+/*
+ * the byte of each board in a table:
+ * 0 = draw, 1 ..= 125 = won in that many half moves, 128 ..= 253 = lost in (byte - 128) half moves,
+ * 254 = not classified yet (only during the generation), 255 = not a legal board
+ */
+
+/**
+ * @brief the byte of a drawn board
+ */
+constexpr uint8_t draw_value = 0;
+/**
+ * @brief added to the distance of a lost board
+ */
+constexpr uint8_t loss_flag = 128;
+/**
+ * @brief the byte of a board that was not classified yet
+ */
+constexpr uint8_t unknown_value = 254;
+/**
+ * @brief the byte of a board that can not be reached in a game (e.g. the king of the player not to move is in check)
+ */
+constexpr uint8_t invalid_value = 255;
+/**
+ * @brief the longest distance to mate in half moves a byte can hold
+ */
+constexpr int max_distance = 125;
+
+/**
+ * @return true if the byte is a won board
+ */
+static constexpr bool isWinValue(uint8_t value) { return value != draw_value && value < loss_flag; }
+
+/**
+ * @return true if the byte is a lost board
+ */
+static constexpr bool isLossValue(uint8_t value) { return value >= loss_flag && value < unknown_value; }
+
+/**
+ * @brief the magic at the start of each table file
+ */
+constexpr std::string_view file_magic = "CTB1";
+/**
+ * @brief the size of the header of a table file in bytes: the magic, the amount of pieces, the pieces (team << 4 |
+ * type), the longest distance to mate, 2 unused bytes and the amount of boards (4 bytes)
+ */
+constexpr uint64_t header_size = 16;
+
+/**
+ * @brief the piece types besides the king, from the strongest to the weakest
+ */
+constexpr PieceType::PieceType types_by_strength[] = {PieceType::QUEEN, PieceType::CASTLE, PieceType::BISHOP,
+                                                      PieceType::KNIGHT, PieceType::PAWN};
+/**
+ * @brief the letter of each piece type in types_by_strength in the name of a table
+ */
+constexpr std::string_view strength_letters = "QRBNP";
+/**
+ * @brief the amount of piece types besides the king
+ */
+constexpr int amount_strengths = 5;
+
+/**
+ * @return the position of the type in types_by_strength (0 for the queen), -1 for the king
+ */
+static constexpr int strength(PieceType::PieceType type) {
+  for (int i = 0; i < amount_strengths; ++i) {
+    if (types_by_strength[i] == type) return i;
+  }
+  return -1;
+}
+
+/**
+ * @brief the pieces of a table or board: the white king, the black king and then the other pieces
+ *
+ * @note in a table the other pieces are the white ones and then the black ones, each from the strongest to the
+ * weakest, while the pieces of a board can be in any order
+ */
+struct Material {
+  int amount = 0;
+  Piece pieces[Tablebase::max_pieces];
+
+  /**
+   * @param flip true to get the key of the material with the teams swapped
+   * @return a number that is the same for all material with the same pieces (no matter their order), below
+   * amount_keys
+   */
+  [[nodiscard]] int key(bool flip) const {
+    int result = 0;
+    for (int i = 2; i < amount; ++i) {
+      const bool white = (pieces[i].team == Team::WHITE) != flip;
+      int digit = 1;
+      for (int j = 0; j < (white ? 0 : amount_strengths) + strength(pieces[i].type); ++j) digit *= 3;
+      result += digit;
+    }
+    return result;
+  }
+
+  /**
+   * @return true if one of the pieces is a pawn
+   */
+  [[nodiscard]] bool hasPawns() const {
+    for (int i = 2; i < amount; ++i) {
+      if (pieces[i].type == PieceType::PAWN) return true;
+    }
+    return false;
+  }
+
+  /**
+   * @return the name of the table of the material, e.g. "KQvKR"
+   */
+  [[nodiscard]] std::string name() const {
+    std::string result = "K";
+    for (Team::Team team : {Team::WHITE, Team::BLACK}) {
+      if (team == Team::BLACK) result += "vK";
+      for (int i = 2; i < amount; ++i) {
+        if (pieces[i].team == team) result += strength_letters[strength(pieces[i].type)];
+      }
+    }
+    return result;
+  }
+};
+
+/**
+ * @brief the amount of different material keys (see Material::key()): each team can have up to 2 pieces of each type
+ * besides the king, which are counted as a digit in base 3
+ */
+constexpr int amount_keys = 59049;
+
+/**
+ * @brief a board with at most max_pieces pieces
+ */
+struct TbPosition {
+  Material material;
+  /**
+   * @brief the square of each piece of material (square 0 = a8)
+   */
+  int8_t squares[Tablebase::max_pieces];
+  /**
+   * @brief the player who can currently make a move
+   */
+  Team::Team player;
+};
+
+/**
+ * @brief a generated or loaded table
+ */
+struct Table {
+  Material material;
+  /**
+   * @brief the amount of boards of the table
+   */
+  uint64_t size = 0;
+  /**
+   * @brief the longest distance to mate of all boards in half moves
+   */
+  int longest = 0;
+  /**
+   * @brief the byte of each board (see the top of this file)
+   */
+  const uint8_t* entries = nullptr;
+  /**
+   * @brief the file of the entries, or nullptr if the table is still being generated
+   */
+  std::unique_ptr<MappedFile> file;
+};
+
+/**
+ * @brief the currently loaded (or generated) tables
+ */
+struct Registry {
+  std::vector<std::unique_ptr<Table>> tables;
+  /**
+   * @brief the index of the table of each material key in tables, -1 if the table is not loaded
+   */
+  std::vector<int16_t> by_key = std::vector<int16_t>(amount_keys, -1);
+  /**
+   * @brief the largest amount of pieces of a loaded table
+   */
+  int pieces = 0;
+
+  /**
+   * @brief adds a table, so that it is found by lookup()
+   * @return the added table
+   */
+  Table& add(std::unique_ptr<Table> table) {
+    by_key[table->material.key(false)] = static_cast<int16_t>(tables.size());
+    pieces = std::max(pieces, table->material.amount);
+    tables.push_back(std::move(table));
+    return *tables.back();
+  }
+};
+
+/**
+ * @brief the tables loaded by load() or generate()
+ */
+static Registry& registry() {
+  static Registry tables = Registry();
+  return tables;
+}
+
+/**
+ * @param material the pieces of a table
+ * @return the amount of different squares of the piece at slot in the index of a table (see tableIndex())
+ */
+static uint64_t slotSize(const Material& material, int slot) {
+  if (slot == 0) return material.hasPawns() ? 32 : 16;
+  return material.pieces[slot].type == PieceType::PAWN ? 48 : BOARD_SIZE;
+}
+
+/**
+ * @return the amount of boards of the table of the material
+ */
+static uint64_t tableSize(const Material& material) {
+  uint64_t size = 2;
+  for (int slot = 0; slot < material.amount; ++slot) size *= slotSize(material, slot);
+  return size;
+}
+
+/**
+ * @param table the table the board belongs to
+ * @param squares the square of each piece of the table, in the order of its material
+ * @param player the player who can currently make a move
+ * @return the index of the board in the table
+ *
+ * @note the white king gets mirrored onto the files a to d (and without pawns also onto the rows 8 to 5), followed by
+ * the squares of the other pieces (pawns only on the rows 7 to 2) and the player
+ */
+static uint64_t tableIndex(const Table& table, const int8_t* squares, Team::Team player) {
+  const bool has_pawns = table.material.hasPawns();
+  int8_t mirror = (squares[0] & 0b111) > 3 ? 7 : 0;
+  if (!has_pawns && (squares[0] >> 3) > 3) mirror |= 56;
+  const int king = squares[0] ^ mirror;
+  uint64_t idx = (king >> 3) * 4 + (king & 0b111);
+  for (int slot = 1; slot < table.material.amount; ++slot) {
+    const bool pawn = table.material.pieces[slot].type == PieceType::PAWN;
+    idx = idx * (pawn ? 48 : BOARD_SIZE) + ((squares[slot] ^ mirror) - (pawn ? 8 : 0));
+  }
+  return idx * 2 + (player == Team::WHITE ? 0 : 1);
+}
+
+/**
+ * @param table a table
+ * @param idx the index of a board in the table (see tableIndex())
+ * @return the board of the index
+ */
+static TbPosition decode(const Table& table, uint64_t idx) {
+  TbPosition position = TbPosition();
+  position.material = table.material;
+  position.player = (idx & 1) == 0 ? Team::WHITE : Team::BLACK;
+  idx >>= 1;
+  for (int slot = table.material.amount - 1; slot > 0; --slot) {
+    const bool pawn = table.material.pieces[slot].type == PieceType::PAWN;
+    const uint64_t size = pawn ? 48 : BOARD_SIZE;
+    position.squares[slot] = static_cast<int8_t>(idx % size + (pawn ? 8 : 0));
+    idx /= size;
+  }
+  position.squares[0] = static_cast<int8_t>((idx / 4) * 8 + idx % 4);
+  return position;
+}
+
+/**
+ * @param position a board with its pieces in any order, but the kings first
+ * @return the byte of the board in its table, invalid_value if the table is not loaded
+ *
+ * @note the board gets the teams swapped (and the rows flipped) if its table has the stronger team as black
+ */
+static uint8_t lookup(const TbPosition& position) {
+  if (position.material.amount == 2) return draw_value;
+  const Registry& tables = registry();
+  bool flip = false;
+  int table_idx = tables.by_key[position.material.key(false)];
+  if (table_idx < 0) {
+    flip = true;
+    table_idx = tables.by_key[position.material.key(true)];
+    if (table_idx < 0) return invalid_value;
+  }
+  const Table& table = *tables.tables[table_idx];
+
+  // the squares in the order of the pieces of the table
+  int8_t squares[Tablebase::max_pieces];
+  bool used[Tablebase::max_pieces] = {};
+  for (int slot = 0; slot < table.material.amount; ++slot) {
+    Piece wanted = table.material.pieces[slot];
+    if (flip) wanted.team = Team::getEnemyTeam(wanted.team);
+    for (int i = 0; i < position.material.amount; ++i) {
+      if (used[i] || position.material.pieces[i] != wanted) continue;
+      used[i] = true;
+      squares[slot] = static_cast<int8_t>(flip ? position.squares[i] ^ 56 : position.squares[i]);
+      break;
+    }
+  }
+  const Team::Team player = flip ? Team::getEnemyTeam(position.player) : position.player;
+  return table.entries[tableIndex(table, squares, player)];
+}
+
+/**
+ * @param piece a piece
+ * @param from the square of the piece
+ * @param target another square
+ * @param occupancy the occupied squares (bit i for square i)
+ * @return true if the piece attacks the target
+ */
+static bool attacks(Piece piece, int from, int target, uint64_t occupancy) {
+  const int row_diff = (target >> 3) - (from >> 3);
+  const int file_diff = (target & 0b111) - (from & 0b111);
+  const int abs_row = std::abs(row_diff);
+  const int abs_file = std::abs(file_diff);
+  switch (piece.type) {
+    case PieceType::KING:
+      return std::max(abs_row, abs_file) == 1;
+    case PieceType::KNIGHT:
+      return abs_row * abs_file == 2;
+    case PieceType::PAWN:
+      return abs_file == 1 && row_diff == (piece.team == Team::WHITE ? -1 : 1);
+    default:
+      break;
+  }
+  const bool straight = (abs_row == 0) != (abs_file == 0);
+  const bool diagonal = abs_row == abs_file && abs_row != 0;
+  if ((piece.type == PieceType::CASTLE && !straight) || (piece.type == PieceType::BISHOP && !diagonal) ||
+      (!straight && !diagonal))
+    return false;
+  const int square_step = ((row_diff > 0) - (row_diff < 0)) * 8 + ((file_diff > 0) - (file_diff < 0));
+  for (int pos = from + square_step; pos != target; pos += square_step) {
+    if ((occupancy >> pos) & 1) return false;
+  }
+  return true;
+}
+
+/**
+ * @return the occupied squares of the board (bit i for square i)
+ */
+static uint64_t occupancy(const TbPosition& position) {
+  uint64_t result = 0;
+  for (int i = 0; i < position.material.amount; ++i) result |= uint64_t(1) << position.squares[i];
+  return result;
+}
+
+/**
+ * @return true if the king of the team can be captured by the other team
+ */
+static bool isChecked(const TbPosition& position, Team::Team team) {
+  const uint64_t occupied = occupancy(position);
+  const int king = position.squares[team == Team::WHITE ? 0 : 1];
+  for (int i = 0; i < position.material.amount; ++i) {
+    if (position.material.pieces[i].team != team &&
+        attacks(position.material.pieces[i], position.squares[i], king, occupied))
+      return true;
+  }
+  return false;
+}
+
+/**
+ * @brief the row and file steps of the kings and queens (the first 4 are also the steps of the castles, the last 4
+ * of the bishops)
+ */
+constexpr int8_t line_steps[8][2] = {{-1, 0}, {1, 0}, {0, -1}, {0, 1}, {-1, -1}, {-1, 1}, {1, -1}, {1, 1}};
+/**
+ * @brief the row and file steps of the knights
+ */
+constexpr int8_t knight_steps[8][2] = {{-2, -1}, {-2, 1}, {-1, -2}, {-1, 2}, {1, -2}, {1, 2}, {2, -1}, {2, 1}};
+
+/**
+ * @brief calls visit with the board after each legal move of the player to move
+ *
+ * @param position a legal board
+ * @param visit bool(const TbPosition&), returns false to not visit the other moves
+ * @return the amount of visited moves
+ *
+ * @note a capture removes the captured piece from the material, a promotion changes the type of the pawn, so the
+ * board after such a move belongs to another table
+ */
+template <typename Visit>
+static int forEachMove(const TbPosition& position, Visit visit) {
+  const uint64_t occupied = occupancy(position);
+  const Team::Team player = position.player;
+  int amount = 0;
+  bool stopped = false;
+
+  // moves the piece at slot to the square, returns false if visit wants to stop
+  const auto tryMove = [&](int slot, int to, PieceType::PieceType promote_to) {
+    TbPosition next = position;
+    next.squares[slot] = static_cast<int8_t>(to);
+    if (promote_to != PieceType::NONE) next.material.pieces[slot].type = promote_to;
+    for (int i = 2; i < next.material.amount; ++i) {
+      if (i == slot || position.squares[i] != to) continue;
+      // remove the captured piece (never a king, as the king of the enemy is never in check)
+      for (int j = i; j + 1 < next.material.amount; ++j) {
+        next.material.pieces[j] = next.material.pieces[j + 1];
+        next.squares[j] = next.squares[j + 1];
+      }
+      next.material.amount--;
+      break;
+    }
+    if (isChecked(next, player)) return;
+    next.player = Team::getEnemyTeam(player);
+    amount++;
+    stopped = !visit(next);
+  };
+  // whether a piece of the player stands on the square
+  const auto isOwn = [&](int pos) {
+    for (int i = 0; i < position.material.amount; ++i) {
+      if (position.squares[i] == pos) return position.material.pieces[i].team == player;
+    }
+    return false;
+  };
+
+  for (int slot = 0; slot < position.material.amount && !stopped; ++slot) {
+    const Piece piece = position.material.pieces[slot];
+    if (piece.team != player) continue;
+    const int from = position.squares[slot];
+    const int row = from >> 3;
+    const int file = from & 0b111;
+
+    if (piece.type == PieceType::PAWN) {
+      const int forward = player == Team::WHITE ? -8 : 8;
+      const bool promotes = (row + forward / 8) == (player == Team::WHITE ? 0 : 7);
+      const auto tryPawnMove = [&](int to) {
+        if (!promotes) return tryMove(slot, to, PieceType::NONE);
+        for (PieceType::PieceType type : {PieceType::QUEEN, PieceType::CASTLE, PieceType::BISHOP, PieceType::KNIGHT}) {
+          if (!stopped) tryMove(slot, to, type);
+        }
+      };
+      if (((occupied >> (from + forward)) & 1) == 0) {
+        tryPawnMove(from + forward);
+        const int start_row = player == Team::WHITE ? 6 : 1;
+        if (!stopped && row == start_row && ((occupied >> (from + 2 * forward)) & 1) == 0) {
+          tryMove(slot, from + 2 * forward, PieceType::NONE);
+        }
+      }
+      for (int file_step : {-1, 1}) {
+        const int to = from + forward + file_step;
+        if (stopped || file + file_step < 0 || file + file_step > 7) continue;
+        if (((occupied >> to) & 1) != 0 && !isOwn(to)) tryPawnMove(to);
+      }
+      continue;
+    }
+
+    const bool slides = piece.type != PieceType::KING && piece.type != PieceType::KNIGHT;
+    const int8_t(*steps)[2] = piece.type == PieceType::KNIGHT ? knight_steps : line_steps;
+    const int first_step = piece.type == PieceType::BISHOP ? 4 : 0;
+    const int end_step = piece.type == PieceType::CASTLE ? 4 : 8;
+    for (int step = first_step; step < end_step && !stopped; ++step) {
+      for (int distance = 1; distance < 8 && !stopped; ++distance) {
+        const int to_row = row + steps[step][0] * distance;
+        const int to_file = file + steps[step][1] * distance;
+        if (to_row < 0 || to_row > 7 || to_file < 0 || to_file > 7) break;
+        const int to = to_row * 8 + to_file;
+        const bool is_occupied = ((occupied >> to) & 1) != 0;
+        if (is_occupied && isOwn(to)) break;
+        tryMove(slot, to, PieceType::NONE);
+        if (is_occupied || !slides) break;
+      }
+    }
+  }
+  return amount;
+}
+
+/**
+ * @param position a board of a table
+ * @return false if two pieces stand on the same square, or the king of the player not to move is in check
+ */
+static bool isLegal(const TbPosition& position) {
+  for (int i = 0; i < position.material.amount; ++i) {
+    for (int j = i + 1; j < position.material.amount; ++j) {
+      if (position.squares[i] == position.squares[j]) return false;
+    }
+  }
+  return !isChecked(position, Team::getEnemyTeam(position.player));
+}
+
+/**
+ * @return true if both have the same pieces in the same order
+ */
+static bool sameMaterial(const Material& material, const Material& other) {
+  if (material.amount != other.amount) return false;
+  for (int i = 0; i < material.amount; ++i) {
+    if (material.pieces[i] != other.pieces[i]) return false;
+  }
+  return true;
+}
+
+/**
+ * @brief calls visit with the index of each board of the same table, from which a move that neither captures nor
+ * promotes reaches the given board (i.e. the boards after taking back such a move)
+ *
+ * @param table the table of the board
+ * @param position a legal board of the table
+ * @param visit void(uint64_t idx), also gets the indices of boards that are not legal
+ */
+template <typename Visit>
+static void forEachPredecessor(const Table& table, const TbPosition& position, Visit visit) {
+  const uint64_t occupied = occupancy(position);
+  const Team::Team mover = Team::getEnemyTeam(position.player);
+  int8_t squares[Tablebase::max_pieces];
+  std::memcpy(squares, position.squares, sizeof(squares));
+
+  for (int slot = 0; slot < position.material.amount; ++slot) {
+    const Piece piece = position.material.pieces[slot];
+    if (piece.team != mover) continue;
+    const int to = position.squares[slot];
+    const int row = to >> 3;
+    const int file = to & 0b111;
+    const auto visitFrom = [&](int from) {
+      squares[slot] = static_cast<int8_t>(from);
+      visit(tableIndex(table, squares, mover));
+      squares[slot] = static_cast<int8_t>(to);
+    };
+
+    if (piece.type == PieceType::PAWN) {
+      const int backward = mover == Team::WHITE ? 8 : -8;
+      const int from = to + backward;
+      const int from_row = from >> 3;
+      if (from_row < 1 || from_row > 6 || ((occupied >> from) & 1) != 0) continue;
+      visitFrom(from);
+      const int start_row = mover == Team::WHITE ? 6 : 1;
+      if (from_row + backward / 8 == start_row && ((occupied >> (from + backward)) & 1) == 0) {
+        visitFrom(from + backward);
+      }
+      continue;
+    }
+
+    // the moves of the other pieces can be taken back with the same moves
+    const bool slides = piece.type != PieceType::KING && piece.type != PieceType::KNIGHT;
+    const int8_t(*steps)[2] = piece.type == PieceType::KNIGHT ? knight_steps : line_steps;
+    const int first_step = piece.type == PieceType::BISHOP ? 4 : 0;
+    const int end_step = piece.type == PieceType::CASTLE ? 4 : 8;
+    for (int step = first_step; step < end_step; ++step) {
+      for (int distance = 1; distance < 8; ++distance) {
+        const int from_row = row + steps[step][0] * distance;
+        const int from_file = file + steps[step][1] * distance;
+        if (from_row < 0 || from_row > 7 || from_file < 0 || from_file > 7) break;
+        const int from = from_row * 8 + from_file;
+        if (((occupied >> from) & 1) != 0) break;
+        visitFrom(from);
+        if (!slides) break;
+      }
+    }
+  }
+}
+
+/**
+ * @brief set in the index of a board that is lost (instead of won) in the lists of the generation
+ */
+constexpr uint32_t lost_bit = uint32_t(1) << 31;
+/**
+ * @brief the longest mate after the captures and promotions of a board that can not be lost (as one of them does not
+ * reach a won board)
+ */
+constexpr uint8_t cannot_lose = 255;
+/**
+ * @brief the amount of boards whose taken back moves are collected before they are applied
+ */
+constexpr uint64_t frontier_block = uint64_t(1) << 16;
+
+/**
+ * @brief classifies every board of a table (see generate())
+ *
+ * @param table the table, already added to the registry with entries pointing to values
+ * @param values the bytes of the boards of the table
+ * @param threads the amount of threads
+ * @return the longest distance to mate of the table
+ */
+static int generateTable(const Table& table, std::vector<uint8_t>& values, unsigned threads) {
+  // the amount of moves of each board that stay in the table and do not reach a board known to be won yet
+  std::vector<uint8_t> open_moves(table.size, 0);
+  // the longest mate after the captures and promotions of each board (or cannot_lose)
+  std::vector<uint8_t> other_longest(table.size, 0);
+  // the boards that are won (or lost, with lost_bit) by a capture or promotion, by their distance to mate
+  std::vector<std::vector<uint32_t>> scheduled(max_distance + 1);
+  // the checkmates and the boards found by each thread that are won or lost through captures and promotions
+  std::vector<std::vector<uint32_t>> thread_mates(threads);
+  std::vector<std::vector<std::pair<int, uint32_t>>> thread_scheduled(threads);
+
+  Batch::parallelRanges(threads, table.size, [&](unsigned thread, uint64_t begin, uint64_t end) {
+    for (uint64_t idx = begin; idx < end; ++idx) {
+      const TbPosition position = decode(table, idx);
+      if (!isLegal(position)) {
+        values[idx] = invalid_value;
+        continue;
+      }
+      int moves = 0;
+      int shortest_loss = max_distance;
+      int longest_win = 0;
+      bool can_lose = true;
+      const int amount_moves = forEachMove(position, [&](const TbPosition& next) {
+        if (sameMaterial(next.material, position.material)) {
+          moves++;
+          return true;
+        }
+        const uint8_t value = lookup(next);
+        if (isLossValue(value)) shortest_loss = std::min(shortest_loss, value - loss_flag);
+        if (isWinValue(value)) longest_win = std::max<int>(longest_win, value);
+        can_lose &= isWinValue(value);
+        return true;
+      });
+
+      if (amount_moves == 0) {
+        const bool mate = isChecked(position, position.player);
+        values[idx] = mate ? loss_flag : draw_value;
+        if (mate) thread_mates[thread].push_back(static_cast<uint32_t>(idx));
+        continue;
+      }
+      values[idx] = unknown_value;
+      open_moves[idx] = static_cast<uint8_t>(moves);
+      other_longest[idx] = can_lose ? static_cast<uint8_t>(longest_win) : cannot_lose;
+      if (shortest_loss < max_distance) thread_scheduled[thread].emplace_back(shortest_loss + 1, idx);
+      if (can_lose && moves == 0 && longest_win < max_distance) {
+        thread_scheduled[thread].emplace_back(longest_win + 1, idx | lost_bit);
+      }
+    }
+  });
+
+  // the boards classified in the previous pass
+  std::vector<uint32_t> frontier;
+  for (unsigned thread = 0; thread < threads; ++thread) {
+    frontier.insert(frontier.end(), thread_mates[thread].begin(), thread_mates[thread].end());
+    for (const auto& [distance, entry] : thread_scheduled[thread]) scheduled[distance].push_back(entry);
+  }
+  int last_scheduled = 0;
+  for (int distance = 0; distance <= max_distance; ++distance) {
+    if (!scheduled[distance].empty()) last_scheduled = distance;
+  }
+
+  // in pass n the boards before the boards of pass n - 1 get classified (and the scheduled boards of pass n)
+  int longest = 0;
+  std::vector<uint32_t> next_frontier;
+  std::vector<std::vector<uint32_t>> predecessors(threads);
+  for (int pass = 1; pass <= max_distance && (!frontier.empty() || pass <= last_scheduled); ++pass) {
+    next_frontier.clear();
+    const auto classify = [&](uint32_t idx, bool lost) {
+      if (values[idx] != unknown_value) return;
+      values[idx] = static_cast<uint8_t>(lost ? loss_flag + pass : pass);
+      next_frontier.push_back(idx);
+    };
+    for (uint32_t entry : scheduled[pass]) classify(entry & ~lost_bit, (entry & lost_bit) != 0);
+
+    for (uint64_t block = 0; block < frontier.size(); block += frontier_block) {
+      const uint64_t block_size = std::min(frontier_block, frontier.size() - block);
+      // the boards are only read here and only written below, so the threads do not need to synchronize
+      Batch::parallelRanges(threads, block_size, [&](unsigned thread, uint64_t begin, uint64_t end) {
+        predecessors[thread].clear();
+        for (uint64_t i = block + begin; i < block + end; ++i) {
+          const uint32_t child_lost = isLossValue(values[frontier[i]]) ? lost_bit : 0;
+          forEachPredecessor(table, decode(table, frontier[i]), [&](uint64_t idx) {
+            predecessors[thread].push_back(static_cast<uint32_t>(idx) | child_lost);
+          });
+        }
+      });
+      for (const std::vector<uint32_t>& part : predecessors) {
+        for (uint32_t entry : part) {
+          const uint32_t idx = entry & ~lost_bit;
+          if (values[idx] != unknown_value) continue;
+          // a move reaches a board lost for the enemy
+          if ((entry & lost_bit) != 0) {
+            classify(idx, false);
+            continue;
+          }
+          if (open_moves[idx] == 0 || --open_moves[idx] > 0 || other_longest[idx] == cannot_lose) continue;
+          // every move reaches a board won by the enemy, the longest mate of them decides
+          const int distance = std::max<int>(pass - 1, other_longest[idx]) + 1;
+          if (distance == pass) {
+            classify(idx, true);
+          } else if (distance <= max_distance) {
+            scheduled[distance].push_back(idx | lost_bit);
+            last_scheduled = std::max(last_scheduled, distance);
+          }
+        }
+      }
+    }
+    if (!next_frontier.empty()) longest = pass;
+    frontier.swap(next_frontier);
+  }
+
+  // the boards that are still unknown can never be won or lost
+  for (uint8_t& value : values) {
+    if (value == unknown_value) value = draw_value;
+  }
+  return longest;
+}
+
+/**
+ * @param pieces the largest amount of pieces
+ * @return the material of every table with up to that amount of pieces, ordered by the amount of pieces and pawns
+ */
+static std::vector<Material> allMaterials(int pieces) {
+  std::vector<Material> materials;
+  // the strengths of the pieces of a team, up to 2 pieces from the strongest to the weakest
+  std::vector<std::vector<int>> teams = {{}};
+  for (int first = 0; first < amount_strengths; ++first) {
+    teams.push_back({first});
+    for (int second = first; second < amount_strengths; ++second) teams.push_back({first, second});
+  }
+  for (const std::vector<int>& white : teams) {
+    for (const std::vector<int>& black : teams) {
+      const uint64_t amount = 2 + white.size() + black.size();
+      // the stronger team is white
+      if (white.empty() || amount > static_cast<uint64_t>(std::min(pieces, Tablebase::max_pieces)) ||
+          white.size() < black.size() || (white.size() == black.size() && white > black))
+        continue;
+      Material material = Material();
+      material.pieces[material.amount++] = Piece(Team::WHITE, PieceType::KING);
+      material.pieces[material.amount++] = Piece(Team::BLACK, PieceType::KING);
+      for (int type : white) material.pieces[material.amount++] = Piece(Team::WHITE, types_by_strength[type]);
+      for (int type : black) material.pieces[material.amount++] = Piece(Team::BLACK, types_by_strength[type]);
+      materials.push_back(material);
+    }
+  }
+  // the captures lead to less pieces and the promotions to less pawns
+  const auto order = [](const Material& material) {
+    int pawns = 0;
+    for (int i = 2; i < material.amount; ++i) pawns += material.pieces[i].type == PieceType::PAWN;
+    return std::make_pair(material.amount, pawns);
+  };
+  std::stable_sort(materials.begin(), materials.end(),
+                   [&order](const Material& lhs, const Material& rhs) { return order(lhs) < order(rhs); });
+  return materials;
+}
+
+/**
+ * @return the header of the file of the table
+ */
+static std::string fileHeader(const Material& material, int longest) {
+  std::string header(header_size, '\0');
+  std::memcpy(header.data(), file_magic.data(), file_magic.size());
+  header[4] = static_cast<char>(material.amount);
+  for (int i = 0; i < material.amount; ++i) {
+    header[5 + i] = static_cast<char>((material.pieces[i].team << 4) | material.pieces[i].type);
+  }
+  header[5 + Tablebase::max_pieces] = static_cast<char>(longest);
+  const uint32_t size = static_cast<uint32_t>(tableSize(material));
+  std::memcpy(header.data() + 12, &size, sizeof(size));
+  return header;
+}
+
+/**
+ * @brief maps the file of a table
+ *
+ * @param path the path of the file
+ * @param material the material the table should have
+ * @return the table, or nullptr if the file does not exist or does not contain the table of the material
+ */
+static std::unique_ptr<Table> mapTable(const std::string& path, const Material& material) {
+  // a probe reads a single byte somewhere in the table
+  auto file = std::make_unique<MappedFile>(path, Access::RANDOM);
+  if (!file->isOpen()) return nullptr;
+  const std::string_view data = file->data();
+  const uint64_t size = tableSize(material);
+  if (data.size() != header_size + size) return nullptr;
+  const int longest = static_cast<uint8_t>(data[5 + Tablebase::max_pieces]);
+  // everything but the longest distance to mate is known from the material
+  std::string expected = fileHeader(material, longest);
+  if (data.substr(0, header_size) != expected) return nullptr;
+
+  auto table = std::make_unique<Table>();
+  table->material = material;
+  table->size = size;
+  table->longest = longest;
+  table->entries = reinterpret_cast<const uint8_t*>(data.data() + header_size);
+  table->file = std::move(file);
+  return table;
+}
+
+/**
+ * @return the path of the file of the table in the directory
+ */
+static std::string tablePath(const std::string& directory, const Material& material) {
+  return directory + "/" + material.name() + std::string(Tablebase::file_extension);
+}
+
+namespace Tablebase {
+
+// (function documentation is provided in the corresponding header)
+std::vector<std::string> signatures(int pieces) {
+  std::vector<std::string> names;
+  for (const Material& material : allMaterials(pieces)) names.push_back(material.name());
+  return names;
+}
+
+// (function documentation is provided in the corresponding header)
+bool generate(const std::string& directory, const GenerateOptions& options, std::ostream& log) {
+  const unsigned threads = options.threads > 0 ? options.threads : std::max(1u, std::thread::hardware_concurrency());
+  registry() = Registry();
+  for (const Material& material : allMaterials(options.pieces)) {
+    const std::string path = tablePath(directory, material);
+    if (std::unique_ptr<Table> existing = mapTable(path, material)) {
+      log << material.name() << ": reused " << path << std::endl;
+      registry().add(std::move(existing));
+      continue;
+    }
+
+    const auto start = std::chrono::steady_clock::now();
+    auto generated = std::make_unique<Table>();
+    generated->material = material;
+    generated->size = tableSize(material);
+    std::vector<uint8_t> values(generated->size, unknown_value);
+    generated->entries = values.data();
+    Table& table = registry().add(std::move(generated));
+    table.longest = generateTable(table, values, threads);
+
+    std::ofstream out(path, std::ios::binary);
+    out << fileHeader(material, table.longest);
+    out.write(reinterpret_cast<const char*>(values.data()), static_cast<std::streamsize>(values.size()));
+    out.close();
+    std::unique_ptr<Table> written = out ? mapTable(path, material) : nullptr;
+    if (written == nullptr) {
+      log << "could not write " << path << std::endl;
+      registry() = Registry();
+      return false;
+    }
+    // the entries now come from the file, so that the generated bytes can be freed
+    table.entries = written->entries;
+    table.file = std::move(written->file);
+
+    const auto time_ms =
+        std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - start).count();
+    log << material.name() << ": " << table.size << " boards, longest mate in " << table.longest << " half moves, "
+        << time_ms << " ms" << std::endl;
+  }
+  return true;
+}
+
+// (function documentation is provided in the corresponding header)
+int load(const std::string& directory) {
+  registry() = Registry();
+  if (directory.empty()) return 0;
+  int amount = 0;
+  for (const Material& material : allMaterials(max_pieces)) {
+    if (std::unique_ptr<Table> table = mapTable(tablePath(directory, material), material)) {
+      registry().add(std::move(table));
+      amount++;
+    }
+  }
+  return amount;
+}
+
+// (function documentation is provided in the corresponding header)
+int loadedPieces() noexcept { return registry().pieces; }
+
+// (function documentation is provided in the corresponding header)
+bool probe(const Board& board, Team::Team player, ProbeResult& result) {
+  const int pieces = registry().pieces;
+  if (pieces == 0 || board.extra.getPassantPos().has_value() ||
+      board.extra.getCastlingRights(ChessConstants::start_white_king_pos) != 0 ||
+      board.extra.getCastlingRights(ChessConstants::start_black_king_pos) != 0)
+    return false;
+
+  TbPosition position = TbPosition();
+  position.player = player;
+  for (Team::Team team : {Team::WHITE, Team::BLACK}) {
+    position.material.pieces[position.material.amount] = Piece(team, PieceType::KING);
+    position.squares[position.material.amount++] = board.positions.getKingPos(team);
+  }
+  for (Team::Team team : {Team::WHITE, Team::BLACK}) {
+    for (int type = PieceType::QUEEN; type <= PieceType::PAWN; ++type) {
+      const Board_Positions::PositionsSlice positions =
+          board.positions.getVec(team, static_cast<PieceType::PieceType>(type));
+      for (int i = 0; i < positions.size; ++i) {
+        if (position.material.amount == pieces) return false;
+        position.material.pieces[position.material.amount] = Piece(team, static_cast<PieceType::PieceType>(type));
+        position.squares[position.material.amount++] = positions[i];
+      }
+    }
+  }
+
+  const uint8_t value = lookup(position);
+  if (value == invalid_value || value == unknown_value) return false;
+  if (isWinValue(value)) {
+    result = {Wdl::WIN, value};
+  } else if (isLossValue(value)) {
+    result = {Wdl::LOSS, value - loss_flag};
+  } else {
+    result = {Wdl::DRAW, 0};
+  }
+  return true;
+}
+
+// (function documentation is provided in the corresponding header)
+bool parseGenerateArguments(int argc, const char* const* argv, GenerateOptions& options, std::string& directory) {
+  directory.clear();
+  for (int i = 0; i < argc; ++i) {
+    const std::string_view arg = argv[i];
+    const bool has_value = i + 1 < argc;
+    try {
+      if (arg == "--pieces" && has_value) {
+        options.pieces = std::stoi(argv[++i]);
+        if (options.pieces < 3 || options.pieces > max_pieces) return false;
+      } else if (arg == "--threads" && has_value) {
+        options.threads = static_cast<unsigned>(std::max(0, std::stoi(argv[++i])));
+      } else if (directory.empty() && arg.rfind("--", 0) != 0) {
+        directory = std::string(arg);
+      } else {
+        return false;
+      }
+    } catch (const std::exception&) {
+      return false;
+    }
+  }
+  return !directory.empty();
+}
+
+// (function documentation is provided in the corresponding header)
+void printGenerateUsage(std::ostream& os) {
+  os << "usage: ./Chess tablebase [options] DIRECTORY\n"
+        "  generates the endgame tablebases and writes them into DIRECTORY (which has to exist)\n"
+        "  --pieces N      the largest amount of pieces with the kings, 3 or 4 (default: 4)\n"
+        "  --threads N     the amount of threads (default: one per core)\n";
+}
+}  // namespace Tablebase
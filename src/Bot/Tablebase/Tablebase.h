@@ -0,0 +1,150 @@
+//
+// Created by timap on 18.10.2026.
+//
+
+#pragma once
+
+#include <cstdint>
+#include <ostream>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "../../Board/Board.h"
+
+/**
+ * @brief endgame tablebases: the perfect result and distance to mate of every board with at most 4 pieces (kings
+ * included), generated by retrograde analysis and memory mapped from files to be looked up during the search
+ *
+ * @note every material signature (e.g. "KQvKR") gets its own table of one byte per board, stored from the view of
+ * the stronger team as white. The white king is mirrored onto the files a to d (and without pawns also onto the rows
+ * 8 to 5), every other piece can stand on any square (pawns on the 48 squares between the first and last row), and
+ * both teams can be the one to move, e.g. KQvKR has 16 * 64 * 64 * 64 * 2 boards = 8 MB. \n
+ * The tables do not know castling, en passant or the 50 move rule: boards with castling rights or an en passant
+ * square are never looked up, and a double step of a pawn is generated without giving the enemy an en passant
+ * capture
+ */
+namespace Tablebase {
+/**
+ * @brief the largest amount of pieces (kings included) a table can have
+ */
+constexpr int max_pieces = 4;
+
+/**
+ * @brief the ending of the file name of a table (e.g. KQvKR.ctb)
+ */
+constexpr std::string_view file_extension = ".ctb";
+
+/**
+ * @brief the namespace holding the Wdl enum in order to not pollute the main namespace
+ */
+namespace Wdl {
+/**
+ * @brief the result of a board with perfect play, from the view of the player to move
+ */
+enum Wdl : int8_t { LOSS = -1, DRAW = 0, WIN = 1 };
+}  // namespace Wdl
+
+/**
+ * @brief the result of looking up a board in the tables
+ */
+struct ProbeResult {
+  /**
+   * @brief whether the player to move wins, loses or draws with perfect play
+   */
+  Wdl::Wdl wdl = Wdl::DRAW;
+  /**
+   * @brief the amount of half moves until the losing player is checkmated with perfect play (0 for a draw, and if the
+   * player to move is already checkmated)
+   */
+  int distance = 0;
+};
+
+/**
+ * @brief how the tables get generated
+ */
+struct GenerateOptions {
+  /**
+   * @brief the tables with up to this amount of pieces (kings included) are generated, at most max_pieces
+   */
+  int pieces = max_pieces;
+  /**
+   * @brief the amount of threads, 0 for one per core
+   */
+  unsigned threads = 0;
+};
+
+/**
+ * @param pieces the largest amount of pieces (kings included), at most max_pieces
+ * @return the names of all tables with 3 up to pieces pieces (e.g. "KQvK"), in the order they have to be generated
+ * in (a table can only be generated after the tables its captures and promotions lead to)
+ */
+std::vector<std::string> signatures(int pieces);
+
+/**
+ * @brief generates the tables and writes them into a directory, each table into its own file
+ *
+ * @param directory the existing directory to write the files to
+ * @param options which tables to generate and with how many threads
+ * @param log gets a line for each table (its size, longest mate and generation time)
+ * @return false if a file could not be written
+ *
+ * @note the tables that already exist in the directory are reused instead of generated again, so a stopped
+ * generation can be continued. \n
+ * Afterwards the generated tables are loaded, as with load(). \n
+ * The first pass finds the checkmates and stalemates, looks up the captures and promotions in the smaller tables,
+ * and counts the remaining moves of each board. Every later pass takes back the moves leading to the boards
+ * classified in the pass before: a board before a lost board is won, and a board before a won board loses one of
+ * its remaining moves, and is lost once none are left. The moves are generated from the squares of the pieces, each
+ * pass is split over the threads, and its results are only applied after all of them finished
+ */
+bool generate(const std::string& directory, const GenerateOptions& options, std::ostream& log);
+
+/**
+ * @brief memory maps all tables found in a directory, replacing the previously loaded tables
+ *
+ * @param directory the directory with the files written by generate() (an empty path only unloads the tables)
+ * @return the amount of loaded tables
+ *
+ * @note must not be called while a search is running. Tables with an invalid header are skipped
+ */
+int load(const std::string& directory);
+
+/**
+ * @return the largest amount of pieces (kings included) of a loaded table, 0 if no table is loaded
+ *
+ * @note cheap, so that the search can skip the lookup of boards with more pieces
+ */
+int loadedPieces() noexcept;
+
+/**
+ * @brief looks up the perfect result of a board
+ *
+ * @param board the current board state
+ * @param player the player who can currently make a move
+ * @param result set to the result of the board, if it was found
+ * @return false if the table of the board is not loaded, or the board can not be looked up (it has castling rights,
+ * an en passant square, or is not legal)
+ *
+ * @note cheap enough to be done at every node of the search: a few comparisons and a single byte from the mapped
+ * file. A board with only the two kings is always a draw
+ */
+bool probe(const Board& board, Team::Team player, ProbeResult& result);
+
+/**
+ * @brief parses the command line arguments of the tablebase mode
+ *
+ * @param argc the amount of arguments
+ * @param argv the arguments, starting with the first argument after "tablebase"
+ * @param options the options to set
+ * @param directory set to the directory to write the tables to
+ * @return false if the arguments are invalid
+ */
+bool parseGenerateArguments(int argc, const char* const* argv, GenerateOptions& options, std::string& directory);
+
+/**
+ * @brief prints how to use the tablebase mode
+ * @param os the stream to print to
+ */
+void printGenerateUsage(std::ostream& os);
+}  // namespace Tablebase
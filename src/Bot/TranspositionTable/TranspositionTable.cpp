@@ -0,0 +1,33 @@
+//
+// Created by timap on 18.10.2026.
+//
+#include "TranspositionTable.h"
+
+#include <algorithm>
+
+// (function documentation is provided in the corresponding header)
+TranspositionTable::TranspositionTable(uint64_t size_mb) {
+  const uint64_t max_entries = std::max<uint64_t>(1, size_mb * 1024 * 1024 / sizeof(TTEntry));
+  uint64_t amount = 1;
+  while (amount * 2 <= max_entries) amount *= 2;
+  entries = std::vector<TTEntry>(amount);
+  index_mask = amount - 1;
+}
+
+// (function documentation is provided in the corresponding header)
+void TranspositionTable::clear() { std::fill(entries.begin(), entries.end(), TTEntry()); }
+
+// (function documentation is provided in the corresponding header)
+void TranspositionTable::store(uint64_t hash, int depth, int score, int ply, Bound bound, Move best_move) {
+  TTEntry& entry = entries[hash & index_mask];
+  // a deeper result of another board is more valuable, as it took more time to find
+  if (entry.hash != hash && entry.depth > depth) return;
+  // keep the old best move if the new search did not find one (e.g. because every move failed low)
+  if (best_move.to < 0 && entry.hash == hash) best_move = entry.best_move;
+
+  entry.hash = hash;
+  entry.best_move = best_move;
+  entry.score = scoreToTT(score, ply);
+  entry.depth = static_cast<int8_t>(depth);
+  entry.bound = bound;
+}
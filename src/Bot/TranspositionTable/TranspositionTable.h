@@ -0,0 +1,148 @@
+//
+// Created by timap on 18.10.2026.
+//
+
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+#include "../../Types/Move/Move.h"
+#include "../MinMax/SearchTypes.h"
+
+/**
+ * @brief what the score of a TranspositionTable entry means, as the search only knows exact scores if the search of
+ * a board did not get cut off by alpha-beta pruning
+ */
+enum class Bound : uint8_t {
+  /**
+   * @brief the score is the exact score of the board
+   */
+  EXACT,
+  /**
+   * @brief the real score is at least the score (i.e. white found a move that was good enough for a cutoff)
+   */
+  LOWER,
+  /**
+   * @brief the real score is at most the score (i.e. black found a move that was good enough for a cutoff)
+   */
+  UPPER
+};
+
+/**
+ * @brief the result of an already searched board, found through its Zobrist hash (see Zobrist.h)
+ */
+struct TTEntry {
+  /**
+   * @brief the full hash of the board, to tell boards apart that share the same slot in the table
+   */
+  uint64_t hash = 0;
+  /**
+   * @brief the best move found for the board (can be an empty move if there was none)
+   */
+  Move best_move = Move();
+  /**
+   * @brief the score (for white) of the board, with mate scores counted from the board instead of the root
+   */
+  int score = 0;
+  /**
+   * @brief the depth the board was searched with, -1 if the entry is empty
+   */
+  int8_t depth = -1;
+  /**
+   * @brief whether the score is exact or only a bound
+   */
+  Bound bound = Bound::EXACT;
+};
+
+/**
+ * @brief a fixed size hash table remembering the results of already searched boards, so that boards that are reached
+ * again (through different move orders, or in a later search) do not have to be searched again
+ *
+ * @note not thread safe, only one search may use a table at a time. \n
+ * The table is kept between searches on purpose, e.g. pondering keeps its results even if the player did not make
+ * the expected move
+ */
+class TranspositionTable {
+ private:
+  /**
+   * @brief the entries, with an amount that is a power of 2
+   */
+  std::vector<TTEntry> entries;
+  /**
+   * @brief the amount of entries - 1, used to get the slot of a hash
+   */
+  uint64_t index_mask;
+
+ public:
+  /**
+   * @brief the default size of a table in megabytes
+   */
+  static constexpr uint64_t default_size_mb = 16;
+
+  /**
+   * @brief the largest size of a table in megabytes that the options (e.g. --hash of the batch mode) allow
+   */
+  static constexpr uint64_t max_size_mb = 4096;
+
+  /**
+   * @brief constructs an empty table
+   * @param size_mb the maximum size of the table in megabytes (rounded down to a power of 2 amount of entries)
+   */
+  explicit TranspositionTable(uint64_t size_mb = default_size_mb);
+
+  /**
+   * @brief forgets all entries (e.g. for a new game)
+   */
+  void clear();
+
+  /**
+   * @param hash the Zobrist hash of the board
+   * @return the entry of the board, or nullptr if the board is not in the table
+   */
+  [[nodiscard]] inline const TTEntry* probe(uint64_t hash) const {
+    const TTEntry& entry = entries[hash & index_mask];
+    return (entry.depth >= 0 && entry.hash == hash) ? &entry : nullptr;
+  }
+
+  /**
+   * @brief stores the result of a search, replacing the slot's old entry unless it is a deeper search of another board
+   *
+   * @param hash the Zobrist hash of the board
+   * @param depth the depth the board was searched with
+   * @param score the score of the board (for white) as returned by the search
+   * @param ply the amount of half moves between the root of the search and the board
+   * @param bound whether the score is exact or only a bound
+   * @param best_move the best move found (can be an empty move)
+   */
+  void store(uint64_t hash, int depth, int score, int ply, Bound bound, Move best_move);
+
+  /**
+   * @return the amount of entries the table can hold
+   */
+  [[nodiscard]] inline uint64_t capacity() const { return entries.size(); }
+};
+
+/**
+ * @brief converts a mate score counted from the root of the search to a score counted from the stored board
+ * @param score the score as returned by the search
+ * @param ply the amount of half moves between the root of the search and the board
+ * @return the score to store in the table
+ */
+constexpr int scoreToTT(int score, int ply) {
+  if (score >= MATE_SCORE - MAX_MATE_PLY) return score + ply;
+  if (score <= -(MATE_SCORE - MAX_MATE_PLY)) return score - ply;
+  return score;
+}
+
+/**
+ * @brief converts a stored mate score counted from its board back to a score counted from the root of the search
+ * @param score the score stored in the table
+ * @param ply the amount of half moves between the root of the current search and the board
+ * @return the score as the search would return it
+ */
+constexpr int scoreFromTT(int score, int ply) {
+  if (score >= MATE_SCORE - MAX_MATE_PLY) return score - ply;
+  if (score <= -(MATE_SCORE - MAX_MATE_PLY)) return score + ply;
+  return score;
+}
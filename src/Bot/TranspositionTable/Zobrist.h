@@ -0,0 +1,113 @@
+//
+// Created by timap on 18.10.2026.
+//
+
+#pragma once
+
+#include <cstdint>
+
+#include "../../Board/Board.h"
+
+/**
+ * @brief Zobrist hashing, i.e. a (nearly) unique 64 bit number for every board state, made by xor-ing a random
+ * number for each piece on each square, the castling rights, the en passant file and the team to move
+ */
+namespace Zobrist {
+/**
+ * @brief the random numbers used for the hash of a board
+ */
+struct Keys {
+  /**
+   * @brief a number for each team, piece type and square (indexed with [team][type][square])
+   */
+  uint64_t pieces[2][7][64] = {};
+  /**
+   * @brief a number for each combination of the 4 castling flags
+   */
+  uint64_t castling[16] = {};
+  /**
+   * @brief a number for the file of each possible en passant position
+   */
+  uint64_t passant_file[8] = {};
+  /**
+   * @brief xor-ed into the hash if white is to move
+   */
+  uint64_t white_to_move = 0;
+};
+
+/**
+ * @brief a simple pseudo random number generator (splitmix64), so that the keys can be made at compile time
+ * @param state the state of the generator, gets advanced
+ * @return the next pseudo random number
+ */
+constexpr uint64_t nextRandom(uint64_t& state) {
+  state += 0x9E3779B97F4A7C15ULL;
+  uint64_t z = state;
+  z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+  z = (z ^ (z >> 27)) * 0x94D049BB133111EBULL;
+  return z ^ (z >> 31);
+}
+
+/**
+ * @return the keys made from a fixed seed, so that the hash of a board is the same in every run
+ */
+constexpr Keys makeKeys() {
+  Keys keys = Keys();
+  uint64_t state = 0x4C617069734170ULL;
+  for (auto& team : keys.pieces)
+    for (auto& type : team)
+      for (uint64_t& square : type) square = nextRandom(state);
+  for (uint64_t& castling : keys.castling) castling = nextRandom(state);
+  for (uint64_t& file : keys.passant_file) file = nextRandom(state);
+  keys.white_to_move = nextRandom(state);
+  return keys;
+}
+
+/**
+ * @brief the keys for all hashes
+ */
+constexpr inline Keys keys = makeKeys();
+
+/**
+ * @brief calculates the hash of a board from scratch
+ *
+ * @param board the board to hash
+ * @param player the team to move
+ * @return the hash of the board, which is equal for equal board states (no matter which moves lead to them)
+ *
+ * @note different boards can have the same hash, but that is very unlikely (around 1 in 2^64 for two boards)
+ */
+constexpr uint64_t hashBoard(const Board& board, Team::Team player) {
+  uint64_t hash = 0;
+  // through the position lists instead of the grid, as there are at most 32 pieces and no empty squares to skip
+  for (Team::Team team : {Team::BLACK, Team::WHITE}) {
+    for (int type = PieceType::KING; type <= PieceType::PAWN; ++type) {
+      const auto piece_type = static_cast<PieceType::PieceType>(type);
+      const Board_Positions::PositionsSlice pieces = board.positions.getVec(team, piece_type);
+      for (int i = 0; i < pieces.size; ++i) hash ^= keys.pieces[team][piece_type][pieces[i]];
+    }
+  }
+  const uint8_t castling = board.extra.getCastlingRights(ChessConstants::start_white_king_pos) |
+                           board.extra.getCastlingRights(ChessConstants::start_black_king_pos);
+  hash ^= keys.castling[castling & 0b1111];
+  const ChessPos passant_pos = board.extra.getPassantPos();
+  if (passant_pos.has_value()) hash ^= keys.passant_file[passant_pos.data & 0b111];
+  if (player == Team::WHITE) hash ^= keys.white_to_move;
+  return hash;
+}
+
+/**
+ * @brief calculates the hash of only the pawns of a board (i.e. the key of the pawn structure)
+ *
+ * @param board the board to hash
+ * @return the xor of the same keys hashBoard() uses for the pawns, 0 for a board without pawns
+ */
+constexpr uint64_t hashPawns(const Board& board) {
+  uint64_t hash = 0;
+  for (Team::Team team : {Team::BLACK, Team::WHITE}) {
+    const Board_Positions::PositionsSlice pawns = board.positions.getVec(team, PieceType::PAWN);
+    for (int i = 0; i < pawns.size; ++i) hash ^= keys.pieces[team][PieceType::PAWN][pawns[i]];
+  }
+  return hash;
+}
+}  // namespace Zobrist
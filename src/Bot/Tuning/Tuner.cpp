@@ -0,0 +1,492 @@
+//
+// Created by timap on 18.10.2026.
+//
+#include "Tuner.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <fstream>
+
+#include "../../IO/Parser/EpdParsing.h"
+#include "../Batch/Batch.h"
+#include "../Batch/ParallelRunner.h"
+#include "../Evaluation/KpkBitbase.h"
+#include "../Evaluation/eval_constants.h"
+#include "../Evaluation/pesto_tables.h"
+
+/**
+ * @brief the maximum midgame phase (see evaluateBoard())
+ */
+constexpr int max_phase = 24;
+
+/**
+ * @brief the names of the PeSTO tables by piece type
+ */
+constexpr std::string_view table_names[PIECETYPE_AMOUNT] = {"", "king", "queen", "knight", "bishop", "rook", "pawn"};
+
+/**
+ * @brief the order of the tables in pesto_tables.h (as in PeSTO's evaluation function)
+ */
+constexpr PieceType::PieceType table_order[] = {PieceType::PAWN,   PieceType::KNIGHT, PieceType::BISHOP,
+                                                PieceType::CASTLE, PieceType::QUEEN,  PieceType::KING};
+
+/**
+ * @param parameters the values of the tunable constants
+ * @param param the index of the parameter
+ * @return the rounded midgame and endgame value of the parameter
+ */
+static BoardValue rounded(const Tuning::Parameters& parameters, int param) {
+  return {static_cast<int>(std::lround(parameters[2 * param])),
+          static_cast<int>(std::lround(parameters[2 * param + 1]))};
+}
+
+/**
+ * @brief writes a constexpr array of 7 values (one per piece type)
+ *
+ * @param out the stream to write to
+ * @param name the name of the array
+ * @param values the values
+ */
+static void writePieceArray(std::ostream& out, std::string_view name, const int (&values)[PIECETYPE_AMOUNT]) {
+  out << "constexpr int " << name << "[7] = {";
+  for (int i = 0; i < PIECETYPE_AMOUNT; ++i) out << (i == 0 ? "" : ", ") << values[i];
+  out << "};\n";
+}
+
+/**
+ * @param value the midgame and endgame value
+ * @return the value as an initializer list, e.g. "{10, 20}"
+ */
+static std::string pair(BoardValue value) {
+  return '{' + std::to_string(value.mg) + ", " + std::to_string(value.eg) + '}';
+}
+
+namespace Tuning {
+
+// (function documentation is provided in the corresponding header)
+Parameters currentParameters() {
+  Parameters parameters = Parameters(2 * parameter_amount, 0.0);
+  const auto set = [&parameters](int param, int mg, int eg) {
+    parameters[2 * param] = mg;
+    parameters[2 * param + 1] = eg;
+  };
+  for (int type = 1; type < PIECETYPE_AMOUNT; ++type) {
+    set(material_params + type, mg_value[type], eg_value[type]);
+    set(mobility_params + type, mobility_bonus[type].mg, mobility_bonus[type].eg);
+    for (int pos = 0; pos < BOARD_SIZE; ++pos) {
+      set(pst_params + type * BOARD_SIZE + pos, mg_pesto_table[type][pos], eg_pesto_table[type][pos]);
+    }
+  }
+  set(doubled_pawn_param, doubled_pawn_penalty.mg, doubled_pawn_penalty.eg);
+  set(isolated_pawn_param, isolated_pawn_penalty.mg, isolated_pawn_penalty.eg);
+  for (int advance = 0; advance < 6; ++advance) {
+    set(passed_pawn_params + advance, passed_pawn_bonus[advance].mg, passed_pawn_bonus[advance].eg);
+  }
+  set(protected_king_param, protected_king_factor, 0);
+  return parameters;
+}
+
+// (function documentation is provided in the corresponding header)
+void Dataset::add(const EvalCoefficients& coefficients, double white_score) {
+  const auto push = [this](int param, int count) {
+    if (count == 0) return;
+    params.push_back(static_cast<uint16_t>(param));
+    counts.push_back(static_cast<int16_t>(count));
+  };
+  for (int type = 1; type < PIECETYPE_AMOUNT; ++type) {
+    push(material_params + type, coefficients.material[type]);
+    push(mobility_params + type, coefficients.mobility[type]);
+    for (int pos = 0; pos < BOARD_SIZE; ++pos) push(pst_params + type * BOARD_SIZE + pos, coefficients.pst[type][pos]);
+  }
+  // the pawn penalties get subtracted
+  push(doubled_pawn_param, -coefficients.doubled_pawns);
+  push(isolated_pawn_param, -coefficients.isolated_pawns);
+  for (int advance = 0; advance < 6; ++advance) push(passed_pawn_params + advance, coefficients.passed_pawns[advance]);
+  push(protected_king_param, coefficients.protected_king);
+
+  offsets.push_back(static_cast<uint32_t>(params.size()));
+  phases.push_back(static_cast<uint8_t>(coefficients.mid_game_phase));
+  fixed.push_back(coefficients.fixed);
+  results.push_back(static_cast<float>(white_score));
+}
+
+// (function documentation is provided in the corresponding header)
+void Dataset::append(const Dataset& other) {
+  const uint32_t base = offsets.back();
+  for (uint64_t i = 1; i < other.offsets.size(); ++i) offsets.push_back(base + other.offsets[i]);
+  params.insert(params.end(), other.params.begin(), other.params.end());
+  counts.insert(counts.end(), other.counts.begin(), other.counts.end());
+  phases.insert(phases.end(), other.phases.begin(), other.phases.end());
+  fixed.insert(fixed.end(), other.fixed.begin(), other.fixed.end());
+  results.insert(results.end(), other.results.begin(), other.results.end());
+}
+
+// (function documentation is provided in the corresponding header)
+double Dataset::score(uint64_t idx, const Parameters& parameters) const noexcept {
+  const double mg_phase = phases[idx];
+  const double eg_phase = max_phase - mg_phase;
+  double mg = 0;
+  double eg = 0;
+  for (uint32_t i = offsets[idx]; i < offsets[idx + 1]; ++i) {
+    mg += counts[i] * parameters[2 * params[i]];
+    eg += counts[i] * parameters[2 * params[i] + 1];
+  }
+  return mg_phase * mg + eg_phase * eg + fixed[idx];
+}
+
+// (function documentation is provided in the corresponding header)
+double Dataset::loss(const Parameters& parameters, double k, unsigned threads, Parameters* gradient) const {
+  // the win probability 1 / (1 + 10^(-k * centipawns / 400)) as 1 / (1 + e^(-scale * score))
+  const double scale = k * std::log(10.0) / (400.0 * max_phase);
+  std::vector<double> errors(std::max(1u, threads), 0.0);
+  std::vector<Parameters> gradients(gradient ? errors.size() : 0, Parameters(parameters.size(), 0.0));
+
+  Batch::parallelRanges(threads, size(), [&](unsigned thread, uint64_t begin, uint64_t end) {
+    double error = 0;
+    for (uint64_t idx = begin; idx < end; ++idx) {
+      const double probability = 1.0 / (1.0 + std::exp(-scale * score(idx, parameters)));
+      const double difference = results[idx] - probability;
+      error += difference * difference;
+      if (!gradient) continue;
+
+      // derivative of the squared error by the score
+      const double slope = -2.0 * difference * probability * (1.0 - probability) * scale;
+      const double mg_slope = slope * phases[idx];
+      const double eg_slope = slope * (max_phase - phases[idx]);
+      Parameters& thread_gradient = gradients[thread];
+      for (uint32_t i = offsets[idx]; i < offsets[idx + 1]; ++i) {
+        thread_gradient[2 * params[i]] += mg_slope * counts[i];
+        thread_gradient[2 * params[i] + 1] += eg_slope * counts[i];
+      }
+    }
+    errors[thread] = error;
+  });
+
+  const double amount = static_cast<double>(std::max<uint64_t>(1, size()));
+  if (gradient) {
+    gradient->assign(parameters.size(), 0.0);
+    for (const Parameters& thread_gradient : gradients) {
+      for (uint64_t i = 0; i < parameters.size(); ++i) (*gradient)[i] += thread_gradient[i] / amount;
+    }
+  }
+  double error = 0;
+  for (double thread_error : errors) error += thread_error;
+  return error / amount;
+}
+
+// (function documentation is provided in the corresponding header)
+uint64_t loadDataset(std::string_view data, Dataset& dataset, unsigned threads, std::ostream& log) {
+  std::vector<PackedPosition> positions;
+  if (data.substr(0, Packed::file_magic.size()) == Packed::file_magic) {
+    Packed::Reader reader = Packed::Reader(data);
+    if (!reader.isValid()) {
+      log << "not a valid file of packed positions\n";
+      return 0;
+    }
+    reader.readAll(positions);
+    const auto invalid = std::remove_if(positions.begin(), positions.end(),
+                                        [](const PackedPosition& position) { return !position.isValid(); });
+    if (invalid != positions.end()) log << positions.end() - invalid << " invalid packed positions\n";
+    positions.erase(invalid, positions.end());
+  } else {
+    uint64_t line_number = 0;
+    PackedPosition packed = PackedPosition();
+    while (!data.empty()) {
+      const uint64_t line_end = std::min(data.find('\n'), data.size());
+      const std::string_view line = data.substr(0, line_end);
+      data.remove_prefix(std::min(line_end + 1, data.size()));
+      line_number++;
+      if (Epd::isSkippableLine(line.substr(0, line.find(';')))) continue;
+      if (Packed::packLine(line, packed)) {
+        positions.push_back(packed);
+      } else {
+        log << "line " << line_number << ": invalid position\n";
+      }
+    }
+  }
+
+  const auto unknown = std::remove_if(positions.begin(), positions.end(), [](const PackedPosition& position) {
+    return position.result == PackedPosition::unknown_result;
+  });
+  const uint64_t amount_unknown = static_cast<uint64_t>(positions.end() - unknown);
+  positions.erase(unknown, positions.end());
+  // a king and a pawn against a king is scored by the bitbase, which does not depend on the tunable constants
+  const auto bitbase = std::remove_if(positions.begin(), positions.end(), [](const PackedPosition& position) {
+    return Kpk::isKpk(position.toBoard());
+  });
+  positions.erase(bitbase, positions.end());
+
+  // evaluating the positions is the expensive part of loading
+  std::vector<Dataset> parts(std::max(1u, threads));
+  Batch::parallelRanges(threads, positions.size(), [&](unsigned thread, uint64_t begin, uint64_t end) {
+    for (uint64_t idx = begin; idx < end; ++idx) {
+      parts[thread].add(evaluationCoefficients(positions[idx].toBoard()), positions[idx].whiteScore());
+    }
+  });
+  for (const Dataset& part : parts) dataset.append(part);
+  return amount_unknown;
+}
+
+// (function documentation is provided in the corresponding header)
+double fitScaling(const Dataset& dataset, const Parameters& parameters, unsigned threads) {
+  // golden section search, the error is unimodal in k
+  constexpr double ratio = 0.6180339887498949;
+  double low = 0;
+  double high = 10;
+  double left = high - ratio * (high - low);
+  double right = low + ratio * (high - low);
+  double left_loss = dataset.loss(parameters, left, threads);
+  double right_loss = dataset.loss(parameters, right, threads);
+  for (int i = 0; i < 40; ++i) {
+    if (left_loss < right_loss) {
+      high = right;
+      right = left;
+      right_loss = left_loss;
+      left = high - ratio * (high - low);
+      left_loss = dataset.loss(parameters, left, threads);
+    } else {
+      low = left;
+      left = right;
+      left_loss = right_loss;
+      right = low + ratio * (high - low);
+      right_loss = dataset.loss(parameters, right, threads);
+    }
+  }
+  return (low + high) / 2;
+}
+
+// (function documentation is provided in the corresponding header)
+double tune(const Dataset& dataset, Parameters& parameters, double k, const TuneOptions& options, std::ostream& log) {
+  constexpr double beta_1 = 0.9;
+  constexpr double beta_2 = 0.999;
+  constexpr double epsilon = 1e-8;
+  const unsigned threads = Batch::threadAmount(options.threads);
+
+  Parameters gradient;
+  Parameters momentum = Parameters(parameters.size(), 0.0);
+  Parameters velocity = Parameters(parameters.size(), 0.0);
+  double error = 0;
+  for (int iteration = 1; iteration <= options.iterations; ++iteration) {
+    error = dataset.loss(parameters, k, threads, &gradient);
+    // protected_king_factor has no endgame value
+    gradient[2 * protected_king_param + 1] = 0;
+
+    const double correction_1 = 1 - std::pow(beta_1, iteration);
+    const double correction_2 = 1 - std::pow(beta_2, iteration);
+    for (uint64_t i = 0; i < parameters.size(); ++i) {
+      momentum[i] = beta_1 * momentum[i] + (1 - beta_1) * gradient[i];
+      velocity[i] = beta_2 * velocity[i] + (1 - beta_2) * gradient[i] * gradient[i];
+      const double step = (momentum[i] / correction_1) / (std::sqrt(velocity[i] / correction_2) + epsilon);
+      parameters[i] -= options.learning_rate * step;
+    }
+    if (iteration % 50 == 0) log << "iteration " << iteration << ": error " << error << '\n';
+  }
+  return dataset.loss(parameters, k, threads);
+}
+
+// (function documentation is provided in the corresponding header)
+void writePestoTables(std::ostream& out, const Parameters& parameters) {
+  int mg_values[PIECETYPE_AMOUNT] = {};
+  int eg_values[PIECETYPE_AMOUNT] = {};
+  for (int type = 1; type < PIECETYPE_AMOUNT; ++type) {
+    mg_values[type] = rounded(parameters, material_params + type).mg;
+    eg_values[type] = rounded(parameters, material_params + type).eg;
+  }
+
+  out << "//\n"
+         "// Created by timap on 23.03.2024.\n"
+         "//\n"
+         "\n"
+         "#pragma once\n"
+         "// for note (might also just be wrong)\n"
+         "// my order:\n"
+         "// { NONE, KING, QUEEN, KNIGHT, BISHOP, CASTLE, PAWN };\n"
+         "// Pesto's order:\n"
+         "// { PAWN, KNIGHT, BISHOP, ROOK, QUEEN, KING}\n"
+         "\n"
+         "// started out as the pre-made data from https://www.chessprogramming.org/PeSTO%27s_Evaluation_Function,\n"
+         "// written by \"./Chess tune\" (see Bot/Tuning/Tuner.h)\n"
+         "\n"
+         "// in my order\n";
+  writePieceArray(out, "mg_value", mg_values);
+  writePieceArray(out, "eg_value", eg_values);
+  out << '\n';
+  writePieceArray(out, "mid_game_factors", mid_game_factors);
+
+  // the tables are written as 8x8 boards, a8 first
+  out << "\n// clang-format off\n";
+  for (PieceType::PieceType type : table_order) {
+    for (const bool is_midgame : {true, false}) {
+      out << "constexpr int " << (is_midgame ? "mg_" : "eg_") << table_names[type] << "_table[64] = {\n";
+      for (int row = 0; row < 8; ++row) {
+        out << "   ";
+        for (int column = 0; column < 8; ++column) {
+          const BoardValue value = rounded(parameters, pst_params + type * BOARD_SIZE + row * 8 + column);
+          const std::string number = std::to_string(is_midgame ? value.mg : value.eg);
+          out << std::string(5 - std::min<uint64_t>(4, number.size()), ' ') << number << ',';
+        }
+        out << '\n';
+      }
+      out << "};\n\n";
+    }
+  }
+  out << "// clang-format on\n"
+         "\n"
+         "// also in my order\n";
+  for (const bool is_midgame : {true, false}) {
+    const std::string_view prefix = is_midgame ? "mg_" : "eg_";
+    out << "inline const int* " << prefix << "pesto_table[7] = {\n    nullptr,";
+    for (int type = 1; type < PIECETYPE_AMOUNT; ++type) out << ' ' << prefix << table_names[type] << "_table,";
+    out << "\n};\n" << (is_midgame ? "\n" : "");
+  }
+}
+
+// (function documentation is provided in the corresponding header)
+void writeEvalConstants(std::ostream& out, const Parameters& parameters) {
+  out << "//\n"
+         "// Created by timap on 18.10.2026.\n"
+         "//\n"
+         "\n"
+         "#pragma once\n"
+         "\n"
+         "#include \"PawnHashTable.h\"\n"
+         "\n"
+         "// the tunable constants of the evaluation besides the PeSTO tables (pesto_tables.h), \"./Chess tune\" "
+         "writes a new\n"
+         "// version of this header and of pesto_tables.h (see Bot/Tuning/Tuner.h)\n"
+         "\n"
+         "/**\n"
+         " * @brief Struct to hold the board value for midgame and endgame.\n"
+         " *\n"
+         " * @note\n"
+         " * mg = the midgame value \\n\n"
+         " * eg = the endgame value\n"
+         " */\n"
+         "struct BoardValue {\n"
+         "  int mg = 0;\n"
+         "  int eg = 0;\n"
+         "};\n"
+         "\n"
+         "/**\n"
+         " * @brief Advantage for the player who is allowed to move next.\n"
+         " *\n"
+         " * @note only used when compiled with DIFFERENT_DEPTHS, so it is not tuned\n"
+         " */\n"
+         "constexpr int movers_advantage = "
+      << movers_advantage
+      << ";\n"
+         "/**\n"
+         " * @brief Factor for each piece that is next to and protecting the king\n"
+         " */\n"
+         "constexpr int protected_king_factor = "
+      << rounded(parameters, protected_king_param).mg
+      << ";\n"
+         "\n"
+         "/**\n"
+         " * @brief Penalty for each pawn behind another pawn of the same team on the same file.\n"
+         " */\n"
+         "constexpr PawnScore doubled_pawn_penalty = "
+      << pair(rounded(parameters, doubled_pawn_param))
+      << ";\n"
+         "/**\n"
+         " * @brief Penalty for each pawn without pawns of the same team on the neighbouring files.\n"
+         " */\n"
+         "constexpr PawnScore isolated_pawn_penalty = "
+      << pair(rounded(parameters, isolated_pawn_param))
+      << ";\n"
+         "/**\n"
+         " * @brief Bonus for a pawn without enemy pawns in front of it on its own and the neighbouring files, by the "
+         "amount of\n"
+         " * rows it has moved forward from its starting row (at most 5, as it gets promoted after that).\n"
+         " */\n"
+         "constexpr PawnScore passed_pawn_bonus[6] = {";
+  for (int advance = 0; advance < 6; ++advance) {
+    out << (advance == 0 ? "" : ", ") << pair(rounded(parameters, passed_pawn_params + advance));
+  }
+  out << "};\n"
+         "\n"
+         "/**\n"
+         " * @brief Bonus for each square a piece of a type can safely move to (see AttackMaps::mobility), indexed by "
+         "the type\n"
+         " * of the piece (kings and pawns are not counted).\n"
+         " */\n"
+         "constexpr BoardValue mobility_bonus[7] = {";
+  for (int type = 0; type < PIECETYPE_AMOUNT; ++type) {
+    out << (type == 0 ? "" : ", ") << pair(rounded(parameters, mobility_params + type));
+  }
+  out << "};\n";
+}
+
+// (function documentation is provided in the corresponding header)
+bool runTuner(std::string_view data, const TuneOptions& options, std::ostream& log) {
+  const unsigned threads = Batch::threadAmount(options.threads);
+  const auto start = std::chrono::steady_clock::now();
+  const auto seconds = [&start]() {
+    return std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+  };
+
+  Dataset dataset = Dataset();
+  const uint64_t amount_unknown = loadDataset(data, dataset, threads, log);
+  log << dataset.size() << " labelled positions loaded in " << seconds() << " s";
+  if (amount_unknown != 0) log << " (" << amount_unknown << " positions without a result skipped)";
+  log << '\n';
+  if (dataset.size() == 0) return false;
+
+  Parameters parameters = currentParameters();
+  const double k = fitScaling(dataset, parameters, threads);
+  log << "k = " << k << ", error " << dataset.loss(parameters, k, threads) << '\n';
+  const double error = tune(dataset, parameters, k, options, log);
+  log << "tuned error " << error << " after " << seconds() << " s\n";
+
+  std::ofstream pesto_tables(options.output_dir + "/pesto_tables.h");
+  writePestoTables(pesto_tables, parameters);
+  std::ofstream eval_constants(options.output_dir + "/eval_constants.h");
+  writeEvalConstants(eval_constants, parameters);
+  if (!pesto_tables || !eval_constants) {
+    log << "could not write the headers into " << options.output_dir << '\n';
+    return false;
+  }
+  log << "wrote pesto_tables.h and eval_constants.h into " << options.output_dir << '\n';
+  return true;
+}
+
+// (function documentation is provided in the corresponding header)
+bool parseTuneArguments(int argc, const char* const* argv, TuneOptions& options, std::string& input_path) {
+  bool has_input = false;
+  for (int i = 0; i < argc; ++i) {
+    const std::string_view arg = argv[i];
+    const bool has_value = i + 1 < argc;
+    try {
+      if (arg == "--iterations" && has_value) {
+        options.iterations = std::max(0, std::stoi(argv[++i]));
+      } else if (arg == "--rate" && has_value) {
+        options.learning_rate = std::stod(argv[++i]);
+      } else if (arg == "--threads" && has_value) {
+        options.threads = static_cast<unsigned>(std::max(0, std::stoi(argv[++i])));
+      } else if (arg == "--out" && has_value) {
+        options.output_dir = argv[++i];
+      } else if (!has_input && arg.rfind("--", 0) != 0) {
+        input_path = std::string(arg);
+        has_input = true;
+      } else {
+        return false;
+      }
+    } catch (const std::exception&) {
+      return false;
+    }
+  }
+  return has_input;
+}
+
+// (function documentation is provided in the corresponding header)
+void printTuneUsage(std::ostream& os) {
+  os << "usage: ./Chess tune [options] FILE\n"
+        "  tunes the evaluation on the positions of FILE (packed positions or EPD lines with c9 \"1-0\",\n"
+        "  \"0-1\" or \"1/2-1/2\") and writes the tuned pesto_tables.h and eval_constants.h\n"
+        "  --iterations N  the amount of gradient descent steps (default: 1000)\n"
+        "  --rate R        the step size in centipawns (default: 1)\n"
+        "  --threads N     the amount of threads (default: one per core)\n"
+        "  --out DIR       the directory for the headers (default: .)\n";
+}
+}  // namespace Tuning
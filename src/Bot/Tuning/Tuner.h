@@ -0,0 +1,223 @@
+//
+// Created by timap on 18.10.2026.
+//
+
+#pragma once
+
+#include <cstdint>
+#include <ostream>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "../../IO/Binary/PackedPosition.h"
+#include "../Evaluation/Evaluate.h"
+
+/**
+ * @brief Texel tuning of the constants of evaluateBoard() (pesto_tables.h and eval_constants.h) on positions labelled
+ * with the result of their game.
+ *
+ * @note the evaluation is linear in its tunable constants (see EvalCoefficients), so every position only gets
+ * evaluated once to get its coefficients. Afterwards the score of a position for any constants is a short dot product
+ * of about 40 coefficients, which makes the loss and its gradient cheap enough for millions of positions.
+ */
+namespace Tuning {
+/**
+ * @brief the index of the first parameter of each group of tunable constants (each parameter has a midgame and an
+ * endgame value)
+ */
+constexpr int material_params = 0;
+constexpr int pst_params = material_params + PIECETYPE_AMOUNT;
+constexpr int mobility_params = pst_params + PIECETYPE_AMOUNT * BOARD_SIZE;
+constexpr int doubled_pawn_param = mobility_params + PIECETYPE_AMOUNT;
+constexpr int isolated_pawn_param = doubled_pawn_param + 1;
+constexpr int passed_pawn_params = isolated_pawn_param + 1;
+/**
+ * @brief protected_king_factor only has a midgame value (its endgame value stays 0)
+ */
+constexpr int protected_king_param = passed_pawn_params + 6;
+/**
+ * @brief the amount of parameters
+ */
+constexpr int parameter_amount = protected_king_param + 1;
+
+/**
+ * @brief the values of all tunable constants, indexed with [2 * parameter] for the midgame value and
+ * [2 * parameter + 1] for the endgame value
+ */
+using Parameters = std::vector<double>;
+
+/**
+ * @return the parameters with the constants evaluateBoard() currently uses
+ */
+Parameters currentParameters();
+
+/**
+ * @brief how the tuner runs
+ */
+struct TuneOptions {
+  /**
+   * @brief the amount of gradient descent steps
+   */
+  int iterations = 1000;
+  /**
+   * @brief the step size of the optimizer (Adam) in centipawns
+   */
+  double learning_rate = 1.0;
+  /**
+   * @brief the amount of threads, 0 for one per core
+   */
+  unsigned threads = 0;
+  /**
+   * @brief the directory the tuned pesto_tables.h and eval_constants.h get written to
+   */
+  std::string output_dir = ".";
+};
+
+/**
+ * @brief labelled positions, each stored as the coefficients of its evaluation
+ *
+ * @note the coefficients of all positions lie next to each other in a few flat arrays (about 170 bytes per position),
+ * so that the dot products of the tuner walk linearly through memory
+ */
+class Dataset {
+ private:
+  /**
+   * @brief the index of the first coefficient of each position, plus the end of the last position
+   */
+  std::vector<uint32_t> offsets = {0};
+  /**
+   * @brief the parameter of each coefficient
+   */
+  std::vector<uint16_t> params;
+  /**
+   * @brief the value of each coefficient (white minus black)
+   */
+  std::vector<int16_t> counts;
+  /**
+   * @brief the midgame phase of each position (0 ..= 24)
+   */
+  std::vector<uint8_t> phases;
+  /**
+   * @brief the part of the score of each position that does not depend on the parameters
+   */
+  std::vector<int32_t> fixed;
+  /**
+   * @brief the result of the game of each position from the view of white (1, 0.5 or 0)
+   */
+  std::vector<float> results;
+
+ public:
+  /**
+   * @brief adds a position
+   * @param coefficients the coefficients of its evaluation
+   * @param white_score the result of its game from the view of white (1, 0.5 or 0)
+   */
+  void add(const EvalCoefficients& coefficients, double white_score);
+
+  /**
+   * @brief adds all positions of another dataset
+   * @param other the positions to add
+   */
+  void append(const Dataset& other);
+
+  /**
+   * @return the amount of positions
+   */
+  [[nodiscard]] uint64_t size() const noexcept { return results.size(); }
+
+  /**
+   * @param idx the index of a position
+   * @param parameters the values of the tunable constants
+   * @return the score of the position in the scale of evaluateBoard() (i.e. centipawns * 24)
+   */
+  [[nodiscard]] double score(uint64_t idx, const Parameters& parameters) const noexcept;
+
+  /**
+   * @brief the mean squared error between the results and the win probabilities of the scores
+   *
+   * @param parameters the values of the tunable constants
+   * @param k the scaling of the scores in the win probability 1 / (1 + 10^(-k * centipawns / 400))
+   * @param threads the amount of threads
+   * @param gradient if not nullptr, set to the gradient of the error for each parameter
+   * @return the mean squared error
+   */
+  double loss(const Parameters& parameters, double k, unsigned threads, Parameters* gradient = nullptr) const;
+};
+
+/**
+ * @brief reads labelled positions
+ *
+ * @param data the content of a file of packed positions (see PackedPosition::result) or of EPD lines with the result
+ * in a c9 operation (e.g. `[FEN] c9 "1/2-1/2";`)
+ * @param dataset the positions with a known result get added to it (besides a king and a pawn against a king, which
+ * is scored by the bitbase, see Kpk::evaluate())
+ * @param threads the amount of threads that evaluate the positions
+ * @param log gets a line for every position that can not be read
+ * @return the amount of positions without a known result, which were skipped
+ */
+uint64_t loadDataset(std::string_view data, Dataset& dataset, unsigned threads, std::ostream& log);
+
+/**
+ * @brief finds the scaling k of the win probability that fits the dataset best with the given parameters
+ *
+ * @param dataset the labelled positions
+ * @param parameters the values of the tunable constants
+ * @param threads the amount of threads
+ * @return k (between 0 and 10)
+ */
+double fitScaling(const Dataset& dataset, const Parameters& parameters, unsigned threads);
+
+/**
+ * @brief runs gradient descent (Adam) on the parameters
+ *
+ * @param dataset the labelled positions
+ * @param parameters the values to start from, set to the tuned values
+ * @param k the scaling of the win probability (see fitScaling())
+ * @param options the amount of iterations, the step size and the amount of threads
+ * @param log gets the error every 50 iterations
+ * @return the error with the tuned parameters
+ */
+double tune(const Dataset& dataset, Parameters& parameters, double k, const TuneOptions& options, std::ostream& log);
+
+/**
+ * @brief writes pesto_tables.h with the given (rounded) parameters
+ * @param out the stream to write the header to
+ * @param parameters the values of the tunable constants
+ */
+void writePestoTables(std::ostream& out, const Parameters& parameters);
+
+/**
+ * @brief writes eval_constants.h with the given (rounded) parameters
+ * @param out the stream to write the header to
+ * @param parameters the values of the tunable constants
+ */
+void writeEvalConstants(std::ostream& out, const Parameters& parameters);
+
+/**
+ * @brief loads the dataset, tunes the parameters and writes the headers into options.output_dir
+ *
+ * @param data the content of the dataset file (see loadDataset())
+ * @param options how the tuner runs
+ * @param log gets the progress
+ * @return false if there were no labelled positions or the headers could not be written
+ */
+bool runTuner(std::string_view data, const TuneOptions& options, std::ostream& log);
+
+/**
+ * @brief parses the command line arguments of the tune mode
+ *
+ * @param argc the amount of arguments
+ * @param argv the arguments, starting with the first argument after "tune"
+ * @param options the options to set
+ * @param input_path set to the dataset file
+ * @return false if the arguments are invalid
+ */
+bool parseTuneArguments(int argc, const char* const* argv, TuneOptions& options, std::string& input_path);
+
+/**
+ * @brief prints how to use the tune mode
+ * @param os the stream to print to
+ */
+void printTuneUsage(std::ostream& os);
+}  // namespace Tuning
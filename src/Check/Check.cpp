@@ -4,6 +4,7 @@
 
 #include "Check.h"
 
+#include "../Profiling/Profiler.h"
 #include "../Types/Vec2.h"
 
 /**
@@ -79,6 +80,7 @@ static constexpr bool king_check_linear_search(const Board& board, const Vec2* d
 
 // (function documentation is provided in the corresponding header)
 bool Check::isChecked(const Board& board, Team::Team team, int8_t king_pos) noexcept {
+  PROFILE_ZONE(IS_CHECKED);
   const Vec2 king_pos_2D = Vec2::newVec2(king_pos);
 
   const Team::Team enemy_team = Team::getEnemyTeam(team);
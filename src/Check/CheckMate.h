@@ -3,7 +3,6 @@
 //
 
 #pragma once
-#include <vector>
 
 #include "../Board/Board.h"
 #include "../PossibleMoves/PossibleMoves.h"
@@ -17,11 +16,6 @@ namespace CheckMate {
  * @return true if the player is checkmated, otherwise false
  */
 inline bool isCheckMated(const Board& board, Team::Team player) noexcept {
-  std::vector<Move> move_list;
-  PossibleMoves::getAllPossibleMoves(board, move_list, player);
-  PossibleMoves::trimMovesPuttingPlayerIntoCheckmate(board, move_list, player);
-
-  const bool no_possible_moves_left = move_list.empty();
-  return no_possible_moves_left;
+  return !PossibleMoves::hasLegalMove(board, player);
 }
 }  // namespace CheckMate
@@ -4,15 +4,22 @@
 
 #pragma once
 
+#include <algorithm>
 #include <iostream>
+#include <limits>
+#include <memory>
 #include <string>
+#include <string_view>
 #include <vector>
 
 #include "Board/Board.h"
 #include "Bot/Evaluation/Evaluate.h"
 #include "Bot/MinMax/MinMax.h"
+#include "Bot/Search/AsyncSearch.h"
+#include "Bot/TranspositionTable/Zobrist.h"
 #include "Check/CheckMate.h"
 #include "IO/Parser/FenParsing.h"
+#include "IO/Parser/SanParsing.h"
 #include "IO/Print/Print.h"
 #include "PossibleMoves/PossibleMoves.h"
 #include "Types/Move/UserMove.h"
@@ -31,6 +38,13 @@ enum class Result : int8_t { SUCCESS, FAILURE };
  * Wraps the Chess Board and other Functionality into a simple to use ChessGame class
  */
 class ChessGame {
+ public:
+  /**
+   * @brief the depth with which the bot searches its moves
+   */
+  static constexpr int bot_search_depth = 5;
+
+ private:
   /**
    * @brief Struct for the History of the current Chess Game.
    */
@@ -45,6 +59,45 @@ class ChessGame {
     int half_turn_before_move = 0;
   };
 
+  /**
+   * @brief Struct for everything the bot keeps between its moves, including the search on the player's time.
+   *
+   * @note pondering: after the bot moved, it already searches its answer to the player move it expects in the
+   * background. If the player makes that move, the search simply continues (or is already done), otherwise it gets
+   * thrown away, but the boards it already searched stay in the table for the next search.
+   */
+  struct BotState {
+    /**
+     * @brief the results of all previous searches of this game
+     */
+    TranspositionTable tt = TranspositionTable();
+    /**
+     * @brief the move the bot expects the player to make next, or an empty move if it does not expect one
+     */
+    Move expected_player_move = Move();
+    /**
+     * @brief whether a search for the expected player move was started and not yet used or thrown away
+     */
+    bool is_pondering = false;
+    /**
+     * @brief whether the player made the expected move while the bot was pondering
+     */
+    bool ponder_hit = false;
+    /**
+     * @brief the result of the pondering search, written by the search thread when it is done
+     */
+    std::shared_ptr<SearchResult> ponder_result = std::make_shared<SearchResult>();
+    /**
+     * @brief the search started by startAnalysis()
+     */
+    AsyncSearch analysis_search;
+    /**
+     * @brief the pondering search (the searches are declared last, so that they are stopped before the table they use
+     * is destroyed)
+     */
+    AsyncSearch ponder_search;
+  };
+
   /**
    * @brief the Chess Board that store Piece Location and other data about the board
    */
@@ -69,6 +122,72 @@ class ChessGame {
    * @brief the team of the bot
    */
   Team::Team bot_color;
+  /**
+   * @brief the state the bot keeps between its moves (on the heap, so that the ChessGame itself stays movable)
+   */
+  std::unique_ptr<BotState> bot = std::make_unique<BotState>();
+
+  /**
+   * @brief Searches the best move for the bot, or takes the result of pondering if the player made the expected move
+   *
+   * @return The result of the search, without a best move if the bot is in checkmate or stalemate
+   */
+  SearchResult searchBotMove() {
+    if (bot->is_pondering && bot->ponder_hit) {
+      // the pondering search already searched the current board, it only has to finish
+      bot->ponder_search.wait();
+      bot->is_pondering = false;
+      return *bot->ponder_result;
+    }
+    stopPondering();
+
+    SearchLimits limits = SearchLimits();
+    limits.depth = bot_search_depth;
+    SearchControl control = SearchControl();
+    return Search::iterativeDeepening(board, current_move_maker, limits, control, {}, &bot->tt);
+  }
+
+  /**
+   * @brief Converts a score of the search to a string
+   *
+   * @param score The score (for white) as returned by the search
+   * @return The score as a number like evaluate(), or "mate n" if white mates in n moves ("mate -n" for black)
+   */
+  [[nodiscard]] static std::string scoreAsString(int score) {
+    if (isMateScore(score)) return "mate " + std::to_string(mateInMoves(score, Team::WHITE));
+    return std::to_string(score);
+  }
+
+  /**
+   * @brief Converts a line of moves to a string in the same move syntax as the player's moves
+   *
+   * @param board The board on which the line starts
+   * @param pv The line of moves
+   * @return The moves of the line separated by spaces
+   */
+  [[nodiscard]] static std::string pvAsString(Board board, const PrincipalVariation& pv) {
+    std::string result;
+    for (int i = 0; i < pv.length; ++i) {
+      const Move move = pv.moves[i];
+      if (i > 0) result.push_back(' ');
+      result += Print::move_as_string(move, board.isMoveCapture(move));
+      // the captures of the following moves depend on the board after this move
+      board.movePiece(move);
+    }
+    return result;
+  }
+
+  /**
+   * @brief Finds the move the player will most likely make after the bot's move
+   *
+   * @param result the search result of the bot's move, which is already executed
+   * @return The second move of the line of best moves, or the best move the table remembers for the current board
+   */
+  [[nodiscard]] Move expectedPlayerMove(const SearchResult& result) const {
+    if (result.pv.length > 1) return result.pv.moves[1];
+    const TTEntry* entry = bot->tt.probe(Zobrist::hashBoard(board, current_move_maker));
+    return entry != nullptr ? entry->best_move : Move();
+  }
 
   /**
    * @brief Executes a move without checking for its legality.
@@ -99,6 +218,18 @@ class ChessGame {
     history.push_back(current_history);
   }
 
+  /**
+   * @brief Executes a legal move of the player and keeps the pondering search if the bot expected the move.
+   *
+   * @param move The legal move to be executed
+   */
+  void executeLegalPlayerMove(Move move) {
+    bot->ponder_hit = bot->is_pondering && move == bot->expected_player_move;
+    // the pondering search is of no use anymore, so its thread should not take cpu time from the next search
+    if (!bot->ponder_hit) stopPondering();
+    executeMove(move);
+  }
+
  public:
   // constructor
   /**
@@ -129,31 +260,148 @@ class ChessGame {
    * @return The result of whether the move was executed or not
    */
   Result executePlayerMove(UserMove move) {
+    // the board of the analysis is about to change
+    stopAnalysis();
+    // only the moves of the moving piece type are generated, and only the matching move is checked for legality
     std::vector<Move> move_list;
-    PossibleMoves::getAllPossibleMoves(board, move_list, current_move_maker);
-    PossibleMoves::trimMovesPuttingPlayerIntoCheckmate(board, move_list, current_move_maker);
+    PossibleMoves::getAllPossibleMovesOfType(board, move_list, current_move_maker, move.piece.type);
 
     for (Move& current_move : move_list) {
-      if (move.equals(current_move, board.isMoveCapture(current_move))) {
-        executeMove(current_move);
+      if (move.equals(current_move, board.isMoveCapture(current_move)) &&
+          PossibleMoves::isMoveLegal(board, current_move, current_move_maker)) {
+        executeLegalPlayerMove(current_move);
         return Result::SUCCESS;
       }
     }
     return Result::FAILURE;
   }
 
+  /**
+   * @brief Executes a Player made Move given in Standard Algebraic Notation (e.g. "Nf3") when it is legal.
+   *
+   * @param san The move in SAN
+   * @return The result of whether the move was executed or not (FAILURE for illegal and ambiguous moves)
+   */
+  Result executePlayerSanMove(std::string_view san) {
+    // the board of the analysis is about to change
+    stopAnalysis();
+    const SlimOptional<Move> move = San::findMove(board, current_move_maker, san);
+    if (!move.has_value()) return Result::FAILURE;
+    executeLegalPlayerMove(move.data);
+    return Result::SUCCESS;
+  }
+
   /**
    * @brief Lets the bot make a move.
    *
    * @return The result of whether the move was executed or not
    */
   Result let_bot_make_move() {
-    SlimOptional<Move> move = getBestMove();
-    if (!move.has_value()) return Result::FAILURE;
-    executeMove(move.data);
+    const SearchResult result = searchBotMove();
+    if (!result.best_move.has_value()) return Result::FAILURE;
+    executeMove(result.best_move.data);
+    bot->expected_player_move = expectedPlayerMove(result);
     return Result::SUCCESS;
   }
 
+  // pondering
+  /**
+   * @brief Starts searching the bot's answer to the expected player move in the background.
+   *
+   * @note does nothing if it is not the player's turn or the bot does not expect a legal player move. \n
+   * The search is used by the next let_bot_make_move() if the player makes the expected move
+   */
+  void startPondering() {
+    stopPondering();
+    stopAnalysis();
+    if (!isPlayerTurn()) return;
+
+    // the expected move can come from the table, which can (very rarely) contain a move of another board
+    std::vector<Move> move_list;
+    PossibleMoves::getAllPossibleMoves(board, move_list, current_move_maker);
+    PossibleMoves::trimMovesPuttingPlayerIntoCheckmate(board, move_list, current_move_maker);
+    const Move expected_move = bot->expected_player_move;
+    if (std::find(move_list.begin(), move_list.end(), expected_move) == move_list.end()) return;
+
+    Board expected_board = board;
+    expected_board.movePiece(expected_move);
+
+    SearchLimits limits = SearchLimits();
+    limits.depth = bot_search_depth;
+    std::shared_ptr<SearchResult> ponder_result = bot->ponder_result;
+    bot->ponder_search.start(
+        expected_board, bot_color, limits, {}, [ponder_result](const SearchResult& result) { *ponder_result = result; },
+        &bot->tt);
+    bot->is_pondering = true;
+    bot->ponder_hit = false;
+  }
+
+  /**
+   * @brief Stops the pondering search (if there is one) and throws its result away.
+   *
+   * @note the boards it already searched stay in the table
+   */
+  void stopPondering() {
+    if (!bot->is_pondering) return;
+    bot->ponder_search.stop();
+    bot->is_pondering = false;
+    bot->ponder_hit = false;
+  }
+
+  // analysis
+  /**
+   * @brief Starts searching the best move for the current player in the background, so that the caller can keep
+   * reading commands (e.g. to stop the search).
+   *
+   * @param os The output stream that gets one line per finished depth (depth, score, nodes, nps, time and line of best
+   * moves) and at the end the best move, written from the search thread
+   * @param depth The depth up to which the search deepens
+   * @param multi_pv The amount of best moves to show for each depth (each in its own line, numbered if more than 1)
+   *
+   * @note only one analysis runs at a time, starting a new one stops the previous one first
+   */
+  void startAnalysis(std::ostream& os, int depth, int multi_pv = 1) {
+    // both would use the table at the same time
+    stopPondering();
+    stopAnalysis();
+    SearchLimits limits = SearchLimits();
+    limits.depth = depth;
+    limits.multi_pv = multi_pv;
+    const Board root_board = board;
+    bot->analysis_search.start(
+        board, current_move_maker, limits,
+        [&os, root_board, multi_pv](const Search::SearchInfo& info) {
+          const uint64_t nps = info.nodes * 1000 / static_cast<uint64_t>(info.time_ms + 1);
+          for (uint64_t i = 0; i < info.lines.size(); ++i) {
+            const SearchResult& line = info.lines[i];
+            os << "depth " << line.depth;
+            if (multi_pv > 1) os << " line " << i + 1;
+            os << " score " << scoreAsString(line.score) << " nodes " << info.nodes << " nps " << nps << " time "
+               << info.time_ms << " pv " << pvAsString(root_board, line.pv) << '\n';
+          }
+          os << std::flush;
+        },
+        [&os, root_board](const SearchResult& result) {
+          if (!result.best_move.has_value()) {
+            os << "no legal move" << std::endl;
+            return;
+          }
+          const Move move = result.best_move.data;
+          os << Print::move_as_string(move, root_board.isMoveCapture(move)) << std::endl;
+        },
+        &bot->tt);
+  }
+
+  /**
+   * @brief Stops the analysis (if there is one), which then prints the best move found so far.
+   */
+  void stopAnalysis() { bot->analysis_search.stop(); }
+
+  /**
+   * @return true if the bot is currently searching (or has searched) its answer to the expected player move
+   */
+  [[nodiscard]] inline bool isPondering() const { return bot->is_pondering; }
+
   // undo moves
   /**
    * @brief Undoes the previous move.
@@ -163,6 +411,9 @@ class ChessGame {
   Result undo_move() {
     // check that there are moves that can be undone
     if (history.empty()) return Result::FAILURE;
+    // the pondering search expects the player to answer the current board
+    stopPondering();
+    stopAnalysis();
 
     const History& last_elem = history.back();
 
@@ -219,6 +470,23 @@ class ChessGame {
     os << std::endl;
   }
 
+  /**
+   * @brief Prints all moves possible for the current player with their score, best move first, one move per line
+   *
+   * @param os The output stream to be printed to
+   * @param depth The depth each move is searched with
+   *
+   * @note the score is the same as in startAnalysis(), i.e. for white
+   */
+  void print_all_possible_moves_with_scores(std::ostream& os, int depth) const {
+    for (const SearchResult& line : scoreAllMoves(depth)) {
+      if (!line.best_move.has_value()) break;
+      const Move move = line.best_move.data;
+      os << Print::move_as_string(move, board.isMoveCapture(move)) << ' ' << scoreAsString(line.score) << '\n';
+    }
+    os << std::endl;
+  }
+
   /**
    * @brief Prints a move to the given output stream
    *
@@ -231,13 +499,25 @@ class ChessGame {
 
   // helper Methods
   /**
-   * @brief Calculates the best move for the current player using MinMax with a search depth of 5.
+   * @brief Calculates the best move for the current player using MinMax with a search depth of 5 (blocking).
    *
    * @return The best move currently, or no move if the player is in checkMate
    */
   [[nodiscard]] inline SlimOptional<Move> getBestMove() const {
     const int amount_half_turns_since_start = current_turn * 2 + (current_move_maker == Team::BLACK);
-    return MinMax(board, 5, current_move_maker, amount_half_turns_since_start);
+    return MinMax(board, bot_search_depth, current_move_maker, amount_half_turns_since_start);
+  }
+
+  /**
+   * @brief Calculates the exact score of every legal move of the current player (blocking).
+   *
+   * @param depth The depth each move is searched with
+   * @return Every legal move with its score and line, best move first \n
+   * (or a single result without a move, if there is no legal move)
+   */
+  [[nodiscard]] inline std::vector<SearchResult> scoreAllMoves(int depth) const {
+    SearchStats stats = SearchStats();
+    return MinMaxMultiPV(board, depth, current_move_maker, std::numeric_limits<int>::max(), stats, nullptr);
   }
 
   /**
@@ -268,6 +548,13 @@ class ChessGame {
    */
   [[nodiscard]] inline int evaluate() const { return evaluateBoard(board, current_move_maker); }
 
+  /**
+   * @brief Evaluates the current board state and records every term of the evaluation (see evaluate()).
+   *
+   * @return the terms of the evaluation for each team and the score
+   */
+  [[nodiscard]] inline EvalTrace evaluationTrace() const { return ::evaluationTrace(board, current_move_maker); }
+
   /**
    * @brief Checking who can currently move their pieces
    *
@@ -0,0 +1,286 @@
+//
+// Created by timap on 18.10.2026.
+//
+#include "PackedPosition.h"
+
+#include <algorithm>
+#include <cstring>
+#include <string>
+
+#include "../../Bot/Evaluation/Evaluate.h"
+#include "../Parser/EpdParsing.h"
+
+/**
+ * @brief the record size as written into the header
+ */
+constexpr uint32_t record_size = sizeof(PackedPosition);
+
+/**
+ * @param piece a piece that is not empty
+ * @return the 4 bit code of the piece
+ */
+static constexpr uint8_t pieceCode(Piece piece) noexcept {
+  return static_cast<uint8_t>(piece.type | (piece.team == Team::WHITE ? 0b1000 : 0));
+}
+
+/**
+ * @param code a valid 4 bit code
+ * @return the piece of the code
+ */
+static constexpr Piece pieceFromCode(uint8_t code) noexcept {
+  return Piece((code & 0b1000) ? Team::WHITE : Team::BLACK, static_cast<PieceType::PieceType>(code & 0b111));
+}
+
+/**
+ * @param pieces the packed pieces
+ * @param idx the index of the piece (in the order of the set bits of the occupancy)
+ * @return the 4 bit code of the piece
+ */
+static constexpr uint8_t codeAt(const uint8_t (&pieces)[16], int idx) noexcept {
+  return (idx & 1) ? static_cast<uint8_t>(pieces[idx >> 1] >> 4) : static_cast<uint8_t>(pieces[idx >> 1] & 0x0F);
+}
+
+/**
+ * @param value a move counter
+ * @return the move counter clamped to the range of uint16_t
+ */
+static constexpr uint16_t clampCounter(int value) noexcept {
+  return static_cast<uint16_t>(std::clamp(value, 0, 65535));
+}
+
+// (function documentation is provided in the corresponding header)
+PackedPosition PackedPosition::pack(const Board& board, Team::Team player, int turn, int half_moves) noexcept {
+  PackedPosition packed = PackedPosition();
+  int idx = 0;
+  for (int pos = 0; pos < BOARD_SIZE; ++pos) {
+    const Piece piece = board.grid[pos];
+    if (piece.team == Team::NONE) continue;
+    packed.occupancy |= uint64_t(1) << pos;
+    packed.pieces[idx >> 1] |= static_cast<uint8_t>(pieceCode(piece) << ((idx & 1) << 2));
+    idx++;
+  }
+
+  const uint8_t castling = board.extra.getCastlingRights(ChessConstants::start_white_king_pos) |
+                           board.extra.getCastlingRights(ChessConstants::start_black_king_pos);
+  packed.flags = static_cast<uint8_t>(castling | (player == Team::WHITE ? white_to_move_flag : 0));
+  const ChessPos passant_pos = board.extra.getPassantPos();
+  packed.en_passant = passant_pos.has_value() ? static_cast<uint8_t>(passant_pos.data) : no_en_passant;
+  packed.half_moves = clampCounter(half_moves);
+  packed.turn = clampCounter(turn);
+  return packed;
+}
+
+// (function documentation is provided in the corresponding header)
+PackedPosition PackedPosition::pack(const Fen& fen) noexcept {
+  return pack(Board(fen), fen.current_player, fen.current_turn, fen.amount_half_moves);
+}
+
+// (function documentation is provided in the corresponding header)
+bool PackedPosition::isValid() const noexcept {
+  int amount_pieces = 0;
+  int amount_team_pieces[TEAM_AMOUNT] = {0, 0};
+  int amount_kings[TEAM_AMOUNT] = {0, 0};
+  int amount_pawns[TEAM_AMOUNT] = {0, 0};
+  for (int pos = 0; pos < BOARD_SIZE; ++pos) {
+    if (((occupancy >> pos) & 1) == 0) continue;
+    if (amount_pieces == 32) return false;
+    const uint8_t code = codeAt(pieces, amount_pieces++);
+    const uint8_t type = code & 0b111;
+    const Team::Team team = (code & 0b1000) ? Team::WHITE : Team::BLACK;
+    if (type == PieceType::NONE || type > PieceType::PAWN) return false;
+    amount_team_pieces[team]++;
+    if (type == PieceType::KING) amount_kings[team]++;
+    if (type == PieceType::PAWN) {
+      // a pawn can never stand on the first or last row
+      if (pos < 8 || pos >= BOARD_SIZE - 8) return false;
+      amount_pawns[team]++;
+    }
+  }
+  for (int team = 0; team < TEAM_AMOUNT; ++team) {
+    if (amount_team_pieces[team] > PIECES_PER_TEAM || amount_kings[team] != 1 || amount_pawns[team] > 8) return false;
+  }
+  if ((flags & ~(white_to_move_flag | 0b1111)) != 0 || result > white_won || reserved != 0) return false;
+  if (en_passant == no_en_passant) return true;
+  const int row = en_passant >> 3;
+  return en_passant < BOARD_SIZE &&
+         (row == ChessConstants::black_en_passant_row || row == ChessConstants::white_en_passant_row);
+}
+
+// (function documentation is provided in the corresponding header)
+Board PackedPosition::toBoard() const noexcept {
+  // the grid starts out with only empty squares
+  Board_8x8 grid = Board_8x8("8/8/8/8/8/8/8/8");
+  int idx = 0;
+  for (int pos = 0; pos < BOARD_SIZE; ++pos) {
+    if ((occupancy >> pos) & 1) grid.setPiece(pos, pieceFromCode(codeAt(pieces, idx++)));
+  }
+  const ChessPos passant_pos =
+      en_passant == no_en_passant ? ChessPos::nullopt() : SlimOptional(static_cast<int8_t>(en_passant));
+  return Board(grid, Board_Extra(static_cast<uint8_t>(flags & 0b1111), passant_pos));
+}
+
+// (function documentation is provided in the corresponding header)
+uint8_t PackedPosition::parseResult(std::string_view result_str) noexcept {
+  if (result_str == "1-0") return white_won;
+  if (result_str == "0-1") return black_won;
+  if (result_str == "1/2-1/2") return draw;
+  return unknown_result;
+}
+
+// (function documentation is provided in the corresponding header)
+std::string_view PackedPosition::resultAsString() const noexcept {
+  switch (result) {
+    case white_won:
+      return "1-0";
+    case black_won:
+      return "0-1";
+    case draw:
+      return "1/2-1/2";
+    default:
+      return "";
+  }
+}
+
+// (function documentation is provided in the corresponding header)
+Fen PackedPosition::toFen(Print::FenBuffer& buffer) const noexcept {
+  const Board board = toBoard();
+  Fen fen = Fen();
+  const std::string_view fen_str = Print::write_fen(buffer, board.grid, board.extra, player(), turn, half_moves);
+  fen.board = fen_str.substr(0, fen_str.find(' '));
+  fen.current_player = player();
+  fen.castling = static_cast<uint8_t>(flags & 0b1111);
+  fen.en_passant = board.extra.getPassantPos();
+  fen.amount_half_moves = half_moves;
+  fen.current_turn = turn;
+  return fen;
+}
+
+// (function documentation is provided in the corresponding header)
+bool PackedPosition::operator==(const PackedPosition& other) const noexcept {
+  return std::memcmp(this, &other, sizeof(PackedPosition)) == 0;
+}
+
+namespace Packed {
+
+// (function documentation is provided in the corresponding header)
+Writer::Writer(std::ostream& out) : out(out) {
+  char header[header_size];
+  std::memcpy(header, file_magic.data(), file_magic.size());
+  std::memcpy(header + file_magic.size(), &record_size, sizeof(record_size));
+  out.write(header, header_size);
+  pending.reserve(positions_per_write);
+}
+
+// (function documentation is provided in the corresponding header)
+Writer::~Writer() { flush(); }
+
+// (function documentation is provided in the corresponding header)
+void Writer::write(const PackedPosition& position) {
+  pending.push_back(position);
+  amount++;
+  if (pending.size() == positions_per_write) flush();
+}
+
+// (function documentation is provided in the corresponding header)
+void Writer::flush() {
+  if (!pending.empty()) {
+    out.write(reinterpret_cast<const char*>(pending.data()),
+              static_cast<std::streamsize>(pending.size() * sizeof(PackedPosition)));
+    pending.clear();
+  }
+  out.flush();
+}
+
+// (function documentation is provided in the corresponding header)
+Reader::Reader(std::string_view data) noexcept {
+  if (data.size() < header_size || data.substr(0, file_magic.size()) != file_magic) return;
+  uint32_t size = 0;
+  std::memcpy(&size, data.data() + file_magic.size(), sizeof(size));
+  rest = data.substr(header_size);
+  is_valid = size == record_size && rest.size() % record_size == 0;
+}
+
+// (function documentation is provided in the corresponding header)
+bool Reader::next(PackedPosition& position) noexcept {
+  if (!is_valid || rest.size() < record_size) return false;
+  std::memcpy(&position, rest.data(), record_size);
+  rest.remove_prefix(record_size);
+  return true;
+}
+
+// (function documentation is provided in the corresponding header)
+void Reader::readAll(std::vector<PackedPosition>& positions) {
+  const uint64_t amount = remaining();
+  if (amount == 0) return;
+  const uint64_t old_size = positions.size();
+  positions.resize(old_size + amount);
+  std::memcpy(positions.data() + old_size, rest.data(), amount * record_size);
+  rest.remove_prefix(amount * record_size);
+}
+
+// (function documentation is provided in the corresponding header)
+bool packLine(std::string_view line, PackedPosition& packed) {
+  try {
+    // also accepts EPD lines without the move counters
+    const EpdRecord record = Epd::parseLine(line.substr(0, line.find(';')));
+    Fen fen = Fen();
+    if (Fen::parseFenFromStr(record.fen, fen) != FenError::NONE) return false;
+    packed = PackedPosition::pack(fen);
+    if (const std::string* result = record.findOperand("c9")) packed.result = PackedPosition::parseResult(*result);
+    return true;
+  } catch (const FenParsingException&) {
+    return false;
+  }
+}
+
+// (function documentation is provided in the corresponding header)
+uint64_t packFenLines(std::istream& in, std::ostream& out, std::ostream& log) {
+  Writer writer = Writer(out);
+  std::string line;
+  uint64_t line_number = 0;
+  PackedPosition packed = PackedPosition();
+  while (std::getline(in, line)) {
+    line_number++;
+    if (Epd::isSkippableLine(std::string_view(line).substr(0, line.find(';')))) continue;
+    if (packLine(line, packed)) {
+      writer.write(packed);
+    } else {
+      log << "line " << line_number << ": invalid position\n";
+    }
+  }
+  writer.flush();
+  return writer.size();
+}
+
+// (function documentation is provided in the corresponding header)
+bool unpackToFenLines(std::string_view data, std::ostream& out) {
+  Reader reader = Reader(data);
+  if (!reader.isValid()) return false;
+  PackedPosition position = PackedPosition();
+  Print::FenBuffer buffer;
+  while (reader.next(position)) {
+    if (!position.isValid()) return false;
+    const Board board = position.toBoard();
+    out << Print::write_fen(buffer, board.grid, board.extra, position.player(), position.turn, position.half_moves);
+    if (position.result != PackedPosition::unknown_result) out << " c9 \"" << position.resultAsString() << "\";";
+    out << '\n';
+  }
+  return true;
+}
+
+// (function documentation is provided in the corresponding header)
+void evaluatePositions(const PackedPosition* positions, uint64_t amount, int* scores, PawnHashTable& pawn_table) {
+  // unpacked in small chunks, which stay in the cache until they are evaluated
+  constexpr uint64_t chunk_size = 64;
+  Board boards[chunk_size];
+  Team::Team players[chunk_size];
+  for (uint64_t start = 0; start < amount; start += chunk_size) {
+    const uint64_t chunk = std::min(chunk_size, amount - start);
+    for (uint64_t i = 0; i < chunk; ++i) {
+      boards[i] = positions[start + i].toBoard();
+      players[i] = positions[start + i].player();
+    }
+    evaluateBoards(boards, players, chunk, scores + start, pawn_table);
+  }
+}
+}  // namespace Packed
@@ -0,0 +1,308 @@
+//
+// Created by timap on 18.10.2026.
+//
+
+#pragma once
+
+#include <cstdint>
+#include <istream>
+#include <ostream>
+#include <string_view>
+#include <type_traits>
+#include <vector>
+
+#include "../../Board/Board.h"
+#include "../../Bot/Evaluation/PawnHashTable.h"
+
+/**
+ * @brief a position (board, castling, en passant, player and both move counters) in 32 bytes
+ *
+ * @note layout: \n
+ * - occupancy: bit i is set if square i (0 = a8, 63 = h1) has a piece \n
+ * - pieces: a 4 bit code per piece in the order of the set bits of occupancy, the lower nibble first
+ * (bit 3 is set for Team::WHITE, bits 0-2 are the PieceType) \n
+ * - flags: the castling flags of Board_Extra in bits 0-3, bit 4 is set if Team::WHITE is to move \n
+ * - en_passant: the en passant position, or no_en_passant \n
+ * - half_moves and turn: the move counters of the FEN \n
+ * - result: the result of the game the position is from (if known, e.g. for tuning the evaluation) \n
+ * \n
+ * The struct is trivially copyable and written to files as is (in the byte order of the machine, i.e. little endian
+ * on all common platforms), so a file of packed positions can be loaded with a single memcpy.
+ */
+struct PackedPosition {
+  /**
+   * @brief the value of en_passant if there is no en passant position
+   */
+  static constexpr uint8_t no_en_passant = 0xFF;
+  /**
+   * @brief the bit of flags that is set if Team::WHITE is to move
+   */
+  static constexpr uint8_t white_to_move_flag = 0b1'0000;
+  /**
+   * @brief the values of result
+   */
+  static constexpr uint8_t unknown_result = 0;
+  static constexpr uint8_t black_won = 1;
+  static constexpr uint8_t draw = 2;
+  static constexpr uint8_t white_won = 3;
+
+  /**
+   * @brief the squares with a piece on them
+   */
+  uint64_t occupancy = 0;
+  /**
+   * @brief the 4 bit codes of up to 32 pieces
+   */
+  uint8_t pieces[16] = {};
+  /**
+   * @brief the castling flags and the player to move
+   */
+  uint8_t flags = 0;
+  /**
+   * @brief the en passant position or no_en_passant
+   */
+  uint8_t en_passant = no_en_passant;
+  /**
+   * @brief the number of half moves since the last pawn move or capture
+   */
+  uint16_t half_moves = 0;
+  /**
+   * @brief the number of the full moves in the game
+   */
+  uint16_t turn = 1;
+  /**
+   * @brief the result of the game (unknown_result, black_won, draw or white_won)
+   */
+  uint8_t result = unknown_result;
+  /**
+   * @brief always 0, keeps the size at 32 bytes
+   */
+  uint8_t reserved = 0;
+
+  /**
+   * @brief packs a position
+   *
+   * @param board the board to pack
+   * @param player the player to move
+   * @param turn the number of the full moves (clamped to 0..65535)
+   * @param half_moves the number of half moves since the last pawn move or capture (clamped to 0..65535)
+   * @return the packed position
+   */
+  static PackedPosition pack(const Board& board, Team::Team player, int turn, int half_moves) noexcept;
+
+  /**
+   * @brief packs a parsed FEN
+   * @param fen a valid FEN as returned by Fen::buildFenFromStr() or Fen::parseFenFromStr()
+   * @return the packed position
+   */
+  static PackedPosition pack(const Fen& fen) noexcept;
+
+  /**
+   * @brief checks whether the packed data can be unpacked (e.g. after reading it from a file)
+   * @return true if there are at most 32 pieces with valid codes, at most 16 pieces and 8 pawns per team, exactly one
+   * king per team, no pawn on the first or last row, no unused flag bits, a valid en passant position and a valid
+   * result
+   * @note does not check whether the position is legal, just that it can not break the Board
+   */
+  [[nodiscard]] bool isValid() const noexcept;
+
+  /**
+   * @return the packed board (the packed position has to be valid)
+   */
+  [[nodiscard]] Board toBoard() const noexcept;
+
+  /**
+   * @return the player to move
+   */
+  [[nodiscard]] constexpr Team::Team player() const noexcept {
+    return (flags & white_to_move_flag) ? Team::WHITE : Team::BLACK;
+  }
+
+  /**
+   * @return the result of the game from the view of white (1 for a win, 0.5 for a draw, 0 for a loss), or a negative
+   * value if the result is unknown
+   */
+  [[nodiscard]] constexpr double whiteScore() const noexcept {
+    return result == unknown_result ? -1 : (result - 1) / 2.0;
+  }
+
+  /**
+   * @brief parses the result of a game
+   * @param result_str "1-0", "0-1" or "1/2-1/2" (as in PGN tags or the c9 operation of EPD lines)
+   * @return the value for result (unknown_result for any other string)
+   */
+  static uint8_t parseResult(std::string_view result_str) noexcept;
+
+  /**
+   * @return the result as "1-0", "0-1" or "1/2-1/2", or an empty string if it is unknown
+   */
+  [[nodiscard]] std::string_view resultAsString() const noexcept;
+
+  /**
+   * @brief unpacks the position as a FEN
+   *
+   * @param buffer the buffer the FEN gets written into
+   * @return the FEN, its board is a view into the buffer (the packed position has to be valid)
+   */
+  [[nodiscard]] Fen toFen(Print::FenBuffer& buffer) const noexcept;
+
+  /**
+   * @param other another packed position
+   * @return true if both describe the same position with the same move counters
+   */
+  bool operator==(const PackedPosition& other) const noexcept;
+};
+
+static_assert(sizeof(PackedPosition) == 32, "PackedPosition is written to files as is");
+static_assert(std::is_trivially_copyable_v<PackedPosition>, "PackedPosition is written to files as is");
+
+/**
+ * @brief Files of packed positions: an 8 byte header (magic and record size) followed by the PackedPosition records.
+ */
+namespace Packed {
+/**
+ * @brief the first 4 bytes of a file of packed positions
+ */
+constexpr std::string_view file_magic = "CPOS";
+/**
+ * @brief the size of the header in bytes
+ */
+constexpr uint64_t header_size = 8;
+
+/**
+ * @brief writes packed positions to a stream (the header is written by the constructor)
+ */
+class Writer {
+ private:
+  /**
+   * @brief the stream the positions get written to
+   */
+  std::ostream& out;
+  /**
+   * @brief the positions that were not yet written to the stream
+   */
+  std::vector<PackedPosition> pending;
+  /**
+   * @brief the amount of written positions
+   */
+  uint64_t amount = 0;
+
+ public:
+  /**
+   * @brief the amount of positions that are collected before they are written at once
+   */
+  static constexpr uint64_t positions_per_write = 4096;
+
+  /**
+   * @param out a binary stream (e.g. an std::ofstream opened with std::ios::binary)
+   */
+  explicit Writer(std::ostream& out);
+  /**
+   * @brief writes the remaining positions
+   */
+  ~Writer();
+
+  Writer(const Writer&) = delete;
+  Writer& operator=(const Writer&) = delete;
+
+  /**
+   * @brief adds a position to the stream
+   * @param position the position to write
+   */
+  void write(const PackedPosition& position);
+
+  /**
+   * @brief writes all collected positions to the stream
+   */
+  void flush();
+
+  /**
+   * @return the amount of positions written so far
+   */
+  [[nodiscard]] uint64_t size() const noexcept { return amount; }
+};
+
+/**
+ * @brief reads packed positions from the data of a file (e.g. MappedFile::data())
+ */
+class Reader {
+ private:
+  /**
+   * @brief the not yet read records
+   */
+  std::string_view rest;
+  /**
+   * @brief whether the header is valid
+   */
+  bool is_valid = false;
+
+ public:
+  /**
+   * @param data the content of a file written by Writer, has to outlive the reader
+   * @note check isValid() afterwards
+   */
+  explicit Reader(std::string_view data) noexcept;
+
+  /**
+   * @return true if the data starts with a valid header and only contains whole records
+   */
+  [[nodiscard]] bool isValid() const noexcept { return is_valid; }
+
+  /**
+   * @return the amount of records that are not yet read
+   */
+  [[nodiscard]] uint64_t remaining() const noexcept { return is_valid ? rest.size() / sizeof(PackedPosition) : 0; }
+
+  /**
+   * @brief reads the next record
+   * @param position overwritten with the next record (check PackedPosition::isValid() before unpacking it)
+   * @return false if there are no more records
+   */
+  bool next(PackedPosition& position) noexcept;
+
+  /**
+   * @brief reads all remaining records at once
+   * @param positions the records get appended to it
+   */
+  void readAll(std::vector<PackedPosition>& positions);
+};
+
+/**
+ * @brief packs the position of a FEN or EPD line
+ *
+ * @param line the line, everything after the first ';' is ignored \n
+ * the result of a c9 operation before it is stored as well (e.g. `[FEN] c9 "1-0";`)
+ * @param packed set to the packed position
+ * @return false if the line does not contain a valid position
+ */
+bool packLine(std::string_view line, PackedPosition& packed);
+
+/**
+ * @brief converts FEN or EPD lines into a file of packed positions
+ *
+ * @param in the lines (see packLine(), empty lines and comments are skipped)
+ * @param out the binary stream to write the packed positions to
+ * @param log gets a line for every position that can not be parsed
+ * @return the amount of packed positions
+ */
+uint64_t packFenLines(std::istream& in, std::ostream& out, std::ostream& log);
+
+/**
+ * @brief writes the positions of a file of packed positions as FEN lines
+ *
+ * @param data the content of the file
+ * @param out gets one FEN per line, followed by `c9 "[result]";` if the result is known
+ * @return false if the file or one of its records is invalid
+ */
+bool unpackToFenLines(std::string_view data, std::ostream& out);
+
+/**
+ * @brief evaluates many packed positions at once (see evaluateBoards())
+ *
+ * @param positions the valid packed positions
+ * @param amount the amount of positions
+ * @param scores set to the score of each position, the same as evaluateBoard() gives
+ * @param pawn_table the cache of the pawn structure scores
+ */
+void evaluatePositions(const PackedPosition* positions, uint64_t amount, int* scores, PawnHashTable& pawn_table);
+}  // namespace Packed
@@ -0,0 +1,109 @@
+//
+// Created by timap on 18.10.2026.
+//
+#include "EpdParsing.h"
+
+/**
+ * @param ch a character of an EPD line
+ * @return true if the character separates fields
+ */
+static constexpr bool isSpace(char ch) { return ch == ' ' || ch == '\t' || ch == '\r' || ch == '\n'; }
+
+/**
+ * @param str a string
+ * @return the string without whitespace at the beginning and the end
+ */
+static std::string_view trim(std::string_view str) {
+  while (!str.empty() && isSpace(str.front())) str.remove_prefix(1);
+  while (!str.empty() && isSpace(str.back())) str.remove_suffix(1);
+  return str;
+}
+
+/**
+ * @brief removes and returns the first field of the given string
+ * @param rest the string to take the field from, afterwards starts directly after the field
+ * @return the first field, or an empty string if there are no fields left
+ */
+static std::string_view nextField(std::string_view& rest) {
+  rest = trim(rest);
+  uint64_t end = 0;
+  while (end < rest.size() && !isSpace(rest[end])) end++;
+  const std::string_view field = rest.substr(0, end);
+  rest = rest.substr(end);
+  return field;
+}
+
+/**
+ * @param str a field of the line
+ * @return true if the field is a non-negative whole number (e.g. one of the FEN move counters)
+ */
+static bool isNumber(std::string_view str) {
+  if (str.empty()) return false;
+  for (char ch : str) {
+    if (ch < '0' || ch > '9') return false;
+  }
+  return true;
+}
+
+namespace Epd {
+
+// (function documentation is provided in the corresponding header)
+bool isSkippableLine(std::string_view line) {
+  line = trim(line);
+  return line.empty() || line.front() == '#';
+}
+
+// (function documentation is provided in the corresponding header)
+EpdRecord parseLine(std::string_view line) {
+  EpdRecord record = EpdRecord();
+  std::string_view rest = line;
+
+  for (int i = 0; i < 4; ++i) {
+    const std::string_view field = nextField(rest);
+    if (field.empty()) throw MissingDataInFen();
+    if (i > 0) record.fen.push_back(' ');
+    record.fen += field;
+  }
+
+  // a FEN line has the two move counters after the 4 fields, an EPD line its operations
+  std::string_view after_counters = rest;
+  const std::string_view half_moves = nextField(after_counters);
+  const std::string_view full_moves = nextField(after_counters);
+  const bool is_fen = isNumber(half_moves) && isNumber(full_moves);
+  if (is_fen) rest = after_counters;
+
+  // operations are separated by ';' (a quoted operand can contain ';')
+  while (!trim(rest).empty()) {
+    uint64_t end = 0;
+    bool in_quotes = false;
+    for (; end < rest.size() && (in_quotes || rest[end] != ';'); ++end) {
+      if (rest[end] == '"') in_quotes = !in_quotes;
+    }
+    std::string_view operation = rest.substr(0, end);
+    rest = end < rest.size() ? rest.substr(end + 1) : std::string_view();
+
+    const std::string_view opcode = nextField(operation);
+    if (opcode.empty()) continue;
+    std::string_view operand = trim(operation);
+    if (operand.size() >= 2 && operand.front() == '"' && operand.back() == '"') {
+      operand = operand.substr(1, operand.size() - 2);
+    }
+    record.operations.push_back({std::string(opcode), std::string(operand)});
+  }
+
+  if (is_fen) {
+    record.fen += ' ';
+    record.fen += half_moves;
+    record.fen += ' ';
+    record.fen += full_moves;
+  } else {
+    const std::string* hmvc = record.findOperand("hmvc");
+    const std::string* fmvn = record.findOperand("fmvn");
+    record.fen += ' ';
+    record.fen += (hmvc != nullptr && isNumber(*hmvc)) ? *hmvc : "0";
+    record.fen += ' ';
+    record.fen += (fmvn != nullptr && isNumber(*fmvn)) ? *fmvn : "1";
+  }
+  return record;
+}
+}  // namespace Epd
@@ -0,0 +1,76 @@
+//
+// Created by timap on 18.10.2026.
+//
+
+#pragma once
+
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "FenParsing.h"
+
+/**
+ * @brief a single operation of an EPD line, e.g. `bm Nf3` or `id "WAC.001"`
+ */
+struct EpdOperation {
+  /**
+   * @brief the name of the operation, e.g. "bm", "am" or "id"
+   */
+  std::string opcode;
+  /**
+   * @brief everything after the opcode (without surrounding whitespace and quotes), e.g. "Nf3 Qh5" or "WAC.001"
+   */
+  std::string operand;
+};
+
+/**
+ * @brief a position of an EPD (Extended Position Description) or FEN file together with its operations
+ */
+struct EpdRecord {
+  /**
+   * @brief the position as a complete FEN with all 6 fields \n
+   * (for EPD the move counters come from the "hmvc" and "fmvn" operations, or are "0 1" without them)
+   * @note can be parsed with Fen::buildFenFromStr(), which checks whether the position is legal
+   */
+  std::string fen;
+  /**
+   * @brief all operations in the order they were given
+   */
+  std::vector<EpdOperation> operations;
+
+  /**
+   * @param opcode the name of the operation
+   * @return the operand of the first operation with the given name, or nullptr if there is none
+   */
+  [[nodiscard]] const std::string* findOperand(std::string_view opcode) const {
+    for (const EpdOperation& operation : operations) {
+      if (operation.opcode == opcode) return &operation.operand;
+    }
+    return nullptr;
+  }
+};
+
+/**
+ * @brief Parsing of EPD lines, which are also used for plain FEN lists (a FEN is an EPD line with move counters).
+ */
+namespace Epd {
+/**
+ * @brief checks whether a line contains no position (i.e. it is empty or a comment starting with '#')
+ * @param line a line of an EPD or FEN file
+ * @return true if the line should be skipped
+ */
+bool isSkippableLine(std::string_view line);
+
+/**
+ * @brief splits an EPD or FEN line into its position and its operations
+ *
+ * @param line an EPD line ("[board] [player] [castling] [en passant] {opcode operand;}") or a FEN line with
+ * optional operations after the 6 FEN fields
+ * @return the position and its operations
+ *
+ * @note throws MissingDataInFen if the line has less than 4 fields, the position itself is only checked by
+ * Fen::buildFenFromStr()
+ */
+EpdRecord parseLine(std::string_view line);
+}  // namespace Epd
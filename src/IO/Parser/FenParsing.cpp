@@ -13,8 +13,9 @@
  *
  * @param reader A FenStringReader object for reading the FEN string,
  * that is currently pointing at the start of the board part of the FEN.
- * @return The length of the board part of the FEN \n
+ * @param length set to the length of the board part of the FEN \n
  * (moves the reader forward past the board part of the FEN)
+ * @return FenError::NONE or the reason the board part is invalid
  *
  * @note also validates that : \n
  * - both kings exist \n
@@ -23,7 +24,7 @@
  * - each row describes exactly 8 squares \n
  * - there are exactly 7 '/' corresponding to 8 total rows \n
  */
-constexpr int processBoard(FenStringReader& reader) {
+constexpr FenError processBoard(FenStringReader& reader, int& length) noexcept {
   const int beginning_offset = reader.getCurrentOffset();
 
   int amount_kings_per_team[TEAM_AMOUNT] = {0, 0};
@@ -32,9 +33,9 @@ constexpr int processBoard(FenStringReader& reader) {
   int piecesPerRow = 0;
 
   for (; reader.hasCharsLeft(); ++reader) {
-    if (reader.currentCharIsWhiteSpace()) break;
+    char ch = reader.peek();
+    if (ch == ' ' || ch == '\t') break;
 
-    char ch = reader.get();
     switch (ch) {
       case 'k':
         amount_kings_per_team[Team::BLACK]++;
@@ -65,25 +66,26 @@ constexpr int processBoard(FenStringReader& reader) {
         break;
       case '/':
         amountSlashesInFenString++;
-        if (piecesPerRow != 8) throw IllegalAmountPiecesOnARow();
+        if (piecesPerRow != 8) return FenError::ILLEGAL_AMOUNT_PIECES_ON_A_ROW;
         piecesPerRow = 0;
         ch = '0';
         break;
       default:
-        if (ch < '1' || ch > '8') throw IllegalCharacterInFenBoard();
+        if (ch < '1' || ch > '8') return FenError::ILLEGAL_CHARACTER_IN_BOARD;
         break;
     }
     piecesPerRow += charToInt(ch);
   }
-  if (piecesPerRow != 8) throw IllegalAmountPiecesOnARow();
-  if (amountSlashesInFenString != 7) throw IllegalAmountOfRowsInBoard();
+  if (piecesPerRow != 8) return FenError::ILLEGAL_AMOUNT_PIECES_ON_A_ROW;
+  if (amountSlashesInFenString != 7) return FenError::ILLEGAL_AMOUNT_OF_ROWS_IN_BOARD;
   if (amount_of_pieces_per_team[Team::BLACK] > PIECES_PER_TEAM ||
       amount_of_pieces_per_team[Team::WHITE] > PIECES_PER_TEAM)
-    throw IllegalAmountOfPiecesInTeam();
+    return FenError::ILLEGAL_AMOUNT_OF_PIECES_IN_TEAM;
   if (amount_kings_per_team[Team::WHITE] != 1 || amount_kings_per_team[Team::BLACK] != 1)
-    throw IllegalAmountOfKingsInTeam();
+    return FenError::ILLEGAL_AMOUNT_OF_KINGS_IN_TEAM;
 
-  return reader.getCurrentOffset() - beginning_offset;
+  length = reader.getCurrentOffset() - beginning_offset;
+  return FenError::NONE;
 }
 
 /**
@@ -91,8 +93,9 @@ constexpr int processBoard(FenStringReader& reader) {
  *
  * @param reader A FenStringReader object reading the FEN string,
  * that is currently pointing at the start of the current player part of the FEN.
- * @return The current player that is allowed to execute the next move \n
+ * @param player set to the current player that is allowed to execute the next move \n
  * (moves the reader forward past the board part of the FEN)
+ * @return FenError::NONE or the reason the current player part is invalid
  *
  * @note
  * accepts both uppercase and lowercase chars for the current player
@@ -100,20 +103,22 @@ constexpr int processBoard(FenStringReader& reader) {
  * also validates that : \n
  * - an actual current Player exists \n
  */
-constexpr Team::Team processCurrentPlayer(FenStringReader& reader) {
+constexpr FenError processCurrentPlayer(FenStringReader& reader, Team::Team& player) noexcept {
   // safety measure to not access out of bounds
-  if (!reader.hasCharsLeft()) throw MissingCurrentPlayerDataInFen();
+  if (!reader.hasCharsLeft()) return FenError::MISSING_CURRENT_PLAYER_DATA;
   // basically preincrement the reader to not need to increment it in all cases if the switch case
   ++reader;
-  switch (reader[-1]) {
+  switch (reader.peek(-1)) {
     case 'w':
     case 'W':
-      return Team::WHITE;
+      player = Team::WHITE;
+      return FenError::NONE;
     case 'B':
     case 'b':
-      return Team::BLACK;
+      player = Team::BLACK;
+      return FenError::NONE;
     default:
-      throw MissingCurrentPlayerDataInFen();
+      return FenError::MISSING_CURRENT_PLAYER_DATA;
   }
 }
 
@@ -122,18 +127,19 @@ constexpr Team::Team processCurrentPlayer(FenStringReader& reader) {
  *
  * @param reader A FenStringReader object reading the FEN string,
  * that is currently pointing at the start of the castling part of the FEN.
- * @return The castling flags in a uint8_t as needed by Board_Extra \n
+ * @param castling set to the castling flags in a uint8_t as needed by Board_Extra \n
  * (moves the reader forward past the board part of the FEN)
+ * @return FenError::NONE or the reason the castling part is invalid
  *
  * @note also validates that : \n
  * - Castling rights have actually been specified \n
  */
-constexpr uint8_t processCastling(FenStringReader& reader) {
+constexpr FenError processCastling(FenStringReader& reader, uint8_t& castling) noexcept {
   uint8_t res = 0;
   for (; reader.hasCharsLeft(); ++reader) {
     if (reader.currentCharIsWhiteSpace()) break;
 
-    switch (reader.get()) {
+    switch (reader.peek()) {
       case 'Q':
         res |= 0b10 << (Team::WHITE << 1);
         break;
@@ -149,14 +155,16 @@ constexpr uint8_t processCastling(FenStringReader& reader) {
       case '-':
         // the reader needs to move 1 forward to no longer be on castling data after processing castling
         ++reader;
-        return 0b0000;
+        castling = 0b0000;
+        return FenError::NONE;
       default:
-        throw IllegalCastlingRightsInFen();
+        return FenError::ILLEGAL_CASTLING_RIGHTS;
     }
   }
-  if (res == 0) throw MissingCastlingRightsInFen();
+  if (res == 0) return FenError::MISSING_CASTLING_RIGHTS;
 
-  return res;
+  castling = res;
+  return FenError::NONE;
 }
 
 /**
@@ -164,33 +172,36 @@ constexpr uint8_t processCastling(FenStringReader& reader) {
  *
  * @param reader A FenStringReader object reading the FEN string,
  * that is currently pointing at the start of the en passant part of the FEN.
- * @return the en Passant Position as an optional \n
+ * @param en_passant set to the en Passant Position as an optional \n
  * (moves the reader forward past the board part of the FEN)
+ * @return FenError::NONE or the reason the en passant part is invalid
  *
  * @note also validates that : \n
  * - en Passant has actually been specified \n
  * - the row for en passant is correct \n
  */
-constexpr ChessPos processEnPassant(FenStringReader& reader) {
-  if (!reader.hasCharsLeft()) throw MissingEnPassantDataInFen();
+constexpr FenError processEnPassant(FenStringReader& reader, ChessPos& en_passant) noexcept {
+  if (!reader.hasCharsLeft()) return FenError::MISSING_EN_PASSANT_DATA;
 
-  if (reader.get() == '-') {
+  if (reader.peek() == '-') {
     ++reader;
-    return ChessPos::nullopt();
+    en_passant = ChessPos::nullopt();
+    return FenError::NONE;
   }
 
-  if (reader.amountCharsLeft() < 2) throw MissingEnPassantDataInFen();
+  if (reader.amountCharsLeft() < 2) return FenError::MISSING_EN_PASSANT_DATA;
 
-  ChessPos pos = getPosFromChar(reader[0], reader[1]);
+  ChessPos pos = getPosFromChar(reader.peek(0), reader.peek(1));
 
-  if (!pos.has_value()) throw MissingEnPassantDataInFen();
+  if (!pos.has_value()) return FenError::MISSING_EN_PASSANT_DATA;
 
   int row = pos.data >> 3;
   if (row != ChessConstants::black_en_passant_row && row != ChessConstants::white_en_passant_row)
-    throw IllegalEnPassantPositionInFen();
+    return FenError::ILLEGAL_EN_PASSANT_POSITION;
 
   reader += 2;
-  return pos;
+  en_passant = pos;
+  return FenError::NONE;
 }
 
 /**
@@ -203,11 +214,11 @@ constexpr ChessPos processEnPassant(FenStringReader& reader) {
  * otherwise an empty optional \n
  * (moves the reader forward past the board current of the FEN)
  */
-constexpr inline NaturalNumber fenStrToInt(FenStringReader& reader) {
+constexpr inline NaturalNumber fenStrToInt(FenStringReader& reader) noexcept {
   bool is_possible_number = false;
   int res = 0;
   for (; reader.hasCharsLeft(); ++reader) {
-    char ch = reader.get();
+    char ch = reader.peek();
     if (ch < '0' || ch > '9') break;
     res = res * 10 + charToInt(ch);
     is_possible_number = true;
@@ -223,7 +234,7 @@ constexpr inline NaturalNumber fenStrToInt(FenStringReader& reader) {
  * @param field The square to retrieve the piece from
  * @return The piece on the specified field, or a space character if the field is empty
  */
-constexpr char getPieceOnField(const std::string_view& board, int8_t field) {
+constexpr char getPieceOnField(const std::string_view& board, int8_t field) noexcept {
   int current_field = 0;
   uint64_t i = 0;
   for (; (i < board.size()) && (current_field < field); ++i) {
@@ -245,33 +256,37 @@ constexpr char getPieceOnField(const std::string_view& board, int8_t field) {
  *
  * @param fen A Fen object representing a Chess Board in FEN notation
  *
+ * @return FenError::NONE or FenError::ILLEGAL_CASTLING_RIGHTS
+ *
  * @note validates that : \n
  * - the kings and castles are at the correct squares for the given castling rights \n
  */
-constexpr inline void checkCastlingRights(const Fen& fen) {
+constexpr inline FenError checkCastlingRights(const Fen& fen) noexcept {
   Board_Extra extra = Board_Extra(fen.castling, fen.en_passant);
 
   // check correct castling rights for Black
   if (extra.getCastlingRights(ChessConstants::start_black_king_pos) &&
       getPieceOnField(fen.board, ChessConstants::start_black_king_pos) != 'k')
-    throw IllegalCastlingRightsInFen();
+    return FenError::ILLEGAL_CASTLING_RIGHTS;
   if (extra.getCastlingRights(ChessConstants::start_black_queen_side_castle_pos) &&
       getPieceOnField(fen.board, ChessConstants::start_black_queen_side_castle_pos) != 'r')
-    throw IllegalCastlingRightsInFen();
+    return FenError::ILLEGAL_CASTLING_RIGHTS;
   if (extra.getCastlingRights(ChessConstants::start_black_king_side_castle_pos) &&
       getPieceOnField(fen.board, ChessConstants::start_black_king_side_castle_pos) != 'r')
-    throw IllegalCastlingRightsInFen();
+    return FenError::ILLEGAL_CASTLING_RIGHTS;
 
   // check correct castling rights for Black
   if (extra.getCastlingRights(ChessConstants::start_white_king_pos) &&
       getPieceOnField(fen.board, ChessConstants::start_white_king_pos) != 'K')
-    throw IllegalCastlingRightsInFen();
+    return FenError::ILLEGAL_CASTLING_RIGHTS;
   if (extra.getCastlingRights(ChessConstants::start_white_queen_side_castle_pos) &&
       getPieceOnField(fen.board, ChessConstants::start_white_queen_side_castle_pos) != 'R')
-    throw IllegalCastlingRightsInFen();
+    return FenError::ILLEGAL_CASTLING_RIGHTS;
   if (extra.getCastlingRights(ChessConstants::start_white_king_side_castle_pos) &&
       getPieceOnField(fen.board, ChessConstants::start_white_king_side_castle_pos) != 'R')
-    throw IllegalCastlingRightsInFen();
+    return FenError::ILLEGAL_CASTLING_RIGHTS;
+
+  return FenError::NONE;
 }
 
 /**
@@ -279,55 +294,77 @@ constexpr inline void checkCastlingRights(const Fen& fen) {
  *
  * @param fen A Fen object representing a Chess Board in FEN notation
  *
+ * @return FenError::NONE or FenError::ILLEGAL_EN_PASSANT_POSITION
+ *
  * @note validates that : \n
  * - there is actually a pawn at the correct square for being capture by the given en passant \n
  * - that pawn on that square is the correct team \n
  */
-constexpr inline void checkCorrectEnPassant(const Fen& fen) {
+constexpr inline FenError checkCorrectEnPassant(const Fen& fen) noexcept {
   Board_Extra extra = Board_Extra(fen.castling, fen.en_passant);
 
   ChessPos passantable_piece_pos = extra.getPosOfPassantablePiece();
 
-  if (!passantable_piece_pos.has_value()) throw IllegalEnPassantPositionInFen();
+  if (!passantable_piece_pos.has_value()) return FenError::ILLEGAL_EN_PASSANT_POSITION;
 
   char passantable_piece = getPieceOnField(fen.board, passantable_piece_pos.data);
 
   int row = fen.en_passant.data >> 3;
 
-  if (row == ChessConstants::black_en_passant_row && passantable_piece != 'p') throw IllegalEnPassantPositionInFen();
-  if (row == ChessConstants::white_en_passant_row && passantable_piece != 'P') throw IllegalEnPassantPositionInFen();
+  if (row == ChessConstants::black_en_passant_row && passantable_piece != 'p')
+    return FenError::ILLEGAL_EN_PASSANT_POSITION;
+  if (row == ChessConstants::white_en_passant_row && passantable_piece != 'P')
+    return FenError::ILLEGAL_EN_PASSANT_POSITION;
+
+  return FenError::NONE;
 }
 
 // (function documentation is provided in the corresponding header)
-Fen Fen::buildFenFromStr(std::string_view str) {
+FenError Fen::parseFenFromStr(std::string_view str, Fen& result) noexcept {
   FenStringReader reader = FenStringReader(str);
-  Fen result = Fen();
+  result = Fen();
+  FenError error = FenError::NONE;
 
-  reader.skipWhiteSpaceAndExpectFurtherData();
-  int beginning = reader.getCurrentOffset();
-  result.board = str.substr(beginning, processBoard(reader));
+  if (!reader.skipWhiteSpaceAndCheckFurtherData()) return FenError::MISSING_DATA;
+  const int beginning = reader.getCurrentOffset();
+  int board_length = 0;
+  error = processBoard(reader, board_length);
+  if (error != FenError::NONE) return error;
+  result.board = str.substr(beginning, board_length);
 
-  reader.skipWhiteSpaceAndExpectFurtherData();
-  result.current_player = processCurrentPlayer(reader);
+  if (!reader.skipWhiteSpaceAndCheckFurtherData()) return FenError::MISSING_DATA;
+  error = processCurrentPlayer(reader, result.current_player);
+  if (error != FenError::NONE) return error;
 
-  reader.skipWhiteSpaceAndExpectFurtherData();
-  result.castling = processCastling(reader);
+  if (!reader.skipWhiteSpaceAndCheckFurtherData()) return FenError::MISSING_DATA;
+  error = processCastling(reader, result.castling);
+  if (error != FenError::NONE) return error;
 
-  reader.skipWhiteSpaceAndExpectFurtherData();
-  result.en_passant = processEnPassant(reader);
+  if (!reader.skipWhiteSpaceAndCheckFurtherData()) return FenError::MISSING_DATA;
+  error = processEnPassant(reader, result.en_passant);
+  if (error != FenError::NONE) return error;
 
-  reader.skipWhiteSpaceAndExpectFurtherData();
+  if (!reader.skipWhiteSpaceAndCheckFurtherData()) return FenError::MISSING_DATA;
   NaturalNumber current_half_turns = fenStrToInt(reader);
-  if (!current_half_turns.has_value()) throw MissingHalfTurnDataInFen();
+  if (!current_half_turns.has_value()) return FenError::MISSING_HALF_TURN_DATA;
   result.amount_half_moves = current_half_turns.data;
 
-  reader.skipWhiteSpaceAndExpectFurtherData();
+  if (!reader.skipWhiteSpaceAndCheckFurtherData()) return FenError::MISSING_DATA;
   NaturalNumber current_turn = fenStrToInt(reader);
-  if (!current_turn.has_value()) throw MissingTurnDataInFen();
+  if (!current_turn.has_value()) return FenError::MISSING_TURN_DATA;
   result.current_turn = current_turn.data;
 
-  if (result.en_passant.has_value()) checkCorrectEnPassant(result);
-  checkCastlingRights(result);
+  if (result.en_passant.has_value()) {
+    error = checkCorrectEnPassant(result);
+    if (error != FenError::NONE) return error;
+  }
+  return checkCastlingRights(result);
+}
 
+// (function documentation is provided in the corresponding header)
+Fen Fen::buildFenFromStr(std::string_view str) {
+  Fen result = Fen();
+  const FenError error = parseFenFromStr(str, result);
+  if (error != FenError::NONE) throwFenError(error);
   return result;
 }
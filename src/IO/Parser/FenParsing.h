@@ -113,6 +113,17 @@ class FenStringReader {
     this->skipWhiteSpace();
     if (!this->hasCharsLeft()) throw MissingDataInFen();
   }
+  /**
+   * @brief skips forward in the FEN until a non whitespace character is found (i.e. skipping all current whitespaces).
+   * @return false if the FEN ends before a non whitespace character is found (the non throwing version of
+   * skipWhiteSpaceAndExpectFurtherData())
+   */
+  [[nodiscard]] constexpr bool skipWhiteSpaceAndCheckFurtherData() noexcept {
+    for (; this->hasCharsLeft(); ++(*this)) {
+      if (str[offset] != ' ' && str[offset] != '\t') return true;
+    }
+    return false;
+  }
 
   // access
   /**
@@ -133,6 +144,17 @@ class FenStringReader {
     return str[offset];
   }
 
+  /**
+   * @brief access to the underlying FEN relative to the current char without exceptions
+   * @param i The index of the char to return relativ to the current char that can be get with get()
+   * @return The character at the specified position in the FEN string relativ to the current offset,
+   * or '\0' if the position is outside of the FEN (which is not a valid char in any part of a FEN)
+   */
+  [[nodiscard]] constexpr inline char peek(int i = 0) const noexcept {
+    const int pos = offset + i;
+    return (pos >= size || pos < 0) ? '\0' : str[pos];
+  }
+
   /**
    * @brief direct access to the underlying FEN with the index being offset by the private offset variable
    * @param i The index of the char to return relativ to the current char that can be get with get()
@@ -195,4 +217,16 @@ struct Fen {
    * @return A Fen object representing the string in FEN notation
    */
   static Fen buildFenFromStr(std::string_view str);
+
+  /**
+   * @brief Static method for building the corresponding Fen object from a string in FEN notation without exceptions.
+   *
+   * @param str The FEN string to parse
+   * @param result set to the Fen object representing the string in FEN notation (only valid if NONE is returned)
+   * @return FenError::NONE, or the reason the string is not a valid FEN
+   *
+   * @note does the same checks as buildFenFromStr(), which throws the exception corresponding to the returned error
+   * instead. Meant for validating many FENs where a lot of them can be invalid, as throwing is a lot slower
+   */
+  static FenError parseFenFromStr(std::string_view str, Fen& result) noexcept;
 };
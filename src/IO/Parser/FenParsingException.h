@@ -3,6 +3,7 @@
 //
 
 #pragma once
+#include <cstdint>
 #include <exception>
 
 /**
@@ -170,3 +171,64 @@ class MissingCurrentPlayerDataInFen : public FenParsingException {
     return "Current Player Color is missing in the Fen \nPlease Try a different Fen";
   }
 };
+
+/**
+ * @brief the reason a FEN could not be parsed, as returned by Fen::parseFenFromStr() \n
+ * (every error except NONE corresponds to one of the exceptions thrown by Fen::buildFenFromStr())
+ */
+enum class FenError : uint8_t {
+  NONE = 0,
+  MISSING_DATA,
+  INTERNAL_OUT_OF_BOUNDS,
+  ILLEGAL_CHARACTER_IN_BOARD,
+  ILLEGAL_AMOUNT_PIECES_ON_A_ROW,
+  ILLEGAL_AMOUNT_OF_ROWS_IN_BOARD,
+  ILLEGAL_AMOUNT_OF_PIECES_IN_TEAM,
+  ILLEGAL_AMOUNT_OF_KINGS_IN_TEAM,
+  ILLEGAL_CASTLING_RIGHTS,
+  MISSING_CASTLING_RIGHTS,
+  ILLEGAL_EN_PASSANT_POSITION,
+  MISSING_EN_PASSANT_DATA,
+  MISSING_TURN_DATA,
+  MISSING_HALF_TURN_DATA,
+  MISSING_CURRENT_PLAYER_DATA,
+};
+
+/**
+ * @brief throws the exception corresponding to the given error
+ * @param error the error of a FEN, must not be FenError::NONE
+ */
+[[noreturn]] inline void throwFenError(FenError error) {
+  switch (error) {
+    case FenError::MISSING_DATA:
+      throw MissingDataInFen();
+    case FenError::INTERNAL_OUT_OF_BOUNDS:
+      throw InternalOutOfBoundsErrorFen();
+    case FenError::ILLEGAL_CHARACTER_IN_BOARD:
+      throw IllegalCharacterInFenBoard();
+    case FenError::ILLEGAL_AMOUNT_PIECES_ON_A_ROW:
+      throw IllegalAmountPiecesOnARow();
+    case FenError::ILLEGAL_AMOUNT_OF_ROWS_IN_BOARD:
+      throw IllegalAmountOfRowsInBoard();
+    case FenError::ILLEGAL_AMOUNT_OF_PIECES_IN_TEAM:
+      throw IllegalAmountOfPiecesInTeam();
+    case FenError::ILLEGAL_AMOUNT_OF_KINGS_IN_TEAM:
+      throw IllegalAmountOfKingsInTeam();
+    case FenError::ILLEGAL_CASTLING_RIGHTS:
+      throw IllegalCastlingRightsInFen();
+    case FenError::MISSING_CASTLING_RIGHTS:
+      throw MissingCastlingRightsInFen();
+    case FenError::ILLEGAL_EN_PASSANT_POSITION:
+      throw IllegalEnPassantPositionInFen();
+    case FenError::MISSING_EN_PASSANT_DATA:
+      throw MissingEnPassantDataInFen();
+    case FenError::MISSING_TURN_DATA:
+      throw MissingTurnDataInFen();
+    case FenError::MISSING_HALF_TURN_DATA:
+      throw MissingHalfTurnDataInFen();
+    case FenError::MISSING_CURRENT_PLAYER_DATA:
+      throw MissingCurrentPlayerDataInFen();
+    default:
+      throw FenParsingException();
+  }
+}
@@ -0,0 +1,59 @@
+//
+// Created by timap on 18.10.2026.
+//
+#include "MappedFile.h"
+
+#if defined(__unix__) || defined(__APPLE__)
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#define HAS_MMAP
+#else
+#include <fstream>
+#include <sstream>
+#endif
+
+// (function documentation is provided in the corresponding header)
+MappedFile::MappedFile(const std::string& path, [[maybe_unused]] Access::Access access) {
+#ifdef HAS_MMAP
+  const int fd = open(path.c_str(), O_RDONLY);
+  if (fd < 0) return;
+  struct stat file_stat = {};
+  if (fstat(fd, &file_stat) != 0) {
+    close(fd);
+    return;
+  }
+  size = static_cast<uint64_t>(file_stat.st_size);
+  if (size > 0) {
+    void* mapped = mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fd, 0);
+    if (mapped == MAP_FAILED) {
+      size = 0;
+      close(fd);
+      return;
+    }
+    // read ahead for a single pass, but not for lookups that would only push their pages out again
+    madvise(mapped, size, access == Access::SEQUENTIAL ? MADV_SEQUENTIAL : MADV_RANDOM);
+    begin = static_cast<const char*>(mapped);
+  }
+  // the mapping stays valid after the file is closed
+  close(fd);
+  is_open = true;
+#else
+  std::ifstream file(path, std::ios::binary);
+  if (!file) return;
+  std::ostringstream content;
+  content << file.rdbuf();
+  buffer = content.str();
+  begin = buffer.data();
+  size = buffer.size();
+  is_open = true;
+#endif
+}
+
+// (function documentation is provided in the corresponding header)
+MappedFile::~MappedFile() {
+#ifdef HAS_MMAP
+  if (begin != nullptr) munmap(const_cast<char*>(begin), size);
+#endif
+}
@@ -0,0 +1,83 @@
+//
+// Created by timap on 18.10.2026.
+//
+
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <string_view>
+
+/**
+ * @brief the namespace holding the Access enum in order to not pollute the main namespace
+ */
+namespace Access {
+/**
+ * @brief how the content of a mapped file is going to be read, so that the OS can read the pages ahead (or not)
+ */
+enum Access : uint8_t {
+  /**
+   * @brief front to back in a single pass (e.g. PGN or packed position files): the OS reads ahead and drops the pages
+   * behind
+   */
+  SEQUENTIAL,
+  /**
+   * @brief single bytes all over the file (e.g. tablebase lookups during the search): only the accessed pages are read
+   * and they stay in memory
+   */
+  RANDOM
+};
+}  // namespace Access
+
+/**
+ * @brief A read only view of a whole file, memory mapped where possible.
+ *
+ * @note the pages of a mapped file are only read by the OS when they are accessed and can be dropped again
+ * afterwards, so even files larger than the memory can be read in a single pass. Without mmap (i.e. on non POSIX
+ * systems) the file gets read into memory instead
+ */
+class MappedFile {
+ private:
+  /**
+   * @brief the start of the file content (nullptr for an empty or missing file)
+   */
+  const char* begin = nullptr;
+  /**
+   * @brief the size of the file in bytes
+   */
+  uint64_t size = 0;
+  /**
+   * @brief whether the file could be opened
+   */
+  bool is_open = false;
+  /**
+   * @brief the file content if the file could not be mapped
+   */
+  std::string buffer;
+
+ public:
+  /**
+   * @brief maps the given file
+   * @param path the path of the file
+   * @param access how the content is going to be read (only a hint for the OS)
+   * @note check isOpen() afterwards
+   */
+  explicit MappedFile(const std::string& path, Access::Access access = Access::SEQUENTIAL);
+  /**
+   * @brief unmaps the file
+   */
+  ~MappedFile();
+
+  MappedFile(const MappedFile&) = delete;
+  MappedFile& operator=(const MappedFile&) = delete;
+
+  /**
+   * @return true if the file could be opened and mapped (or read)
+   */
+  [[nodiscard]] bool isOpen() const noexcept { return is_open; }
+
+  /**
+   * @return the whole content of the file (valid as long as this object lives)
+   */
+  [[nodiscard]] std::string_view data() const noexcept { return {begin, size}; }
+};
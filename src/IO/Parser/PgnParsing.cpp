@@ -0,0 +1,176 @@
+//
+// Created by timap on 18.10.2026.
+//
+#include "PgnParsing.h"
+
+#include <algorithm>
+#include <chrono>
+#include <iomanip>
+
+/**
+ * @param ch a character of the PGN data
+ * @return true if the character separates tokens
+ */
+static constexpr bool isSpace(char ch) { return ch == ' ' || ch == '\t' || ch == '\r' || ch == '\n'; }
+
+/**
+ * @param ch a character of the movetext
+ * @return true if the character ends a move token
+ */
+static constexpr bool endsToken(char ch) {
+  return isSpace(ch) || ch == '{' || ch == '(' || ch == ')' || ch == ';' || ch == '$';
+}
+
+/**
+ * @param token a token of the movetext
+ * @return true if the token is a game termination marker
+ */
+static constexpr bool isResult(std::string_view token) {
+  return token == "1-0" || token == "0-1" || token == "1/2-1/2" || token == "*";
+}
+
+/**
+ * @brief removes everything up to the given character (including it), or everything if it is missing
+ */
+static void skipPast(std::string_view& rest, char ch) {
+  const uint64_t idx = rest.find(ch);
+  rest = idx == std::string_view::npos ? std::string_view() : rest.substr(idx + 1);
+}
+
+/**
+ * @brief removes a variation (which can contain comments and further variations)
+ * @param rest starts with the '(' of the variation
+ */
+static void skipVariation(std::string_view& rest) {
+  int depth = 0;
+  while (!rest.empty()) {
+    const char ch = rest.front();
+    rest.remove_prefix(1);
+    if (ch == '{') {
+      skipPast(rest, '}');
+    } else if (ch == '(') {
+      depth++;
+    } else if (ch == ')' && --depth == 0) {
+      return;
+    }
+  }
+}
+
+/**
+ * @brief parses a tag pair like `[Event "F/S Return Match"]`
+ * @param rest starts with the '[' of the tag, afterwards starts after its ']'
+ * @return the tag
+ */
+static PgnTag parseTag(std::string_view& rest) {
+  PgnTag tag = PgnTag();
+  rest.remove_prefix(1);
+  uint64_t idx = 0;
+  while (idx < rest.size() && isSpace(rest[idx])) idx++;
+  const uint64_t name_start = idx;
+  while (idx < rest.size() && !isSpace(rest[idx]) && rest[idx] != '"' && rest[idx] != ']') idx++;
+  tag.name = rest.substr(name_start, idx - name_start);
+
+  while (idx < rest.size() && rest[idx] != '"' && rest[idx] != ']') idx++;
+  if (idx < rest.size() && rest[idx] == '"') {
+    const uint64_t value_start = ++idx;
+    // a quote inside the value is escaped with a backslash
+    while (idx < rest.size() && rest[idx] != '"') idx += rest[idx] == '\\' ? 2 : 1;
+    idx = std::min<uint64_t>(idx, rest.size());
+    tag.value = rest.substr(value_start, idx - value_start);
+  }
+  rest = rest.substr(std::min<uint64_t>(idx, rest.size()));
+  skipPast(rest, ']');
+  return tag;
+}
+
+// (function documentation is provided in the corresponding header)
+bool PgnReader::nextGame(PgnGame& game) {
+  game.tags.clear();
+  game.moves.clear();
+  game.result = std::string_view();
+  bool has_content = false;
+  bool in_movetext = false;
+
+  while (true) {
+    while (!rest.empty() && isSpace(rest.front())) rest.remove_prefix(1);
+    if (rest.empty()) return has_content;
+
+    switch (rest.front()) {
+      case '[':
+        // the tags of the next game (its previous game had no termination marker)
+        if (in_movetext) return true;
+        game.tags.push_back(parseTag(rest));
+        has_content = true;
+        continue;
+      case '%':
+      case ';':
+        skipPast(rest, '\n');
+        continue;
+      case '{':
+        skipPast(rest, '}');
+        continue;
+      case '(':
+        skipVariation(rest);
+        continue;
+      case ')':
+        rest.remove_prefix(1);
+        continue;
+      default:
+        break;
+    }
+
+    uint64_t end = 1;
+    while (end < rest.size() && !endsToken(rest[end])) end++;
+    std::string_view token = rest.substr(0, end);
+    rest.remove_prefix(end);
+    in_movetext = true;
+    has_content = true;
+
+    // numeric annotation glyphs like $1
+    if (token.front() == '$') continue;
+    if (isResult(token)) {
+      game.result = token;
+      return true;
+    }
+    // move numbers ("12." or "12...") can be directly followed by the move, "0-0" is castling though
+    uint64_t digits = 0;
+    while (digits < token.size() && token[digits] >= '0' && token[digits] <= '9') digits++;
+    if (digits < token.size() && token[digits] == '.') {
+      token.remove_prefix(digits);
+      while (!token.empty() && token.front() == '.') token.remove_prefix(1);
+    }
+    // annotations written apart from their move, e.g. "e4 !?"
+    if (token.find_first_not_of("!?") == std::string_view::npos) continue;
+    game.moves.push_back(token);
+  }
+}
+
+namespace Pgn {
+
+// (function documentation is provided in the corresponding header)
+ReplayStats replayAll(std::string_view data, std::ostream& os) {
+  ReplayStats stats = ReplayStats();
+  const auto start = std::chrono::steady_clock::now();
+
+  PgnReader reader = PgnReader(data);
+  PgnGame game = PgnGame();
+  while (reader.nextGame(game)) {
+    stats.games++;
+    const Replay replay = replayGame(game, [](const Board&, Team::Team, Move) {});
+    stats.plies += replay.plies;
+    if (!replay.error.empty()) {
+      stats.errors++;
+      os << "game " << stats.games << ": could not play " << replay.error << " after " << replay.plies << " moves\n";
+    }
+  }
+
+  const auto elapsed = std::chrono::steady_clock::now() - start;
+  const double seconds = std::chrono::duration<double>(elapsed).count();
+  os << "games: " << stats.games << ", moves: " << stats.plies << ", games with errors: " << stats.errors << '\n';
+  os << "time: " << std::fixed << std::setprecision(3) << seconds << " s, "
+     << std::setprecision(0) << (seconds > 0 ? static_cast<double>(stats.games) / seconds : 0.0) << " games/s, "
+     << (seconds > 0 ? static_cast<double>(stats.plies) / seconds : 0.0) << " moves/s" << std::endl;
+  os.unsetf(std::ios::floatfield);
+  return stats;
+}
+}  // namespace Pgn
@@ -0,0 +1,174 @@
+//
+// Created by timap on 18.10.2026.
+//
+
+#pragma once
+
+#include <cstdint>
+#include <ostream>
+#include <string_view>
+#include <vector>
+
+#include "../../Board/Board.h"
+#include "../../Types/Move/Move.h"
+#include "FenParsing.h"
+#include "SanParsing.h"
+
+/**
+ * @brief a tag pair of a PGN game, e.g. `[White "Carlsen, Magnus"]`
+ */
+struct PgnTag {
+  /**
+   * @brief the name of the tag, e.g. "White"
+   */
+  std::string_view name;
+  /**
+   * @brief the value without the quotes (escaped characters like \" are kept as they are)
+   */
+  std::string_view value;
+};
+
+/**
+ * @brief a single game of a PGN file
+ * @note only views into the PGN data, which has to outlive the game
+ */
+struct PgnGame {
+  /**
+   * @brief all tag pairs in the order they were given
+   */
+  std::vector<PgnTag> tags;
+  /**
+   * @brief the moves of the main line in SAN (without move numbers, comments, NAGs and variations)
+   */
+  std::vector<std::string_view> moves;
+  /**
+   * @brief the game termination marker ("1-0", "0-1", "1/2-1/2" or "*"), empty if it is missing
+   */
+  std::string_view result;
+
+  /**
+   * @param name the name of the tag
+   * @return the value of the first tag with the given name, or an empty string_view if there is none
+   */
+  [[nodiscard]] std::string_view findTag(std::string_view name) const {
+    for (const PgnTag& tag : tags) {
+      if (tag.name == name) return tag.value;
+    }
+    return {};
+  }
+};
+
+/**
+ * @brief Reads the games of PGN data one after another, without copying any of it.
+ *
+ * @note the memory use only depends on the size of the largest game (the vectors of the given PgnGame are reused),
+ * so together with a MappedFile files with millions of games can be read
+ */
+class PgnReader {
+ private:
+  /**
+   * @brief the not yet read part of the PGN data
+   */
+  std::string_view rest;
+
+ public:
+  /**
+   * @param data the PGN data (e.g. MappedFile::data()), has to outlive the reader and the read games
+   */
+  explicit PgnReader(std::string_view data) noexcept : rest(data) {}
+
+  /**
+   * @brief reads the next game
+   * @param game overwritten with the next game
+   * @return false if there are no more games
+   */
+  bool nextGame(PgnGame& game);
+};
+
+namespace Pgn {
+/**
+ * @brief the state of a game after replaying its moves
+ */
+struct Replay {
+  /**
+   * @brief the board after the last replayed move
+   */
+  Board board = Board();
+  /**
+   * @brief the player to move after the last replayed move
+   */
+  Team::Team player = Team::WHITE;
+  /**
+   * @brief the amount of replayed moves
+   */
+  uint64_t plies = 0;
+  /**
+   * @brief the first move that is not legal (or the FEN tag if it is invalid), empty if the whole game was replayed
+   */
+  std::string_view error;
+};
+
+/**
+ * @brief plays the moves of a game on a Board, starting from the FEN tag or the start position
+ *
+ * @tparam OnMove void(const Board& board, Team::Team player, Move move)
+ * @param game the game to replay
+ * @param on_move called for each move with the board and player before the move
+ * @return the final position, or the position before the first illegal move
+ */
+template <class OnMove>
+Replay replayGame(const PgnGame& game, OnMove on_move) {
+  Replay replay = Replay();
+  const std::string_view fen_str = game.findTag("FEN");
+  if (!fen_str.empty()) {
+    try {
+      const Fen fen = Fen::buildFenFromStr(fen_str);
+      replay.board = Board(fen);
+      replay.player = fen.current_player;
+    } catch (const FenParsingException&) {
+      replay.error = fen_str;
+      return replay;
+    }
+  }
+
+  for (const std::string_view san : game.moves) {
+    const SlimOptional<Move> move = San::findMove(replay.board, replay.player, san);
+    if (!move.has_value()) {
+      replay.error = san;
+      return replay;
+    }
+    on_move(replay.board, replay.player, move.data);
+    replay.board.movePiece(move.data);
+    replay.player = Team::getEnemyTeam(replay.player);
+    replay.plies++;
+  }
+  return replay;
+}
+
+/**
+ * @brief the totals of replayAll()
+ */
+struct ReplayStats {
+  /**
+   * @brief the amount of games
+   */
+  uint64_t games = 0;
+  /**
+   * @brief the amount of replayed moves of all games
+   */
+  uint64_t plies = 0;
+  /**
+   * @brief the amount of games with an illegal move or an invalid FEN tag
+   */
+  uint64_t errors = 0;
+};
+
+/**
+ * @brief replays every game of the PGN data, e.g. to check a PGN file or to measure the import speed
+ *
+ * @param data the PGN data
+ * @param os gets a line for every game that can not be replayed, and the totals with the games and moves per second
+ * @return the totals
+ */
+ReplayStats replayAll(std::string_view data, std::ostream& os);
+}  // namespace Pgn
@@ -0,0 +1,31 @@
+//
+// Created by timap on 18.10.2026.
+//
+#include "SanParsing.h"
+
+#include <vector>
+
+#include "../../PossibleMoves/PossibleMoves.h"
+#include "StringParsing.h"
+
+namespace San {
+
+// (function documentation is provided in the corresponding header)
+SlimOptional<Move> findMove(const Board& board, Team::Team player, std::string_view san) {
+  const SlimOptional<SanMove> san_move = convert_san_to_move(san);
+  if (!san_move.has_value()) return SlimOptional<Move>::nullopt();
+
+  // only the pieces of the moving type are generated, and only the moves that fit are checked for legality
+  std::vector<Move> move_list;
+  PossibleMoves::getAllPossibleMovesOfType(board, move_list, player, san_move.data.type);
+
+  SlimOptional<Move> found = SlimOptional<Move>::nullopt();
+  for (const Move& move : move_list) {
+    if (!san_move.data.matches(move) || !PossibleMoves::isMoveLegal(board, move, player)) continue;
+    // more than one legal move matches, so the SAN is ambiguous
+    if (found.has_value()) return SlimOptional<Move>::nullopt();
+    found = SlimOptional(move);
+  }
+  return found;
+}
+}  // namespace San
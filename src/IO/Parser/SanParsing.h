@@ -0,0 +1,27 @@
+//
+// Created by timap on 18.10.2026.
+//
+
+#pragma once
+
+#include <string_view>
+
+#include "../../Board/Board.h"
+#include "../../Types/Move/Move.h"
+#include "../../Types/SlimOptional.h"
+
+/**
+ * @brief Parsing of moves in Standard Algebraic Notation (SAN), as used by EPD and PGN files.
+ */
+namespace San {
+/**
+ * @brief finds the legal move described by a SAN string
+ *
+ * @param board the board the move is made on
+ * @param player the team making the move
+ * @param san the move in SAN, e.g. "Nf3", "exd5", "Rad1", "e8=Q+", "O-O-O" \n
+ * (check, mate and annotation suffixes like "+", "#", "!" or "?!" are ignored, "0-0" is accepted for castling)
+ * @return the legal move, or a nullopt if no legal move or more than one legal move matches
+ */
+SlimOptional<Move> findMove(const Board& board, Team::Team player, std::string_view san);
+}  // namespace San
@@ -4,9 +4,11 @@
 
 #pragma once
 
+#include <algorithm>
 #include <string_view>
 
 #include "../../Types/BasicChessTypes.h"
+#include "../../Types/Move/SanMove.h"
 #include "../../Types/Move/UserMove.h"
 #include "../../Types/SlimOptional.h"
 
@@ -56,6 +58,56 @@ constexpr inline SlimOptional<Piece> pieceFromChar(char ch) noexcept {
  */
 constexpr inline uint8_t charToInt(char ch) noexcept { return ch - '0'; }
 
+/**
+ * @brief Parses a whole string as a number (e.g. the value of a command line option)
+ *
+ * @param str The string, which has to consist of only digits (no sign, no whitespace and nothing after the number)
+ * @param max_value The largest allowed value, larger numbers are reduced to it
+ * @param value Set to the number, if the string is valid
+ * @return false if the string is empty or has any other character than a digit
+ */
+constexpr bool parseNumber(std::string_view str, uint64_t max_value, uint64_t& value) noexcept {
+  if (str.empty()) return false;
+  uint64_t result = 0;
+  for (char ch : str) {
+    if (ch < '0' || ch > '9') return false;
+    const uint64_t digit = charToInt(ch);
+    // reduced to max_value before it can overflow
+    result = result > max_value / 10 ? max_value : result * 10;
+    result = max_value - result < digit ? max_value : result + digit;
+  }
+  value = result;
+  return true;
+}
+
+/**
+ * @brief Parses the next optional number argument of a command (e.g. the depth of /bestMove or bench)
+ *
+ * @param arguments The rest of the line after the command, the parsed argument gets removed from it (everything if it
+ * is not a number)
+ * @param default_value The value if no or no valid positive number was given
+ * @param max_value The largest allowed value, larger numbers are reduced to it
+ * @return The given number, or default_value
+ */
+constexpr int parseNumberArgument(std::string_view& arguments, int default_value, int max_value) noexcept {
+  uint64_t start = 0;
+  while (start < arguments.size() && (arguments[start] == ' ' || arguments[start] == '\t')) start++;
+  uint64_t end = start;
+  while (end < arguments.size() && arguments[end] != ' ' && arguments[end] != '\t') end++;
+  if (start == end) {
+    arguments = std::string_view();
+    return default_value;
+  }
+
+  uint64_t value = 0;
+  if (!parseNumber(arguments.substr(start, end - start), static_cast<uint64_t>(max_value), value)) {
+    arguments = std::string_view();
+    return default_value;
+  }
+  arguments.remove_prefix(end);
+  return value > 0 ? static_cast<int>(value) : default_value;
+}
+
 /**
  * @brief Converts a chess notation square to a position in in the Board
  *
@@ -132,3 +184,94 @@ constexpr SlimOptional<UserMove> convert_string_to_move(const std::string_view&
 
   return SlimOptional(move);
 }
+
+/**
+ * @brief Converts an upper case SAN piece letter to a PieceType
+ *
+ * @param ch The character to convert
+ * @return the PieceType of the letter (K, Q, R, B or N), or PieceType::NONE for anything else (e.g. for the file of a
+ * pawn move)
+ */
+constexpr inline PieceType::PieceType pieceTypeFromSanChar(char ch) noexcept {
+  switch (ch) {
+    case 'K':
+      return PieceType::KING;
+    case 'Q':
+      return PieceType::QUEEN;
+    case 'R':
+      return PieceType::CASTLE;
+    case 'B':
+      return PieceType::BISHOP;
+    case 'N':
+      return PieceType::KNIGHT;
+    default:
+      return PieceType::NONE;
+  }
+}
+
+/**
+ * @brief Converts a string in Standard Algebraic Notation (SAN) to a SanMove \n \n
+ *
+ * The string is expected in the format "[Piece][from file][from rank][x][Target][=Promotion][+/#]" or "O-O"/"O-O-O".
+ * Check, mate and annotation suffixes ("+", "#", "!", "?") are ignored, and "0-0"/"0-0-0" is accepted for castling.
+ *
+ * @param input The string to convert to a SanMove
+ * @return An Optional SanMove, or a nullopt if the string does not follow the format \n
+ * (whether the move is legal and unambiguous is only known on a board, see San::findMove())
+ *
+ * @example valid moves: \n
+ * normal move: Nf3, \n
+ * capture: exd5, \n
+ * disambiguation: Rad1, N5xe4, \n
+ * promotion : e8=Q+ \n
+ * castling: O-O-O \n
+ */
+constexpr SlimOptional<SanMove> convert_san_to_move(std::string_view input) {
+  while (!input.empty() && (input.back() == '+' || input.back() == '#' || input.back() == '!' || input.back() == '?')) {
+    input.remove_suffix(1);
+  }
+  if (input.empty()) return SlimOptional<SanMove>::nullopt();
+
+  SanMove move = SanMove();
+  // check castling
+  if (input == "O-O" || input == "0-0" || input == "O-O-O" || input == "0-0-0") {
+    move.type = PieceType::KING;
+    move.castling = SlimOptional(input.size() == 3 ? SpecialMove::CastleKingSide : SpecialMove::CastleQueenSide);
+    return SlimOptional(move);
+  }
+
+  // check Piece (pawn moves start with the file)
+  move.type = pieceTypeFromSanChar(input.front());
+  if (move.type == PieceType::NONE) {
+    move.type = PieceType::PAWN;
+  } else {
+    input.remove_prefix(1);
+  }
+
+  // check promotion (the '=' is optional)
+  if (input.size() >= 2 && pieceTypeFromSanChar(input.back()) != PieceType::NONE) {
+    if (move.type != PieceType::PAWN || input.back() == 'K') return SlimOptional<SanMove>::nullopt();
+    move.promote = SlimOptional(pieceTypeFromSanChar(input.back()));
+    input.remove_suffix(input[input.size() - 2] == '=' ? 2 : 1);
+  }
+
+  // check target position
+  if (input.size() < 2) return SlimOptional<SanMove>::nullopt();
+  const ChessPos to = getPosFromChar(input[input.size() - 2], input[input.size() - 1]);
+  if (!to.has_value()) return SlimOptional<SanMove>::nullopt();
+  move.to = to.data;
+  input.remove_suffix(2);
+
+  // check disambiguation and capture (the capture is not needed to find the move)
+  for (char ch : input) {
+    if (ch >= 'a' && ch <= 'h') {
+      move.from_file = static_cast<int8_t>(ch - 'a');
+    } else if (ch >= '1' && ch <= '8') {
+      move.from_row = static_cast<int8_t>('8' - ch);
+    } else if (ch != 'x' && ch != ':' && ch != '-') {
+      return SlimOptional<SanMove>::nullopt();
+    }
+  }
+
+  return SlimOptional(move);
+}
@@ -4,8 +4,11 @@
 
 #include "Print.h"
 
+#include <iomanip>
 #include <iostream>
 
+#include "../../Bot/Evaluation/Evaluate.h"
+#include "../../PossibleMoves/PossibleMoves.h"
 #include "../../Types/Vec2.h"
 
 /**
@@ -52,6 +55,78 @@ std::string position_to_string(int8_t pos) {
   return move_str;
 }
 
+// (function documentation is provided in the corresponding header)
+[[nodiscard]] std::string move_as_uci(Move move) {
+  std::string move_str;
+  push_field_position_to_string(move_str, move.from);
+  push_field_position_to_string(move_str, move.to);
+
+  // the piece of team black is printed as lowercase
+  if (move.promote.has_value()) move_str.push_back(Piece(Team::BLACK, move.promote.data).asChar());
+
+  return move_str;
+}
+
+// (function documentation is provided in the corresponding header)
+[[nodiscard]] std::string move_as_san(const Board& board, Move move) {
+  const Team::Team player = move.piece.team;
+  std::string move_str;
+
+  if (move.specialMove.data == SpecialMove::CastleKingSide) {
+    move_str = "O-O";
+  } else if (move.specialMove.data == SpecialMove::CastleQueenSide) {
+    move_str = "O-O-O";
+  } else {
+    const bool is_capture = board.isMoveCapture(move);
+    if (move.piece.type == PieceType::PAWN) {
+      // pawn captures start with the file of the pawn
+      if (is_capture) move_str.push_back(static_cast<char>('a' + move.from % 8));
+    } else {
+      move_str.push_back(Piece(Team::WHITE, move.piece.type).asChar());
+
+      // only the other legal moves of the same piece type to the same square need to be told apart
+      std::vector<Move> move_list;
+      PossibleMoves::getAllPossibleMovesOfType(board, move_list, player, move.piece.type);
+      bool is_ambiguous = false;
+      bool same_file = false;
+      bool same_row = false;
+      for (const Move& other : move_list) {
+        if (other.to != move.to || other.from == move.from) continue;
+        if (!PossibleMoves::isMoveLegal(board, other, player)) continue;
+        is_ambiguous = true;
+        same_file |= other.from % 8 == move.from % 8;
+        same_row |= other.from / 8 == move.from / 8;
+      }
+      if (is_ambiguous) {
+        const std::string from = position_to_string(move.from);
+        if (!same_file) {
+          move_str.push_back(from[0]);
+        } else if (!same_row) {
+          move_str.push_back(from[1]);
+        } else {
+          move_str += from;
+        }
+      }
+    }
+
+    if (is_capture) move_str.push_back('x');
+    push_field_position_to_string(move_str, move.to);
+    if (move.promote.has_value()) {
+      move_str.push_back('=');
+      move_str.push_back(Piece(Team::WHITE, move.promote.data).asChar());
+    }
+  }
+
+  // check or checkmate
+  Board board_after = board;
+  board_after.movePiece(move);
+  const Team::Team enemy = Team::getEnemyTeam(player);
+  if (Check::isChecked(board_after, enemy, board_after.positions.getKingPos(enemy))) {
+    move_str.push_back(PossibleMoves::hasLegalMove(board_after, enemy) ? '+' : '#');
+  }
+  return move_str;
+}
+
 // (function documentation is provided in the corresponding header)
 void print_board_grid_state(const Board_8x8& board_grid, std::ostream& os) {
   int pos = 0;
@@ -67,63 +142,101 @@ void print_board_grid_state(const Board_8x8& board_grid, std::ostream& os) {
 }
 
 // (function documentation is provided in the corresponding header)
-std::string board_state_to_fen(const Board_8x8& grid, Board_Extra extra, Team::Team current_team, int current_turn,
-                               int current_half_turn) {
-  std::string fen;
-
-  int amount_empty_squares_with_current = 0;
-
-  auto take_take_of_pieces = [&fen, &amount_empty_squares_with_current]() {
-    if (amount_empty_squares_with_current != 0) {
-      fen.push_back(static_cast<char>(amount_empty_squares_with_current + '0'));
-      amount_empty_squares_with_current = 0;
+void print_eval_trace(const EvalTrace& trace, std::ostream& os) {
+  constexpr const char* term_names[EVAL_TERM_AMOUNT] = {"Material",       "PST",           "Mobility",
+                                                        "Pawn structure", "Protected king", "King danger"};
+  os << "Term            |  White mg     eg |  Black mg     eg |    Score\n";
+  for (int i = 0; i < EVAL_TERM_AMOUNT; ++i) {
+    const EvalTerm::EvalTerm term = static_cast<EvalTerm::EvalTerm>(i);
+    os << std::left << std::setw(16) << term_names[i] << std::right << "| ";
+    for (Team::Team team : {Team::WHITE, Team::BLACK}) {
+      os << std::setw(8) << trace.mg[team][term] << ' ' << std::setw(6) << trace.eg[team][term] << " | ";
     }
-  };
+    os << std::setw(8) << trace.termScore(term) << '\n';
+  }
+  os << "Phase " << trace.mid_game_phase << "/24 (24 = midgame), Score " << trace.score;
+  if (trace.from_bitbase) os << " (from the KPK bitbase instead of the terms)";
+  os << '\n';
+}
 
-  for (int i = 0; i < BOARD_SIZE; ++i) {
-    Piece current = grid[i];
+/**
+ * @brief writes a number as decimal digits
+ *
+ * @param out where the digits get written to, afterwards points directly after the last digit
+ * @param number the number to write
+ */
+static void write_number(char*& out, int number) noexcept {
+  uint32_t value = static_cast<uint32_t>(number);
+  if (number < 0) {
+    *out++ = '-';
+    value = 0u - value;
+  }
+  char digits[10];
+  int amount = 0;
+  do {
+    digits[amount++] = static_cast<char>('0' + value % 10);
+    value /= 10;
+  } while (value != 0);
+  while (amount > 0) *out++ = digits[--amount];
+}
 
-    if (current.team == Team::NONE) {
-      amount_empty_squares_with_current++;
-    } else {
-      take_take_of_pieces();
-      fen.push_back(current.asChar());
-    }
+// (function documentation is provided in the corresponding header)
+std::string_view write_fen(FenBuffer& buffer, const Board_8x8& grid, Board_Extra extra, Team::Team current_team,
+                           int current_turn, int current_half_turn) noexcept {
+  char* out = buffer.data();
 
-    if (i % 8 == 7) {
-      take_take_of_pieces();
-      fen.push_back('/');
+  for (int row = 0; row < 8; ++row) {
+    if (row != 0) *out++ = '/';
+    int amount_empty_squares = 0;
+    for (int column = 0; column < 8; ++column) {
+      const Piece current = grid[row * 8 + column];
+      if (current.team == Team::NONE) {
+        amount_empty_squares++;
+        continue;
+      }
+      if (amount_empty_squares != 0) *out++ = static_cast<char>(amount_empty_squares + '0');
+      amount_empty_squares = 0;
+      *out++ = current.asChar();
     }
+    if (amount_empty_squares != 0) *out++ = static_cast<char>(amount_empty_squares + '0');
   }
-  fen.pop_back();
 
-  fen.push_back(' ');
-  fen.push_back(current_team == Team::WHITE ? 'w' : 'b');
-  fen.push_back(' ');
+  *out++ = ' ';
+  *out++ = current_team == Team::WHITE ? 'w' : 'b';
+  *out++ = ' ';
 
   if (!extra.getCastlingRights(ChessConstants::start_black_king_pos) &&
       !extra.getCastlingRights(ChessConstants::start_white_king_pos)) {
-    fen.push_back('-');
+    *out++ = '-';
   } else {
-    if (extra.getCastlingRights(ChessConstants::start_white_king_side_castle_pos)) fen.push_back('K');
-    if (extra.getCastlingRights(ChessConstants::start_white_queen_side_castle_pos)) fen.push_back('Q');
-    if (extra.getCastlingRights(ChessConstants::start_black_king_side_castle_pos)) fen.push_back('k');
-    if (extra.getCastlingRights(ChessConstants::start_black_queen_side_castle_pos)) fen.push_back('q');
+    if (extra.getCastlingRights(ChessConstants::start_white_king_side_castle_pos)) *out++ = 'K';
+    if (extra.getCastlingRights(ChessConstants::start_white_queen_side_castle_pos)) *out++ = 'Q';
+    if (extra.getCastlingRights(ChessConstants::start_black_king_side_castle_pos)) *out++ = 'k';
+    if (extra.getCastlingRights(ChessConstants::start_black_queen_side_castle_pos)) *out++ = 'q';
   }
-  fen.push_back(' ');
+  *out++ = ' ';
 
-  if (extra.getPassantPos().has_value()) {
-    std::string pos = Print::position_to_string(extra.getPassantPos().data);
-    fen.append(pos);
+  const ChessPos passant_pos = extra.getPassantPos();
+  if (passant_pos.has_value()) {
+    const Vec2 pos_2D = Vec2::newVec2(passant_pos.data);
+    *out++ = static_cast<char>('a' + pos_2D.x);
+    *out++ = static_cast<char>('8' - pos_2D.y);
   } else {
-    fen.push_back('-');
+    *out++ = '-';
   }
-  fen.push_back(' ');
+  *out++ = ' ';
 
-  fen += std::to_string(current_half_turn);
-  fen.push_back(' ');
-  fen += std::to_string(current_turn);
+  write_number(out, current_half_turn);
+  *out++ = ' ';
+  write_number(out, current_turn);
 
-  return fen;
+  return std::string_view(buffer.data(), static_cast<uint64_t>(out - buffer.data()));
+}
+
+// (function documentation is provided in the corresponding header)
+std::string board_state_to_fen(const Board_8x8& grid, Board_Extra extra, Team::Team current_team, int current_turn,
+                               int current_half_turn) {
+  FenBuffer buffer;
+  return std::string(write_fen(buffer, grid, extra, current_team, current_turn, current_half_turn));
 }
 }  // namespace Print
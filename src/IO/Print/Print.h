@@ -4,12 +4,18 @@
 
 #pragma once
 
+#include <array>
 #include <string>
+#include <string_view>
 
 #include "../../Board/Board_impl//Board_8x8.h"
 #include "../../Board/Board_impl/Board_Extra.h"
 #include "../../Types/Move/Move.h"
 
+// Board.h includes this header
+class Board;
+struct EvalTrace;
+
 namespace Print {
 
 /**
@@ -38,6 +44,36 @@ std::string position_to_string(int8_t pos);
  */
 [[nodiscard]] std::string move_as_string(Move move, bool is_capture);
 
+/**
+ * @brief Converts a Move object to the long algebraic notation used by the UCI protocol
+ *
+ * @param move The Move object to convert to a string
+ * @return A string representation of the move as start and end square plus the lowercase promotion piece
+ *
+ * @example
+ * normal move: e2e4, \n
+ * promotion: e7e8q, \n
+ * castling: e1g1 \n
+ */
+[[nodiscard]] std::string move_as_uci(Move move);
+
+/**
+ * @brief Converts a legal Move to Standard Algebraic Notation (SAN)
+ *
+ * @param board The board before the move
+ * @param move A legal move on the board
+ * @return A string representation of the move with as little disambiguation as needed, and "+" for check or "#"
+ * for checkmate
+ *
+ * @example
+ * normal move: Nf3, \n
+ * capture: exd5, \n
+ * disambiguation: Rad1, \n
+ * promotion: e8=Q+, \n
+ * castling: O-O-O \n
+ */
+[[nodiscard]] std::string move_as_san(const Board& board, Move move);
+
 /**
  * @brief Prints the current state of the chess board to an output stream
  *
@@ -46,6 +82,15 @@ std::string position_to_string(int8_t pos);
  */
 void print_board_grid_state(const Board_8x8& board_grid, std::ostream& os);
 
+/**
+ * @brief Prints the terms of an evaluation as a table, with the midgame and endgame value of each team and the part
+ * of the score of each term
+ *
+ * @param trace The terms of the evaluation (see evaluationTrace())
+ * @param os The output stream to which to print the table
+ */
+void print_eval_trace(const EvalTrace& trace, std::ostream& os);
+
 // Board_Extra extra not a reverence because of small size (2b)
 /**
  * @brief Converts the current state of the chess board to Forsyth-Edwards Notation (FEN)
@@ -60,4 +105,32 @@ void print_board_grid_state(const Board_8x8& board_grid, std::ostream& os);
  */
 std::string board_state_to_fen(const Board_8x8& grid, Board_Extra extra, Team::Team current_team, int current_turn,
                                int current_half_turn);
+
+/**
+ * @brief the maximum length of a FEN written by write_fen() \n
+ * (71 chars for the board, 4 for the castling rights, 2 for en passant, 2x11 for the counters and 5 separators)
+ */
+constexpr uint64_t max_fen_length = 128;
+
+/**
+ * @brief a buffer that can hold any FEN written by write_fen()
+ */
+using FenBuffer = std::array<char, max_fen_length>;
+
+/**
+ * @brief Writes the current state of the chess board in Forsyth-Edwards Notation (FEN) into the given buffer
+ *
+ * @param buffer the buffer the FEN gets written into
+ * @param grid The current state of the chess board
+ * @param extra Additional information about the board state (e.g., castling rights, en passant square)
+ * @param current_team The team that is currently to move (either Team::WHITE or Team::BLACK)
+ * @param current_turn The current turn number
+ * @param current_half_turn The number of half-turns since the last pawn move or capture
+ *
+ * @return a view of the FEN inside of the buffer (only valid as long as the buffer is)
+ *
+ * @note produces the same FEN as board_state_to_fen() without allocating, for writing many FENs
+ */
+std::string_view write_fen(FenBuffer& buffer, const Board_8x8& grid, Board_Extra extra, Team::Team current_team,
+                           int current_turn, int current_half_turn) noexcept;
 }  // namespace Print
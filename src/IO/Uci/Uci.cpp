@@ -0,0 +1,353 @@
+//
+// Created by timap on 18.10.2026.
+//
+#include "Uci.h"
+
+#include <algorithm>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include "../../Bot/Evaluation/KpkBitbase.h"
+#include "../../Bot/Evaluation/Nnue.h"
+#include "../../Bot/MinMax/MinMax.h"
+#include "../../Bot/Search/AsyncSearch.h"
+#include "../../Bot/Tablebase/Tablebase.h"
+#include "../../PossibleMoves/PossibleMoves.h"
+#include "../Parser/FenParsingException.h"
+#include "../Print/Print.h"
+
+/**
+ * @brief the factor between the scores of evaluateBoard() and centipawns
+ * @note the tapered evaluation is never divided by the maximum game phase of 24
+ */
+constexpr int score_per_centipawn = 24;
+
+/**
+ * @brief the name the engine reports to the GUI
+ */
+constexpr std::string_view engine_name = "Chess";
+
+/**
+ * @brief the author the engine reports to the GUI
+ */
+constexpr std::string_view engine_author = "LapisApple";
+
+/**
+ * @brief guards the output, because the search thread and the input thread both write to it
+ */
+static std::mutex output_mutex;
+
+/**
+ * @brief writes a single line to the output and flushes it, so that the GUI gets it immediately
+ * @param out the stream to write to
+ * @param line the line without the newline at the end
+ */
+static void sendLine(std::ostream& out, const std::string& line) {
+  std::lock_guard<std::mutex> lock(output_mutex);
+  out << line << std::endl;
+}
+
+/**
+ * @brief removes and returns the first word of the given string
+ * @param rest the string to take the word from, afterwards starts directly after the word
+ * @return the first word (without surrounding whitespace), or an empty string if there are no words left
+ */
+static std::string_view nextToken(std::string_view& rest) {
+  uint64_t start = 0;
+  while (start < rest.size() && (rest[start] == ' ' || rest[start] == '\t' || rest[start] == '\r')) start++;
+  uint64_t end = start;
+  while (end < rest.size() && rest[end] != ' ' && rest[end] != '\t' && rest[end] != '\r') end++;
+
+  const std::string_view token = rest.substr(start, end - start);
+  rest = rest.substr(end);
+  return token;
+}
+
+/**
+ * @brief parses a number argument of the "go" command
+ * @param rest the arguments, starting with the number
+ * @return the number, or 0 if it is not a number
+ */
+static int64_t nextNumber(std::string_view& rest) {
+  const std::string token = std::string(nextToken(rest));
+  try {
+    return std::stoll(token);
+  } catch (const std::exception&) {
+    return 0;
+  }
+}
+
+/**
+ * @brief executes a move and updates the move counters like ChessGame does
+ * @param position the position to execute the move in
+ * @param move a legal move of the current player
+ */
+static void playMove(Uci::Position& position, Move move) {
+  const bool resets_half_moves = move.piece.type == PieceType::PAWN || position.board.isMoveCapture(move);
+  position.board.movePiece(move);
+
+  position.amount_half_moves = resets_half_moves ? 0 : position.amount_half_moves + 1;
+  if (position.current_player == Team::BLACK) position.current_turn++;
+  position.current_player = Team::getEnemyTeam(position.current_player);
+}
+
+/**
+ * @brief converts the line of best moves to the UCI notation
+ * @param pv the line of best moves
+ * @return the moves separated by spaces
+ */
+static std::string pvAsUci(const PrincipalVariation& pv) {
+  std::string result;
+  for (int i = 0; i < pv.length; ++i) {
+    if (i > 0) result.push_back(' ');
+    result += Print::move_as_uci(pv.moves[i]);
+  }
+  return result;
+}
+
+namespace Uci {
+
+// (function documentation is provided in the corresponding header)
+SlimOptional<Move> parseUciMove(const Board& board, Team::Team player, std::string_view move_str) {
+  if (move_str.size() < 4 || move_str.size() > 5) return SlimOptional<Move>::nullopt();
+  const char from_file = move_str[0], from_rank = move_str[1], to_file = move_str[2], to_rank = move_str[3];
+  if (from_file < 'a' || from_file > 'h' || to_file < 'a' || to_file > 'h' || from_rank < '1' || from_rank > '8' ||
+      to_rank < '1' || to_rank > '8')
+    return SlimOptional<Move>::nullopt();
+
+  // 0 is a8 and 63 is h1
+  const int8_t from = static_cast<int8_t>(('8' - from_rank) * 8 + (from_file - 'a'));
+  const int8_t to = static_cast<int8_t>(('8' - to_rank) * 8 + (to_file - 'a'));
+  const char promote = move_str.size() == 5 ? move_str[4] : ' ';
+
+  std::vector<Move> move_list;
+  PossibleMoves::getAllPossibleMoves(board, move_list, player);
+  PossibleMoves::trimMovesPuttingPlayerIntoCheckmate(board, move_list, player);
+  for (const Move& move : move_list) {
+    if (move.from != from || move.to != to) continue;
+    const char move_promote = move.promote.has_value() ? Piece(Team::BLACK, move.promote.data).asChar() : ' ';
+    if (move_promote == promote) return SlimOptional(move);
+  }
+  return SlimOptional<Move>::nullopt();
+}
+
+// (function documentation is provided in the corresponding header)
+bool parsePosition(std::string_view arguments, Position& position) {
+  Position new_position = Position();
+  std::string_view rest = arguments;
+  const std::string_view kind = nextToken(rest);
+
+  if (kind == "fen") {
+    // the FEN goes until "moves" or the end of the line
+    const uint64_t moves_idx = rest.find(" moves");
+    const std::string fen_str = std::string(rest.substr(0, moves_idx));
+    rest = moves_idx == std::string_view::npos ? std::string_view() : rest.substr(moves_idx);
+    try {
+      std::string_view fen_view = fen_str;
+      while (!fen_view.empty() && fen_view.front() == ' ') fen_view.remove_prefix(1);
+      const Fen fen = Fen::buildFenFromStr(fen_view);
+      new_position = {Board(fen), fen.current_player, fen.amount_half_moves, fen.current_turn};
+    } catch (const FenParsingException&) {
+      return false;
+    }
+  } else if (kind != "startpos") {
+    return false;
+  }
+
+  if (nextToken(rest) == "moves") {
+    for (std::string_view move_str = nextToken(rest); !move_str.empty(); move_str = nextToken(rest)) {
+      const SlimOptional<Move> move = parseUciMove(new_position.board, new_position.current_player, move_str);
+      if (!move.has_value()) return false;
+      playMove(new_position, move.data);
+    }
+  }
+
+  position = new_position;
+  return true;
+}
+
+// (function documentation is provided in the corresponding header)
+SearchLimits parseGo(std::string_view arguments) {
+  SearchLimits limits = SearchLimits();
+  std::string_view rest = arguments;
+  for (std::string_view token = nextToken(rest); !token.empty(); token = nextToken(rest)) {
+    if (token == "depth") {
+      limits.depth = static_cast<int>(nextNumber(rest));
+    } else if (token == "nodes") {
+      limits.nodes = static_cast<uint64_t>(std::max<int64_t>(0, nextNumber(rest)));
+    } else if (token == "movetime") {
+      limits.movetime = nextNumber(rest);
+    } else if (token == "wtime") {
+      limits.wtime = nextNumber(rest);
+    } else if (token == "btime") {
+      limits.btime = nextNumber(rest);
+    } else if (token == "winc") {
+      limits.winc = nextNumber(rest);
+    } else if (token == "binc") {
+      limits.binc = nextNumber(rest);
+    } else if (token == "movestogo") {
+      limits.movestogo = static_cast<int>(nextNumber(rest));
+    } else if (token == "infinite") {
+      limits.infinite = true;
+    } else if (token == "ponder") {
+      // searches without limits until "ponderhit" (then with the other limits) or "stop"
+      limits.ponder = true;
+    }
+  }
+  return limits;
+}
+
+// (function documentation is provided in the corresponding header)
+void parseSetOption(std::string_view arguments, Options& options) {
+  if (nextToken(arguments) != "name") return;
+  // option names can contain spaces, so the name goes until "value"
+  std::string name;
+  for (std::string_view token = nextToken(arguments); !token.empty() && token != "value";
+       token = nextToken(arguments)) {
+    if (!name.empty()) name.push_back(' ');
+    name += token;
+  }
+
+  if (name == "MultiPV") {
+    const int64_t value = nextNumber(arguments);
+    if (value >= 1 && value <= max_multi_pv) options.multi_pv = static_cast<int>(value);
+  } else if (name == "EvalFile" || name == "TablebasePath") {
+    // paths can contain spaces, so the value is the rest of the line
+    const uint64_t start = std::min(arguments.find_first_not_of(' '), arguments.size());
+    const uint64_t end = arguments.find_last_not_of(" \r");
+    std::string& path = name == "EvalFile" ? options.eval_file : options.tablebase_path;
+    path = end == std::string_view::npos ? "" : std::string(arguments.substr(start, end + 1 - start));
+    if (path == "<empty>") path.clear();
+  } else if (name == "EvalCache") {
+    const int64_t value = nextNumber(arguments);
+    if (value >= 0 && static_cast<uint64_t>(value) <= max_eval_cache_kb) options.eval_cache_kb = value;
+  }
+}
+
+// (function documentation is provided in the corresponding header)
+std::string scoreAsUci(int score, Team::Team player) {
+  if (isMateScore(score)) return "mate " + std::to_string(mateInMoves(score, player));
+  const int player_score = player == Team::WHITE ? score : -score;
+  return "cp " + std::to_string(player_score / score_per_centipawn);
+}
+
+// (function documentation is provided in the corresponding header)
+void uciLoop(std::istream& in, std::ostream& out, std::string_view first_command) {
+  Position position = Position();
+  Options options = Options();
+  // kept between the searches of a game, so that a search can reuse the results of the previous ones
+  TranspositionTable tt = TranspositionTable();
+  AsyncSearch search;
+
+  // returns false if the loop should end
+  auto handleCommand = [&](std::string_view line) {
+    std::string_view rest = line;
+    const std::string_view command = nextToken(rest);
+
+    if (command == "uci") {
+      sendLine(out, "id name " + std::string(engine_name));
+      sendLine(out, "id author " + std::string(engine_author));
+      sendLine(out, "option name MultiPV type spin default 1 min 1 max " + std::to_string(max_multi_pv));
+      sendLine(out, "option name EvalCache type spin default " + std::to_string(EvalCache::default_size_kb) +
+                        " min 0 max " + std::to_string(max_eval_cache_kb));
+      sendLine(out, "option name TablebasePath type string default <empty>");
+#ifdef USE_NNUE
+      sendLine(out, "option name EvalFile type string default <empty>");
+#endif
+      sendLine(out, "uciok");
+    } else if (command == "isready") {
+      // generated here instead of during the first search that reaches a king and pawn against king ending
+      Kpk::init();
+      sendLine(out, "readyok");
+    } else if (command == "ucinewgame") {
+      search.stop();
+      position = Position();
+      tt.clear();
+    } else if (command == "position") {
+      search.stop();
+      if (!parsePosition(rest, position)) sendLine(out, "info string invalid position: " + std::string(rest));
+    } else if (command == "go") {
+      SearchLimits limits = parseGo(rest);
+      limits.multi_pv = options.multi_pv;
+      const Team::Team player = position.current_player;
+      search.start(
+          position.board, player, limits,
+          [&out, player](const Search::SearchInfo& info) {
+            const uint64_t nps = info.nodes * 1000 / static_cast<uint64_t>(info.time_ms + 1);
+            for (uint64_t i = 0; i < info.lines.size(); ++i) {
+              const SearchResult& result = info.lines[i];
+              std::string line = "info depth " + std::to_string(result.depth);
+              if (info.lines.size() > 1) line += " multipv " + std::to_string(i + 1);
+              line += " score " + scoreAsUci(result.score, player) + " nodes " + std::to_string(info.nodes) +
+                      " nps " + std::to_string(nps) + " time " + std::to_string(info.time_ms);
+              if (result.pv.length > 0) line += " pv " + pvAsUci(result.pv);
+              sendLine(out, line);
+            }
+            if (info.stats.pawn_hash_probes > 0) {
+              sendLine(out, "info string pawn hash hit rate " +
+                                std::to_string(static_cast<int>(info.stats.pawnHashHitRate())) + "%");
+            }
+            if (info.stats.eval_cache_probes > 0) {
+              sendLine(out, "info string eval cache hit rate " +
+                                std::to_string(static_cast<int>(info.stats.evalCacheHitRate())) + "%");
+            }
+            if (info.stats.windowed_evals > 0) {
+              sendLine(out, "info string lazy eval rate " +
+                                std::to_string(static_cast<int>(info.stats.lazyEvalRate())) + "%");
+            }
+          },
+          [&out](const SearchResult& result) {
+            if (!result.best_move.has_value()) {
+              sendLine(out, "bestmove 0000");
+              return;
+            }
+            std::string line = "bestmove " + Print::move_as_uci(result.best_move.data);
+            if (result.pv.length > 1) line += " ponder " + Print::move_as_uci(result.pv.moves[1]);
+            sendLine(out, line);
+          },
+          &tt);
+    } else if (command == "stop") {
+      search.stop();
+    } else if (command == "ponderhit") {
+      // the opponent played the expected move, so the search continues with the clock of the "go ponder" command
+      search.ponderHit();
+    } else if (command == "setoption") {
+      const std::string eval_file = options.eval_file;
+      const std::string tablebase_path = options.tablebase_path;
+      parseSetOption(rest, options);
+      // used by the threads of the following searches
+      setEvalCacheSize(options.eval_cache_kb);
+      if (options.tablebase_path != tablebase_path) {
+        // the tables must not change while a search uses them
+        search.stop();
+        const int amount = Tablebase::load(options.tablebase_path);
+        if (!options.tablebase_path.empty()) {
+          sendLine(out, "info string loaded " + std::to_string(amount) + " tablebases from " + options.tablebase_path);
+        }
+      }
+#ifdef USE_NNUE
+      if (options.eval_file != eval_file && !options.eval_file.empty()) {
+        // the network must not change while a search uses it
+        search.stop();
+        const bool loaded = Nnue::loadNetwork(options.eval_file);
+        sendLine(out, std::string("info string ") + (loaded ? "loaded" : "could not load") + " network " +
+                          options.eval_file);
+      }
+#endif
+    } else if (command == "quit") {
+      return false;
+    }
+    // other commands (e.g. "debug" or "register") are ignored, as the protocol requires
+    return true;
+  };
+
+  if (!first_command.empty() && !handleCommand(first_command)) return;
+
+  std::string line;
+  while (std::getline(in, line)) {
+    if (!handleCommand(line)) break;
+  }
+  search.stop();
+}
+}  // namespace Uci
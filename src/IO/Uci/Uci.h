@@ -0,0 +1,127 @@
+//
+// Created by timap on 18.10.2026.
+//
+
+#pragma once
+
+#include <istream>
+#include <ostream>
+#include <string>
+#include <string_view>
+
+#include "../../Board/Board.h"
+#include "../../Bot/Evaluation/EvalCache.h"
+#include "../../Bot/MinMax/SearchTypes.h"
+
+namespace Uci {
+/**
+ * @brief a position as set by the UCI "position" command
+ */
+struct Position {
+  /**
+   * @brief the board after all moves of the position command
+   */
+  Board board = Board();
+  /**
+   * @brief the player, who can currently make a move
+   */
+  Team::Team current_player = Team::WHITE;
+  /**
+   * @brief the number of half moves since the last pawn move or capture
+   */
+  int amount_half_moves = 0;
+  /**
+   * @brief the number of the full moves in the game
+   */
+  int current_turn = 1;
+};
+
+/**
+ * @brief finds the legal move that the given UCI move string describes
+ *
+ * @param board the board the move is played on
+ * @param player the player making the move
+ * @param move_str the move in long algebraic notation (e.g. "e2e4", "e7e8q" or "e1g1" for castling)
+ * @return the matching legal move, or nullopt if there is no such legal move
+ */
+SlimOptional<Move> parseUciMove(const Board& board, Team::Team player, std::string_view move_str);
+
+/**
+ * @brief parses the arguments of a "position" command
+ *
+ * @param arguments everything after "position" (e.g. "startpos moves e2e4 e7e5")
+ * @param position set to the new position, if the arguments are valid
+ * @return true if the arguments were valid, false otherwise (position is unchanged)
+ */
+bool parsePosition(std::string_view arguments, Position& position);
+
+/**
+ * @brief parses the arguments of a "go" command
+ *
+ * @param arguments everything after "go" (e.g. "wtime 1000 btime 1000 winc 10 binc 10")
+ * @return the parsed limits (unknown arguments are ignored)
+ */
+SearchLimits parseGo(std::string_view arguments);
+
+/**
+ * @brief the options the GUI can change with "setoption"
+ */
+struct Options {
+  /**
+   * @brief the amount of best moves reported in the "info" lines (option "MultiPV")
+   */
+  int multi_pv = 1;
+  /**
+   * @brief the path of the network file of the neural network evaluation (option "EvalFile", only reported and loaded
+   * when built with USE_NNUE, see Nnue.h)
+   */
+  std::string eval_file;
+  /**
+   * @brief the size of the evaluation cache of the search in kilobytes, 0 to not cache evaluations (option "EvalCache",
+   * see EvalCache.h)
+   */
+  uint64_t eval_cache_kb = EvalCache::default_size_kb;
+  /**
+   * @brief the directory of the endgame tablebase files, empty to not use the tablebases (option "TablebasePath",
+   * see Tablebase.h)
+   */
+  std::string tablebase_path;
+};
+
+/**
+ * @brief the largest value of the option "MultiPV"
+ */
+constexpr int max_multi_pv = 64;
+/**
+ * @brief the largest value of the option "EvalCache" in kilobytes (i.e. 64 MB)
+ */
+constexpr uint64_t max_eval_cache_kb = 65536;
+
+/**
+ * @brief parses the arguments of a "setoption" command
+ *
+ * @param arguments everything after "setoption", e.g. "name MultiPV value 3"
+ * @param options the options to change (unknown options and invalid values are ignored)
+ */
+void parseSetOption(std::string_view arguments, Options& options);
+
+/**
+ * @brief converts a score of the search to the score part of a UCI "info" line
+ *
+ * @param score the score for white
+ * @param player the player, whose view the score is reported from (i.e. the player to move)
+ * @return e.g. "cp 35" or "mate -3"
+ */
+std::string scoreAsUci(int score, Team::Team player);
+
+/**
+ * @brief speaks the UCI protocol until "quit" is received or the input ends
+ *
+ * @param in the stream to read the commands from
+ * @param out the stream to write the responses to
+ * @param first_command an already read command to be handled first (e.g. "uci" if it was read by the game loop)
+ *
+ * @note the search runs on its own thread, so that "stop" and "isready" are answered while it is searching
+ */
+void uciLoop(std::istream& in, std::ostream& out, std::string_view first_command = "");
+}  // namespace Uci
@@ -3,8 +3,13 @@
 //
 #include "MainGameLoop.h"
 
+#include <algorithm>
 #include <string>
 
+#include "Bot/Bench/Bench.h"
+#include "IO/Parser/StringParsing.h"
+#include "IO/Uci/Uci.h"
+
 /**
  * @brief Checks if a string starts with a specific substring.
  *
@@ -17,6 +22,11 @@ inline bool stringStartsWith(const std::string_view& string, const std::string_v
   return pos == 0;
 }
 
+/**
+ * @brief the amount of best moves /analyze shows if no amount is given
+ */
+constexpr int default_analyze_lines = 3;
+
 /**
  * @brief Handles the event of a player winning the game by exiting the programm.
  *
@@ -50,16 +60,19 @@ inline void handlePlayerGameLoss(const ChessGame& game) {
  * @return Result::SUCCESS if the move was legal, Result::FAILURE otherwise
  */
 [[nodiscard]] Result handlePlayerMove(ChessGame& game, const std::string_view& move_str) {
-  // make Player move
+  // make Player move, either in the format of the exercises (e.g. Pe2e4) or in SAN (e.g. e4)
   SlimOptional<UserMove> move = convert_string_to_move(move_str);
-  // handle input not being a move
-  if (!move.has_value()) {
+  Result res = Result::FAILURE;
+  if (move.has_value()) {
+    // try executing the chess move, not tested for legality.
+    res = game.executePlayerMove(move.data);
+  } else if (convert_san_to_move(move_str).has_value()) {
+    res = game.executePlayerSanMove(move_str);
+  } else {
+    // handle input not being a move
     std::cout << "that was not a move \n";
     return Result::FAILURE;
   }
-
-  // try executing the chess move, not tested for legality.
-  Result res = game.executePlayerMove(move.data);
   if (res == Result::FAILURE) {
     std::cout << "move was illegal \n";
     return Result::FAILURE;
@@ -93,6 +106,8 @@ void handleBotMove(ChessGame& game) {
   // check whether the bot has put the player in checkmate with his move
   // i.e. handle a possible bot win
   handlePlayerGameLoss(game);
+  // use the time the player needs for the next move to already search the answer to the expected move
+  game.startPondering();
 }
 
 /**
@@ -171,20 +186,44 @@ void handleFenParsingForChessGame(ChessGame& game, const std::string_view& line)
  *
  * @param game The current game state.
  * @param line the line with the given command
+ *
+ * @note ends pondering and a running analysis (which prints its best move), as the commands can change the game or
+ * need the cpu for themselves
  */
 void takeCareOfCommands(ChessGame& game, const std::string_view& line) {
+  game.stopPondering();
+  game.stopAnalysis();
   if (stringStartsWith(line, "/fromFen")) {
     handleFenParsingForChessGame(game, line);
   } else if (stringStartsWith(line, "/toFen")) {
     std::cout << game.asFen() << std::endl;
   } else if (stringStartsWith(line, "/allMoves")) {
-    game.print_all_possible_moves(std::cout, 5);
+    std::string_view arguments = line.substr(9);
+    const int depth = parseNumberArgument(arguments, 0, MAX_SEARCH_PLY - 1);
+    if (depth > 0) {
+      game.print_all_possible_moves_with_scores(std::cout, depth);
+    } else {
+      game.print_all_possible_moves(std::cout, 5);
+    }
   } else if (stringStartsWith(line, "/bestMove")) {
-    SlimOptional<Move> best_move = game.getBestMove();
-    game.printMove(std::cout, best_move.data);
+    std::string_view arguments = line.substr(9);
+    game.startAnalysis(std::cout, parseNumberArgument(arguments, ChessGame::bot_search_depth, MAX_SEARCH_PLY - 1));
+  } else if (stringStartsWith(line, "/analyze")) {
+    std::string_view arguments = line.substr(8);
+    const int amount = parseNumberArgument(arguments, default_analyze_lines, MAX_SEARCH_PLY);
+    const int depth = parseNumberArgument(arguments, ChessGame::bot_search_depth, MAX_SEARCH_PLY - 1);
+    game.startAnalysis(std::cout, depth, amount);
+  } else if (stringStartsWith(line, "/stop")) {
+    // the analysis was already stopped above
   } else if (stringStartsWith(line, "/evaluate")) {
+    if (line.find("trace", 9) != std::string_view::npos) {
+      Print::print_eval_trace(game.evaluationTrace(), std::cout);
+    }
     const int score = game.evaluate();
     std::cout << score << std::endl;
+  } else if (stringStartsWith(line, "/bench")) {
+    std::string_view arguments = line.substr(6);
+    Bench::runBench(parseNumberArgument(arguments, Bench::default_bench_depth, MAX_SEARCH_PLY - 1), std::cout);
   } else if (stringStartsWith(line, "/undo")) {
     // check whether both moves can be undone correctly
     if (game.amountOfUndoableMoves() < 2) {
@@ -208,11 +247,20 @@ void takeCareOfCommands(ChessGame& game, const std::string_view& line) {
   ChessGame game = ChessGame();
   game.print_current_board(std::cout);
 
+  // a GUI starts the engine and sends "uci" as the very first line
+  bool is_first_line = true;
+
   while (true) {
     // read next line
     std::string line;
     std::getline(std::cin, line);
 
+    if (is_first_line && stringStartsWith(line, "uci")) {
+      Uci::uciLoop(std::cin, std::cout, line);
+      std::exit(0);
+    }
+    is_first_line = false;
+
     // take care of commands if the current line is a command
     if (line[0] == '/') {
       takeCareOfCommands(game, line);
@@ -0,0 +1,69 @@
+//
+// Created by timap on 18.10.2026.
+//
+
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+#include "../Board/Board.h"
+#include "../Board/MakeMovePolicy.h"
+#include "../Check/Check.h"
+#include "../PossibleMoves/PossibleMoves.h"
+
+namespace Perft {
+/**
+ * @brief counts all legal move sequences of the given length starting with the given board
+ *
+ * @tparam Policy how the board of the next move is created and undone again (see MakeMovePolicy.h)
+ * @param board the current board state (the same again after the function returns)
+ * @param depth the amount of half moves to look ahead
+ * @param team the team whose turn it currently is
+ * @return the amount of reached boards at the given depth
+ *
+ * @note the caller has to make sure that the board is a legal game state (see perft())
+ */
+template <class Policy>
+inline uint64_t perft_impl(typename Policy::BoardType& board, int depth, Team::Team team) {
+  if (depth <= 0) return 1;
+
+  const Team::Team enemy = Team::getEnemyTeam(team);
+  uint64_t amount_boards = 0;
+
+  std::vector<Move> move_list;
+  PossibleMoves::getAllPossibleMoves(board, move_list, team);
+
+  for (const Move move : move_list) {
+    amount_boards += Policy::withMove(board, move, [&](typename Policy::BoardType& child) -> uint64_t {
+      if (Check::isChecked(child, team, child.positions.getKingPos(team))) return 0;
+      return perft_impl<Policy>(child, depth - 1, enemy);
+    });
+  }
+  return amount_boards;
+}
+
+/**
+ * @brief counts all legal move sequences of the given length starting with the given board
+ *
+ * @tparam Policy how the board of the next move is created and undone again (see MakeMovePolicy.h)
+ * @param board the board to start from
+ * @param depth the amount of half moves to look ahead
+ * @param team the team whose turn it currently is
+ * @return the amount of reached boards at the given depth or 0 if the board is not a legal game state
+ */
+template <class Policy = DefaultMakeMovePolicy>
+inline uint64_t perft(const Board& board, int depth, Team::Team team) {
+  const Team::Team enemy = Team::getEnemyTeam(team);
+
+  // is it even a legal game state?
+  if (!board.positions.hasPiece(Team::WHITE, PieceType::KING) ||
+      !board.positions.hasPiece(Team::BLACK, PieceType::KING))
+    return 0;
+  // has the game already ended?
+  if (Check::isChecked(board, enemy, board.positions.getKingPos(enemy))) return 0;
+
+  typename Policy::BoardType root_board = typename Policy::BoardType(board);
+  return perft_impl<Policy>(root_board, depth, team);
+}
+}  // namespace Perft
@@ -4,6 +4,8 @@
 
 #include "PossibleMoves.h"
 
+#include "../Profiling/Profiler.h"
+
 // helper methods
 /**
  * @brief Checks if a move is possible (i.e. inside the board and not taking sown piece)
@@ -120,6 +122,7 @@ namespace PossibleMoves {
  * @note It considers normal moves, captures, and special moves like en passant and promotion.
  */
 void getPossiblePawnMove(const Board& board, std::vector<Move>& moveVec, Piece pawn, int8_t pawn_pos) {
+  PROFILE_ZONE(GET_POSSIBLE_PAWN_MOVE);
   const int8_t startLine = pawn.team == Team::WHITE ? 6 : 1;
   const int8_t pawnDir = pawn.team == Team::WHITE ? -1 : 1;
   const int8_t endLine = pawn.team == Team::WHITE ? 0 : 7;
@@ -205,6 +208,7 @@ void getPossiblePawnMove(const Board& board, std::vector<Move>& moveVec, Piece p
  * @note It considers normal moves, captures, and castling.
  */
 void getPossibleKingMove(const Board& board, std::vector<Move>& moveVec, Piece king, int8_t king_pos) {
+  PROFILE_ZONE(GET_POSSIBLE_KING_MOVE);
   constexpr Vec2 kingOffset[8] = {{-1, -1}, {1, -1}, {-1, 1}, {1, 1}, {0, -1}, {0, 1}, {-1, 0}, {1, 0}};
 
   Move move = {king, king_pos, 0, OptionalPieceType::nullopt(), SlimOptional(SpecialMove::loseCastlingBoth)};
@@ -250,6 +254,7 @@ void getPossibleKingMove(const Board& board, std::vector<Move>& moveVec, Piece k
  * @param knight_pos The current position of the knight on the board
  */
 void getPossibleKnightMove(const Board& board, std::vector<Move>& moveVec, Piece knight, int8_t knight_pos) {
+  PROFILE_ZONE(GET_POSSIBLE_KNIGHT_MOVE);
   constexpr Vec2 knightOffsets[8] = {{-2, -1}, {-2, 1}, {2, -1}, {2, 1}, {-1, -2}, {-1, 2}, {1, -2}, {1, 2}};
 
   Move move = {knight, knight_pos, 0, OptionalPieceType::nullopt(), SlimOptional<SpecialMove>::nullopt()};
@@ -274,6 +279,7 @@ void getPossibleKnightMove(const Board& board, std::vector<Move>& moveVec, Piece
  */
 void getPossibleCastleMove(const Board& board, std::vector<Move>& moveVec, Piece castle, int8_t castle_pos,
                            SlimOptional<SpecialMove> specialMove) {
+  PROFILE_ZONE(GET_POSSIBLE_CASTLE_MOVE);
   constexpr Vec2 lines[4] = {{0, -1}, {0, 1}, {-1, 0}, {1, 0}};
 
   Move move = {castle, castle_pos, 0, OptionalPieceType::nullopt(), specialMove};
@@ -296,6 +302,7 @@ void getPossibleCastleMove(const Board& board, std::vector<Move>& moveVec, Piece
  * @param bishop_pos The current position of the bishop on the board
  */
 void getPossibleBishopMove(const Board& board, std::vector<Move>& moveVec, Piece bishop, int8_t bishop_pos) {
+  PROFILE_ZONE(GET_POSSIBLE_BISHOP_MOVE);
   constexpr Vec2 diags[4] = {{-1, -1}, {1, -1}, {-1, 1}, {1, 1}};
 
   Move move = {bishop, bishop_pos, 0, OptionalPieceType::nullopt(), SlimOptional<SpecialMove>::nullopt()};
@@ -318,12 +325,14 @@ void getPossibleBishopMove(const Board& board, std::vector<Move>& moveVec, Piece
  * @param queen_pos The current position of the queen on the board
  */
 void getPossibleQueenMove(const Board& board, std::vector<Move>& moveVec, Piece queen, int8_t queen_pos) {
+  PROFILE_ZONE(GET_POSSIBLE_QUEEN_MOVE);
   getPossibleCastleMove(board, moveVec, queen, queen_pos, SlimOptional<SpecialMove>::nullopt());
   getPossibleBishopMove(board, moveVec, queen, queen_pos);
 }
 
 // (function documentation is provided in the corresponding header)
 void getAllPossibleMoves(const Board& board, std::vector<Move>& moveVec, Team::Team team) {
+  PROFILE_ZONE(GET_ALL_POSSIBLE_MOVES);
   // all king moves
   Board_Positions::PositionsSlice kings = board.positions.getVec(team, PieceType::KING);
   for (int i = 0; i < kings.size; ++i) {
@@ -368,4 +377,49 @@ void getAllPossibleMoves(const Board& board, std::vector<Move>& moveVec, Team::T
     getPossiblePawnMove(board, moveVec, Piece(team, PieceType::PAWN), pawnPos);
   }
 }
+
+// (function documentation is provided in the corresponding header)
+void getAllPossibleMovesOfType(const Board& board, std::vector<Move>& moveVec, Team::Team team,
+                               PieceType::PieceType type) {
+  const Piece piece = Piece(team, type);
+  Board_Positions::PositionsSlice positions = board.positions.getVec(team, type);
+  for (int i = 0; i < positions.size; ++i) {
+    const int8_t pos = positions[i];
+    switch (type) {
+      case PieceType::KING:
+        getPossibleKingMove(board, moveVec, piece, pos);
+        break;
+      case PieceType::QUEEN:
+        getPossibleQueenMove(board, moveVec, piece, pos);
+        break;
+      case PieceType::BISHOP:
+        getPossibleBishopMove(board, moveVec, piece, pos);
+        break;
+      case PieceType::KNIGHT:
+        getPossibleKnightMove(board, moveVec, piece, pos);
+        break;
+      case PieceType::CASTLE: {
+        uint8_t castlingRights = board.extra.getCastlingRights(pos);
+        SlimOptional<SpecialMove> special = SlimOptional(static_cast<SpecialMove>(castlingRights >> (team << 1)));
+        getPossibleCastleMove(board, moveVec, piece, pos, special);
+        break;
+      }
+      case PieceType::PAWN:
+        getPossiblePawnMove(board, moveVec, piece, pos);
+        break;
+      default:
+        break;
+    }
+  }
+}
+
+// (function documentation is provided in the corresponding header)
+bool hasLegalMove(const Board& board, Team::Team player) {
+  std::vector<Move> move_list;
+  getAllPossibleMoves(board, move_list, player);
+  for (const Move& move : move_list) {
+    if (isMoveLegal(board, move, player)) return true;
+  }
+  return false;
+}
 }  // namespace PossibleMoves
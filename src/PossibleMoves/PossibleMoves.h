@@ -25,6 +25,44 @@ namespace PossibleMoves {
  */
 void getAllPossibleMoves(const Board& board, std::vector<Move>& moveVec, Team::Team team);
 
+/**
+ * @brief Generates all Pseudo-legal moves of the pieces of one type for a given team on a given board
+ *
+ * @param board The current state of the chess board
+ * @param moveVec A vector to add the generated moves to
+ * @param team The team for which to generate the moves
+ * @param type The type of the pieces to generate the moves for (e.g. only the knights for the SAN move "Nf3")
+ *
+ * @return nothing, but modifies the given vector of moves
+ */
+void getAllPossibleMovesOfType(const Board& board, std::vector<Move>& moveVec, Team::Team team,
+                               PieceType::PieceType type);
+
+/**
+ * @brief checks whether a Pseudo-legal move is legal, i.e. does not leave the player's own king in check
+ *
+ * @param board the current chess board state
+ * @param move a Pseudo-legal move of the player
+ * @param player the player making the move
+ * @return true if the move is legal
+ */
+inline bool isMoveLegal(const Board& board, Move move, Team::Team player) {
+  Board tempBoard = board;
+  tempBoard.movePiece(move);
+  return !Check::isChecked(tempBoard, player, tempBoard.positions.getKingPos(player));
+}
+
+/**
+ * @brief checks whether the player has any legal move
+ *
+ * @param board the current chess board state
+ * @param player the player to check
+ * @return true if the player has at least one legal move
+ *
+ * @note stops at the first legal move instead of checking every move like trimMovesPuttingPlayerIntoCheckmate()
+ */
+bool hasLegalMove(const Board& board, Team::Team player);
+
 /**
  * @brief removes all Moves that would put the player in checkmate
  *
@@ -0,0 +1,105 @@
+//
+// Created by timap on 18.10.2026.
+//
+#include "Profiler.h"
+
+#ifdef ENABLE_PROFILING
+
+#include <iomanip>
+#include <iostream>
+#include <mutex>
+#include <string>
+
+/**
+ * @brief prints the measurements as a table
+ * @param os the stream to print to
+ * @param zones the measurements indexed by Profiler::Zone
+ * @param description what the measurements include
+ */
+static void printZones(std::ostream& os, const Profiler::ZoneStats (&zones)[Profiler::ZONE_AMOUNT],
+                       const std::string& description) {
+  uint64_t max_ticks = 1;
+  for (const Profiler::ZoneStats& zone : zones) {
+    if (zone.ticks > max_ticks) max_ticks = zone.ticks;
+  }
+
+  const std::ios_base::fmtflags old_flags = os.flags();
+  os << "\nprofile of " << description << " (times include inner zones)\n";
+  os << std::left << std::setw(24) << "zone" << std::right << std::setw(14) << "calls" << std::setw(18)
+     << (std::string("total ") + Profiler::ticks_unit) << std::setw(14)
+     << (std::string(Profiler::ticks_unit) + "/call") << std::setw(10) << "% max" << "\n";
+  os << std::fixed << std::setprecision(1);
+  for (int i = 0; i < Profiler::ZONE_AMOUNT; ++i) {
+    const Profiler::ZoneStats& zone = zones[i];
+    if (zone.calls == 0) continue;
+    os << std::left << std::setw(24) << Profiler::zone_names[i] << std::right << std::setw(14) << zone.calls
+       << std::setw(18) << zone.ticks << std::setw(14)
+       << static_cast<double>(zone.ticks) / static_cast<double>(zone.calls) << std::setw(10)
+       << static_cast<double>(zone.ticks) * 100 / static_cast<double>(max_ticks) << "\n";
+  }
+  os.flags(old_flags);
+}
+
+/**
+ * @brief the measurements of all threads that have already ended, printed when the program exits
+ */
+class GlobalStats {
+ public:
+  /**
+   * @brief guards zones and amount_threads
+   */
+  std::mutex mutex;
+  /**
+   * @brief the summed up measurements indexed by Profiler::Zone
+   */
+  Profiler::ZoneStats zones[Profiler::ZONE_AMOUNT];
+  /**
+   * @brief the amount of threads whose measurements are included
+   */
+  int amount_threads = 0;
+
+  /**
+   * @brief prints the table of all measurements when the program exits
+   * @note the thread_local measurements of the main thread are already merged at this point
+   */
+  ~GlobalStats() { printZones(std::cerr, zones, std::to_string(amount_threads) + " threads"); }
+};
+
+/**
+ * @return the global measurements
+ * @note constructed on first use, so that it outlives the thread_local measurements of the main thread
+ */
+static GlobalStats& globalStats() {
+  static GlobalStats global_stats;
+  return global_stats;
+}
+
+// (function documentation is provided in the corresponding header)
+Profiler::ThreadStats::~ThreadStats() {
+  GlobalStats& global = globalStats();
+  std::lock_guard<std::mutex> lock(global.mutex);
+  for (int i = 0; i < ZONE_AMOUNT; ++i) {
+    global.zones[i].calls += zones[i].calls;
+    global.zones[i].ticks += zones[i].ticks;
+    zones[i] = ZoneStats();
+  }
+  global.amount_threads++;
+}
+
+namespace Profiler {
+
+// (function documentation is provided in the corresponding header)
+void printTable(std::ostream& os) {
+  GlobalStats& global = globalStats();
+  std::lock_guard<std::mutex> lock(global.mutex);
+
+  ZoneStats totals[ZONE_AMOUNT];
+  for (int i = 0; i < ZONE_AMOUNT; ++i) {
+    totals[i].calls = global.zones[i].calls + thread_stats.zones[i].calls;
+    totals[i].ticks = global.zones[i].ticks + thread_stats.zones[i].ticks;
+  }
+  printZones(os, totals, std::to_string(global.amount_threads) + " ended threads and the current thread");
+}
+}  // namespace Profiler
+
+#endif
@@ -0,0 +1,170 @@
+//
+// Created by timap on 18.10.2026.
+//
+
+#pragma once
+
+/**
+ * @brief scoped timers for the hot paths of move generation, search and evaluation
+ *
+ * Zones are only compiled in when ENABLE_PROFILING is defined, otherwise PROFILE_ZONE() expands to nothing. \n
+ * Every thread counts the calls and time of each zone for itself, merges them into the global totals when it ends,
+ * and the global totals get printed as a table to std::cerr when the program exits.
+ *
+ * @note the time of a zone includes the time of all zones inside of it (e.g. MinMax includes everything),
+ * but recursive calls of the same zone are only timed once (by the outermost call)
+ */
+#ifdef ENABLE_PROFILING
+
+#include <chrono>
+#include <cstdint>
+#include <ostream>
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#endif
+
+namespace Profiler {
+/**
+ * @brief all code sections that can be measured
+ */
+enum Zone : uint8_t {
+  MIN_MAX,
+  GET_ALL_POSSIBLE_MOVES,
+  GET_POSSIBLE_PAWN_MOVE,
+  GET_POSSIBLE_KING_MOVE,
+  GET_POSSIBLE_KNIGHT_MOVE,
+  GET_POSSIBLE_CASTLE_MOVE,
+  GET_POSSIBLE_BISHOP_MOVE,
+  GET_POSSIBLE_QUEEN_MOVE,
+  IS_CHECKED,
+  EVALUATE_BOARD,
+  MOVE_PIECE,
+  ZONE_AMOUNT
+};
+
+/**
+ * @brief the names of the zones as printed in the table
+ */
+constexpr const char* zone_names[ZONE_AMOUNT] = {
+    "MinMax_impl",          "getAllPossibleMoves",    "getPossiblePawnMove",   "getPossibleKingMove",
+    "getPossibleKnightMove", "getPossibleCastleMove", "getPossibleBishopMove", "getPossibleQueenMove",
+    "Check::isChecked",      "evaluateBoard",         "Board::movePiece",
+};
+
+/**
+ * @brief the accumulated measurements of a single zone
+ */
+struct ZoneStats {
+  /**
+   * @brief how often the zone was entered
+   */
+  uint64_t calls = 0;
+  /**
+   * @brief the total time spent inside the zone (see ticks_unit)
+   */
+  uint64_t ticks = 0;
+  /**
+   * @brief how many calls of the zone are currently running (i.e. the recursion depth)
+   */
+  uint64_t active = 0;
+};
+
+/**
+ * @brief the measurements of all zones of a single thread
+ */
+struct ThreadStats {
+  /**
+   * @brief the measurements indexed by Zone
+   */
+  ZoneStats zones[ZONE_AMOUNT];
+
+  /**
+   * @brief merges the measurements of this thread into the global totals
+   */
+  ~ThreadStats();
+};
+
+/**
+ * @brief the measurements of the current thread
+ */
+inline thread_local ThreadStats thread_stats;
+
+#if defined(__x86_64__) || defined(__i386__)
+/**
+ * @brief the unit of ZoneStats::ticks
+ */
+constexpr const char* ticks_unit = "cycles";
+
+/**
+ * @return the current time in ticks_unit
+ */
+inline uint64_t now() noexcept { return __rdtsc(); }
+#else
+constexpr const char* ticks_unit = "ns";
+
+inline uint64_t now() noexcept {
+  return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+                                   std::chrono::steady_clock::now().time_since_epoch())
+                                   .count());
+}
+#endif
+
+/**
+ * @brief measures the time from its construction to its destruction as one call of a zone
+ */
+class ScopedZone {
+ private:
+  /**
+   * @brief the zone that is measured
+   */
+  Zone zone;
+  /**
+   * @brief the time the zone was entered
+   */
+  uint64_t start;
+
+ public:
+  /**
+   * @brief enters the zone
+   * @param zone the zone to measure
+   */
+  explicit ScopedZone(Zone zone) noexcept : zone(zone), start(now()) { thread_stats.zones[zone].active++; }
+
+  /**
+   * @brief leaves the zone and adds the call to the measurements of the current thread
+   */
+  ~ScopedZone() {
+    ZoneStats& stats = thread_stats.zones[zone];
+    stats.calls++;
+    // only the outermost call of a recursive zone is timed, otherwise the time would be counted multiple times
+    if (--stats.active == 0) stats.ticks += now() - start;
+  }
+
+  ScopedZone(const ScopedZone&) = delete;
+  ScopedZone& operator=(const ScopedZone&) = delete;
+};
+
+/**
+ * @brief prints the global totals (i.e. of all threads that have already ended) and the current thread as a table
+ * @param os the stream to print to
+ */
+void printTable(std::ostream& os);
+}  // namespace Profiler
+
+/**
+ * @brief measures the rest of the current scope as one call of the given zone
+ */
+#define PROFILE_ZONE(zone) const Profiler::ScopedZone profile_zone(Profiler::zone)
+
+/**
+ * @brief constexpr, unless profiling is enabled (zones can not be used in constexpr functions)
+ */
+#define PROFILING_CONSTEXPR
+
+#else
+
+#define PROFILE_ZONE(zone)
+#define PROFILING_CONSTEXPR constexpr
+
+#endif
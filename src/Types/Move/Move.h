@@ -13,29 +13,44 @@
  * @brief Represents a move in a chess game
  *
  * @note A Move consists of the piece being moved, the initial and final positions of the piece on the board,
- * and an optional field for pawn promotion and another for special moves like castling or en passant.
+ * and an optional field for pawn promotion and another for special moves like castling or en passant. \n
+ * A default constructed Move is an impossible move (the same as SlimOptional\<Move\>::nullopt())
  */
 struct Move {
   /**
    * The Piece that is being moved
    */
-  Piece piece;
+  Piece piece = Piece::getEmpty();
   /**
    * the square where the moving Piece is located before the move (0=..\<64)
    */
-  int8_t from;
+  int8_t from = -1;
   /**
    * the square where the moving Piece is located after the move (0=..\<64)
    */
-  int8_t to;
+  int8_t to = -1;
   /**
    * An optional field that, if present, indicates the PieceType to which a pawn is being promoted
    */
-  SlimOptional<PieceType::PieceType> promote;
+  SlimOptional<PieceType::PieceType> promote = OptionalPieceType::nullopt();
   /**
    * An optional field that, if present, indicates a special move (e.g., castling, en passant)
    */
-  SlimOptional<SpecialMove> specialMove;
+  SlimOptional<SpecialMove> specialMove = SlimOptional<SpecialMove>::nullopt();
+
+  /**
+   *  @param other another move
+   *  @return true if and only if both moves move the same piece in the same way, otherwise false
+   */
+  constexpr bool operator==(const Move& other) const {
+    return piece == other.piece && from == other.from && to == other.to && promote.data == other.promote.data &&
+           specialMove.data == other.specialMove.data;
+  }
+  /**
+   *  @param other another move
+   *  @return false if and only if both moves move the same piece in the same way, otherwise true
+   */
+  constexpr bool operator!=(const Move& other) const { return !(*this == other); }
 };
 
 /**
@@ -0,0 +1,85 @@
+//
+// Created by timap on 18.10.2026.
+//
+
+#pragma once
+
+#include <cstdint>
+
+#include "../BasicChessTypes.h"
+#include "../SlimOptional.h"
+#include "Move.h"
+
+/**
+ * @brief Represents a move in Standard Algebraic Notation (SAN), i.e. only as much as is needed to tell it apart
+ * from the other legal moves
+ *
+ * @note A SanMove consists of the type of the moving piece, its target square, the optional file and rank of its
+ * start square, an optional promotion and whether it is castling.
+ */
+struct SanMove {
+  /**
+   * the type of the moving piece (the king for castling)
+   */
+  PieceType::PieceType type;
+  /**
+   * the file of the start square (0 = a ..\< 8), or -1 if the SAN does not give it
+   */
+  int8_t from_file;
+  /**
+   * the row of the start square as in the Board (0 = rank 8 ..\< 8), or -1 if the SAN does not give it
+   */
+  int8_t from_row;
+  /**
+   * the square where the moving piece is located after the move (0=..\<64), or -1 for castling
+   */
+  int8_t to;
+  /**
+   * An optional field that, if present, indicates the PieceType to which a pawn is being promoted
+   */
+  SlimOptional<PieceType::PieceType> promote;
+  /**
+   * SpecialMove::CastleKingSide or SpecialMove::CastleQueenSide for castling, otherwise a nullopt
+   */
+  SlimOptional<SpecialMove> castling;
+
+  /**
+   * A default constructor that creates an impossible SAN move
+   */
+  constexpr SanMove() noexcept
+      : type(PieceType::NONE),
+        from_file(-1),
+        from_row(-1),
+        to(-1),
+        promote(OptionalPieceType::nullopt()),
+        castling(SlimOptional<SpecialMove>::nullopt()) {}
+
+  /**
+   * @brief checks whether a Pseudo-legal move fits this SAN move
+   * @param other the move to be compared to
+   * @return true if the move has the same piece type, target square, promotion and castling and starts on the
+   * given file and rank
+   */
+  [[nodiscard]] constexpr inline bool matches(Move other) const {
+    if (castling.has_value()) return other.specialMove.data == castling.data;
+    return other.piece.type == type && other.to == to && other.promote.data == promote.data &&
+           (from_file < 0 || other.from % 8 == from_file) && (from_row < 0 || other.from / 8 == from_row);
+  }
+};
+
+/**
+ * @brief A simple wrapper to get an empty Optional
+ * @return A SlimOptional\<SanMove\> object representing an impossible SAN move
+ */
+template <>
+constexpr inline SlimOptional<SanMove> SlimOptional<SanMove>::nullopt() noexcept {
+  return SlimOptional(SanMove());
+}
+/**
+ * @brief Checks whether the SAN move is an empty Optional
+ * @return true if the SAN move describes a move and false otherwise
+ */
+template <>
+constexpr inline bool SlimOptional<SanMove>::has_value() const noexcept {
+  return data.type != PieceType::NONE;
+}
@@ -2,6 +2,154 @@
 // Created by tim.apel on 1/12/24.
 //
 
+#include <fstream>
+#include <iostream>
+#include <string_view>
+
+#include "Bot/Batch/Batch.h"
+#include "Bot/Batch/EpdSuite.h"
+#include "Bot/Bench/Bench.h"
+#include "Bot/Tablebase/Tablebase.h"
+#include "Bot/Tuning/Tuner.h"
+#include "IO/Binary/PackedPosition.h"
+#include "IO/Parser/MappedFile.h"
+#include "IO/Parser/PgnParsing.h"
+#include "IO/Parser/StringParsing.h"
+#include "IO/Uci/Uci.h"
 #include "MainGameLoop.h"
 
-int main() { Chess::mainGameLoop(); }
+int main(int argc, char** argv) {
+  // "bench [depth]" runs the bench instead of starting a game
+  if (argc > 1 && std::string_view(argv[1]) == "bench") {
+    std::string_view arguments = argc > 2 ? argv[2] : "";
+    const int depth = parseNumberArgument(arguments, Bench::default_bench_depth, MAX_SEARCH_PLY - 1);
+    Bench::runBench(depth, std::cout);
+    return 0;
+  }
+
+  // "batch [options] [file]" analyzes every FEN or EPD line of the file (or stdin) on all cores
+  if (argc > 1 && std::string_view(argv[1]) == "batch") {
+    Batch::BatchOptions options = Batch::BatchOptions();
+    std::string input_path;
+    if (!Batch::parseBatchArguments(argc - 2, argv + 2, options, input_path)) {
+      Batch::printBatchUsage(std::cerr);
+      return 1;
+    }
+    if (input_path == "-") {
+      Batch::runBatch(std::cin, std::cout, options);
+      return 0;
+    }
+    std::ifstream file(input_path);
+    if (!file) {
+      std::cerr << "could not open " << input_path << '\n';
+      return 1;
+    }
+    Batch::runBatch(file, std::cout, options);
+    return 0;
+  }
+
+  // "epd [options] [file]" checks the searched moves against the bm/am operations of an EPD test suite
+  if (argc > 1 && std::string_view(argv[1]) == "epd") {
+    Batch::SuiteOptions options = Batch::SuiteOptions();
+    std::string input_path;
+    if (!Batch::parseSuiteArguments(argc - 2, argv + 2, options, input_path)) {
+      Batch::printSuiteUsage(std::cerr);
+      return 1;
+    }
+    if (input_path == "-") {
+      Batch::runEpdSuite(std::cin, std::cout, options);
+      return 0;
+    }
+    std::ifstream file(input_path);
+    if (!file) {
+      std::cerr << "could not open " << input_path << '\n';
+      return 1;
+    }
+    Batch::runEpdSuite(file, std::cout, options);
+    return 0;
+  }
+
+  // "pgn file" replays every game of the PGN file and prints how fast that was
+  if (argc > 1 && std::string_view(argv[1]) == "pgn") {
+    if (argc != 3) {
+      std::cerr << "usage: ./Chess pgn FILE\n";
+      return 1;
+    }
+    const MappedFile file = MappedFile(argv[2]);
+    if (!file.isOpen()) {
+      std::cerr << "could not open " << argv[2] << '\n';
+      return 1;
+    }
+    const Pgn::ReplayStats stats = Pgn::replayAll(file.data(), std::cout);
+    return stats.errors == 0 ? 0 : 1;
+  }
+
+  // "pack in out" converts the FEN or EPD lines of a file into a file of 32 byte packed positions
+  if (argc > 1 && std::string_view(argv[1]) == "pack") {
+    if (argc != 4) {
+      std::cerr << "usage: ./Chess pack FEN_FILE OUTPUT_FILE\n";
+      return 1;
+    }
+    std::ifstream in(argv[2]);
+    std::ofstream out(argv[3], std::ios::binary);
+    if (!in || !out) {
+      std::cerr << "could not open " << (!in ? argv[2] : argv[3]) << '\n';
+      return 1;
+    }
+    std::cout << Packed::packFenLines(in, out, std::cerr) << " positions packed\n";
+    return 0;
+  }
+
+  // "unpack file" prints the positions of a file of packed positions as FEN lines
+  if (argc > 1 && std::string_view(argv[1]) == "unpack") {
+    if (argc != 3) {
+      std::cerr << "usage: ./Chess unpack FILE\n";
+      return 1;
+    }
+    const MappedFile file = MappedFile(argv[2]);
+    if (!file.isOpen()) {
+      std::cerr << "could not open " << argv[2] << '\n';
+      return 1;
+    }
+    if (!Packed::unpackToFenLines(file.data(), std::cout)) {
+      std::cerr << argv[2] << " is not a valid file of packed positions\n";
+      return 1;
+    }
+    return 0;
+  }
+
+  // "tune [options] file" tunes the constants of the evaluation on positions labelled with the result of their game
+  if (argc > 1 && std::string_view(argv[1]) == "tune") {
+    Tuning::TuneOptions options = Tuning::TuneOptions();
+    std::string input_path;
+    if (!Tuning::parseTuneArguments(argc - 2, argv + 2, options, input_path)) {
+      Tuning::printTuneUsage(std::cerr);
+      return 1;
+    }
+    const MappedFile file = MappedFile(input_path);
+    if (!file.isOpen()) {
+      std::cerr << "could not open " << input_path << '\n';
+      return 1;
+    }
+    return Tuning::runTuner(file.data(), options, std::cout) ? 0 : 1;
+  }
+
+  // "tablebase [options] directory" generates the endgame tablebases with up to 4 pieces on all cores
+  if (argc > 1 && std::string_view(argv[1]) == "tablebase") {
+    Tablebase::GenerateOptions options = Tablebase::GenerateOptions();
+    std::string directory;
+    if (!Tablebase::parseGenerateArguments(argc - 2, argv + 2, options, directory)) {
+      Tablebase::printGenerateUsage(std::cerr);
+      return 1;
+    }
+    return Tablebase::generate(directory, options, std::cout) ? 0 : 1;
+  }
+
+  // "uci" speaks the UCI protocol instead of starting a game (also possible by sending "uci" as the first line)
+  if (argc > 1 && std::string_view(argv[1]) == "uci") {
+    Uci::uciLoop(std::cin, std::cout);
+    return 0;
+  }
+
+  Chess::mainGameLoop();
+}